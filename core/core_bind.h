@@ -71,6 +71,8 @@ public:
 	Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, CacheMode p_cache_mode = CACHE_MODE_REUSE);
 	ThreadLoadStatus load_threaded_get_status(const String &p_path, Array r_progress = ClassDB::default_array_arg);
 	Ref<Resource> load_threaded_get(const String &p_path);
+	Error load_threaded_request_graph(const String &p_path, const String &p_type_hint = "", int p_priority = 0, CacheMode p_cache_mode = CACHE_MODE_REUSE);
+	void load_threaded_set_priority(const String &p_path, int p_priority);
 
 	Ref<Resource> load(const String &p_path, const String &p_type_hint = "", CacheMode p_cache_mode = CACHE_MODE_REUSE);
 	Vector<String> get_recognized_extensions_for_type(const String &p_type);
@@ -105,6 +107,7 @@ public:
 		FLAG_SAVE_BIG_ENDIAN = 16,
 		FLAG_COMPRESS = 32,
 		FLAG_REPLACE_SUBRESOURCE_PATHS = 64,
+		FLAG_COMPRESS_PROPERTIES = 128,
 	};
 
 	static ResourceSaver *get_singleton() { return singleton; }
@@ -180,6 +180,9 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+
+	virtual Error map_to_memory() { return ERR_UNAVAILABLE; } ///< serve further reads from a read-only memory mapping of the file, if supported
+	virtual Span<uint8_t> get_mapped_span(uint64_t p_length) const { return Span<uint8_t>(); } ///< get the next bytes without copying them, empty if the file is not mapped or too short. The span is valid until the file is closed.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
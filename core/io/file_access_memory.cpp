@@ -73,6 +73,17 @@ Error FileAccessMemory::open_custom(const uint8_t *p_data, uint64_t p_len) {
 	data = (uint8_t *)p_data;
 	length = p_len;
 	pos = 0;
+	growable = false;
+	growable_data.clear();
+	return OK;
+}
+
+Error FileAccessMemory::open_growable(uint64_t p_reserve) {
+	growable_data.resize(MAX(p_reserve, (uint64_t)256));
+	data = growable_data.ptrw();
+	length = 0;
+	pos = 0;
+	growable = true;
 	return OK;
 }
 
@@ -141,6 +152,16 @@ uint64_t FileAccessMemory::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+Span<uint8_t> FileAccessMemory::get_mapped_span(uint64_t p_length) const {
+	if (!data || pos > length || p_length > length - pos) {
+		return Span<uint8_t>();
+	}
+
+	Span<uint8_t> span(&data[pos], p_length);
+	pos += p_length;
+	return span;
+}
+
 Error FileAccessMemory::get_error() const {
 	return pos >= length ? ERR_FILE_EOF : OK;
 }
@@ -156,6 +177,14 @@ bool FileAccessMemory::store_buffer(const uint8_t *p_src, uint64_t p_length) {
 
 	ERR_FAIL_NULL_V(p_src, false);
 
+	if (growable && pos + p_length > length) {
+		if (pos + p_length > (uint64_t)growable_data.size()) {
+			growable_data.resize(MAX(pos + p_length, (uint64_t)growable_data.size() * 2));
+			data = growable_data.ptrw();
+		}
+		length = pos + p_length;
+	}
+
 	uint64_t left = length - pos;
 	uint64_t write = MIN(p_length, left);
 
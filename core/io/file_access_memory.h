@@ -37,6 +37,9 @@ class FileAccessMemory : public FileAccess {
 	uint64_t length = 0;
 	mutable uint64_t pos = 0;
 
+	Vector<uint8_t> growable_data; // Owned storage when opened with open_growable().
+	bool growable = false;
+
 	static Ref<FileAccess> create();
 
 public:
@@ -44,6 +47,8 @@ public:
 	static void cleanup();
 
 	virtual Error open_custom(const uint8_t *p_data, uint64_t p_len); ///< open a file
+	Error open_growable(uint64_t p_reserve = 0); ///< open an empty owned buffer that grows as data is stored
+	Span<uint8_t> get_growable_data() const { return growable ? Span<uint8_t>(data, length) : Span<uint8_t>(); }
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
 
@@ -56,6 +61,9 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override; ///< get an array of bytes
 
+	virtual Error map_to_memory() override { return OK; }
+	virtual Span<uint8_t> get_mapped_span(uint64_t p_length) const override;
+
 	virtual Error get_error() const override; ///< get last error
 
 	virtual Error resize(int64_t p_length) override { return ERR_UNAVAILABLE; }
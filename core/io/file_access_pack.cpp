@@ -152,8 +152,25 @@ void PackedData::_get_file_paths(PackedDir *p_dir, const String &p_parent_dir, H
 	}
 }
 
+void PackedData::add_pack_mapping(const String &p_pkg_path, const Ref<FileAccess> &p_file) {
+	p_file->seek(0);
+	PackMapping mapping;
+	mapping.data = p_file->get_mapped_span(p_file->get_length());
+	if (mapping.data.is_empty()) {
+		return; // Not mapped.
+	}
+	mapping.file = p_file;
+	pack_mappings[p_pkg_path] = mapping;
+}
+
+PackedData::PackMapping PackedData::get_pack_mapping(const String &p_pkg_path) const {
+	const PackMapping *mapping = pack_mappings.getptr(p_pkg_path);
+	return mapping ? *mapping : PackMapping();
+}
+
 void PackedData::clear() {
 	files.clear();
+	pack_mappings.clear();
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
 }
@@ -192,6 +209,10 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	if (f.is_null()) {
 		return false;
 	}
+	// The directory is read with many small reads, avoid a system call for each of them.
+	// The mapping is then kept for the files read from this pack.
+	const bool mapped = f->map_to_memory() == OK;
+	Ref<FileAccess> pack_file = f;
 
 	bool pck_header_found = false;
 
@@ -320,6 +341,10 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		}
 	}
 
+	if (mapped) {
+		PackedData::get_singleton()->add_pack_mapping(p_path, pack_file);
+	}
+
 	return true;
 }
 
@@ -373,7 +398,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapping.file.is_valid()) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -381,7 +408,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && mapping.file.is_null(), "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -389,7 +416,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (f.is_valid()) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -410,7 +439,7 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && mapping.file.is_null(), -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -423,21 +452,44 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
-	pos += to_read;
-
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+
+	if (mapping.file.is_valid()) {
+		memcpy(p_dst, mapping.data.ptr() + pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
+	pos += to_read;
 
 	return to_read;
 }
 
+Error FileAccessPack::map_to_memory() {
+	ERR_FAIL_COND_V_MSG(f.is_null() && mapping.file.is_null(), ERR_FILE_CANT_OPEN, "File must be opened before use.");
+
+	// Only the mapping of the whole pack made when it was loaded is used, so opening a packed file never maps it again.
+	return mapping.file.is_valid() ? OK : ERR_UNAVAILABLE;
+}
+
+Span<uint8_t> FileAccessPack::get_mapped_span(uint64_t p_length) const {
+	if (mapping.file.is_null() || eof || pos > pf.size || p_length > pf.size - pos) {
+		return Span<uint8_t>();
+	}
+
+	Span<uint8_t> span(mapping.data.ptr() + pos, p_length);
+	pos += p_length;
+	return span;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && mapping.file.is_null(), "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -461,15 +513,30 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapping = PackedData::PackMapping();
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+		pf(p_file) {
+	pos = 0;
+	eof = false;
+	off = pf.offset;
+
+	if (!pf.encrypted) {
+		// Read from the mapping of the pack if there is one and the file lies inside of it.
+		PackedData::PackMapping pack_mapping = PackedData::get_singleton()->get_pack_mapping(pf.pack);
+		const uint64_t mapped_length = pack_mapping.data.size();
+		if (pack_mapping.file.is_valid() && pf.offset <= mapped_length && pf.size <= mapped_length - pf.offset) {
+			mapping.file = pack_mapping.file;
+			mapping.data = Span<uint8_t>(pack_mapping.data.ptr() + pf.offset, pf.size);
+			return;
+		}
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), vformat("Can't open pack-referenced file '%s'.", String(pf.pack)));
 
 	f->seek(pf.offset);
-	off = pf.offset;
 
 	if (pf.encrypted) {
 		Ref<FileAccessEncrypted> fae;
@@ -487,8 +554,6 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
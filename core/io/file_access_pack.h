@@ -68,6 +68,12 @@ public:
 		bool encrypted;
 	};
 
+	// Read-only mapping of a whole pack, shared by the packed files opened from it.
+	struct PackMapping {
+		Ref<FileAccess> file; // Keeps the mapping alive.
+		Span<uint8_t> data;
+	};
+
 private:
 	struct PackedDir {
 		PackedDir *parent = nullptr;
@@ -97,6 +103,7 @@ private:
 	};
 
 	HashMap<PathMD5, PackedFile, PathMD5> files;
+	HashMap<String, PackMapping> pack_mappings;
 
 	Vector<PackSource *> sources;
 
@@ -112,6 +119,8 @@ public:
 	void add_pack_source(PackSource *p_source);
 	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
 	void remove_path(const String &p_path);
+	void add_pack_mapping(const String &p_pkg_path, const Ref<FileAccess> &p_file); // for PackSource
+	PackMapping get_pack_mapping(const String &p_pkg_path) const;
 	uint8_t *get_file_hash(const String &p_path);
 	HashSet<String> get_file_paths() const;
 
@@ -164,6 +173,7 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+	PackedData::PackMapping mapping; // Reads come from `mapping.data` instead of `f` when set.
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual uint64_t _get_access_time(const String &p_file) override { return 0; }
@@ -188,6 +198,9 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
 
+	virtual Error map_to_memory() override;
+	virtual Span<uint8_t> get_mapped_span(uint64_t p_length) const override;
+
 	virtual void set_big_endian(bool p_big_endian) override;
 
 	virtual Error get_error() const override;
@@ -35,11 +35,18 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/dictionary.h"
 
 #include <cmath>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMAGE_SSE2
+#include <emmintrin.h>
+#endif
+
 const char *Image::format_names[Image::FORMAT_MAX] = {
 	"Lum8",
 	"LumAlpha8",
@@ -139,6 +146,13 @@ Ref<Image> (*Image::png_unpacker)(const Vector<uint8_t> &) = nullptr;
 Ref<Image> (*Image::basis_universal_unpacker)(const Vector<uint8_t> &) = nullptr;
 Ref<Image> (*Image::basis_universal_unpacker_ptr)(const uint8_t *, int) = nullptr;
 
+// Threaded and SIMD processing of large images, see Image::_set_accelerated_processing().
+static bool accelerated_processing = true;
+
+void Image::_set_accelerated_processing(bool p_enabled) {
+	accelerated_processing = p_enabled;
+}
+
 void Image::_put_pixelb(int p_x, int p_y, uint32_t p_pixel_size, uint8_t *p_data, const uint8_t *p_pixel) {
 	uint32_t ofs = (p_y * width + p_x) * p_pixel_size;
 	memcpy(p_data + ofs, p_pixel, p_pixel_size);
@@ -495,67 +509,94 @@ int Image::get_mipmap_count() const {
 	}
 }
 
+template <typename F>
+static void _process_rows_range(void *p_userdata, uint32_t p_from, uint32_t p_to) {
+	(*(const F *)p_userdata)(p_from, p_to);
+}
+
+// Runs p_func(from, to) over the rows of an image, split across the WorkerThreadPool when the image is
+// large enough to be worth it. p_row_samples estimates the work per row. Every row is computed
+// independently, so the result is the same regardless of how rows are split.
+template <typename F>
+static void _process_rows(uint32_t p_rows, uint64_t p_row_samples, const F &p_func) {
+	constexpr uint64_t MIN_CHUNK_SAMPLES = 32768;
+
+	const uint32_t min_chunk = MAX(MIN_CHUNK_SAMPLES / MAX(p_row_samples, (uint64_t)1), (uint64_t)1);
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	if (p_rows <= min_chunk || wtp == nullptr || wtp->get_thread_count() <= 1 || !accelerated_processing) {
+		p_func(0, p_rows);
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = wtp->add_native_group_range_task(&_process_rows_range<F>, (void *)&p_func, p_rows, -1, min_chunk, true, SNAME("ImageProcessRows"));
+	wtp->wait_for_group_task_completion(group_task);
+}
+
 // Using template generates perfectly optimized code due to constant expression reduction and unused variable removal present in all compilers.
 template <uint32_t read_bytes, bool read_alpha, uint32_t write_bytes, bool write_alpha, bool read_gray, bool write_gray>
 static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
 	constexpr uint32_t max_bytes = MAX(read_bytes, write_bytes);
 
-	for (int y = 0; y < p_height; y++) {
-		for (int x = 0; x < p_width; x++) {
-			const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
-			uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
+	_process_rows(p_height, p_width, [&](uint32_t p_from, uint32_t p_to) {
+		for (int y = p_from; y < (int)p_to; y++) {
+			for (int x = 0; x < p_width; x++) {
+				const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
+				uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
 
-			uint8_t rgba[4] = { 0, 0, 0, 255 };
+				uint8_t rgba[4] = { 0, 0, 0, 255 };
 
-			if constexpr (read_gray) {
-				rgba[0] = rofs[0];
-				rgba[1] = rofs[0];
-				rgba[2] = rofs[0];
-			} else {
-				for (uint32_t i = 0; i < max_bytes; i++) {
-					rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+				if constexpr (read_gray) {
+					rgba[0] = rofs[0];
+					rgba[1] = rofs[0];
+					rgba[2] = rofs[0];
+				} else {
+					for (uint32_t i = 0; i < max_bytes; i++) {
+						rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+					}
 				}
-			}
 
-			if constexpr (read_alpha || write_alpha) {
-				rgba[3] = read_alpha ? rofs[read_bytes] : 255;
-			}
+				if constexpr (read_alpha || write_alpha) {
+					rgba[3] = read_alpha ? rofs[read_bytes] : 255;
+				}
 
-			if constexpr (write_gray) {
-				// REC.709
-				const uint8_t luminance = (13938U * rgba[0] + 46869U * rgba[1] + 4729U * rgba[2] + 32768U) >> 16U;
-				wofs[0] = luminance;
-			} else {
-				for (uint32_t i = 0; i < write_bytes; i++) {
-					wofs[i] = rgba[i];
+				if constexpr (write_gray) {
+					// REC.709
+					const uint8_t luminance = (13938U * rgba[0] + 46869U * rgba[1] + 4729U * rgba[2] + 32768U) >> 16U;
+					wofs[0] = luminance;
+				} else {
+					for (uint32_t i = 0; i < write_bytes; i++) {
+						wofs[i] = rgba[i];
+					}
 				}
-			}
 
-			if constexpr (write_alpha) {
-				wofs[write_bytes] = rgba[3];
+				if constexpr (write_alpha) {
+					wofs[write_bytes] = rgba[3];
+				}
 			}
 		}
-	}
+	});
 }
 
 template <typename T, uint32_t read_channels, uint32_t write_channels, T def_zero, T def_one>
 static void _convert_fast(int p_width, int p_height, const T *p_src, T *p_dst) {
-	uint32_t dst_count = 0;
-	uint32_t src_count = 0;
+	_process_rows(p_height, p_width * write_channels, [&](uint32_t p_from, uint32_t p_to) {
+		uint64_t dst_count = uint64_t(p_from) * p_width * write_channels;
+		uint64_t src_count = uint64_t(p_from) * p_width * read_channels;
 
-	const int resolution = p_width * p_height;
+		const uint64_t resolution = uint64_t(p_to - p_from) * p_width;
 
-	for (int i = 0; i < resolution; i++) {
-		memcpy(p_dst + dst_count, p_src + src_count, MIN(read_channels, write_channels) * sizeof(T));
+		for (uint64_t i = 0; i < resolution; i++) {
+			memcpy(p_dst + dst_count, p_src + src_count, MIN(read_channels, write_channels) * sizeof(T));
 
-		if constexpr (write_channels > read_channels) {
-			const T def_value[4] = { def_zero, def_zero, def_zero, def_one };
-			memcpy(p_dst + dst_count + read_channels, &def_value[read_channels], (write_channels - read_channels) * sizeof(T));
-		}
+			if constexpr (write_channels > read_channels) {
+				const T def_value[4] = { def_zero, def_zero, def_zero, def_one };
+				memcpy(p_dst + dst_count + read_channels, &def_value[read_channels], (write_channels - read_channels) * sizeof(T));
+			}
 
-		dst_count += write_channels;
-		src_count += read_channels;
-	}
+			dst_count += write_channels;
+			src_count += read_channels;
+		}
+	});
 }
 
 static bool _are_formats_compatible(Image::Format p_format0, Image::Format p_format1) {
@@ -584,24 +625,28 @@ void Image::convert(Format p_new_format) {
 	const int mipmap_count = get_mipmap_count() + 1;
 
 	if (!_are_formats_compatible(format, p_new_format)) {
-		// Use put/set pixel which is slower but works with non-byte formats.
+		// Go through Color per pixel, which is slower but works with non-byte formats.
 		Image new_img(width, height, mipmaps, p_new_format);
 
-		for (int mip = 0; mip < mipmap_count; mip++) {
-			Ref<Image> src_mip = get_image_from_mipmap(mip);
-			Ref<Image> new_mip = new_img.get_image_from_mipmap(mip);
+		const uint8_t *src_data = data.ptr();
+		uint8_t *dst_data = new_img.data.ptrw();
 
-			for (int y = 0; y < src_mip->height; y++) {
-				for (int x = 0; x < src_mip->width; x++) {
-					new_mip->set_pixel(x, y, src_mip->get_pixel(x, y));
+		for (int mip = 0; mip < mipmap_count; mip++) {
+			int64_t src_offset = 0;
+			int64_t dst_offset = 0;
+			int mip_width = 0;
+			int mip_height = 0;
+			_get_mipmap_offset_and_size(mip, src_offset, mip_width, mip_height);
+			new_img._get_mipmap_offset_and_size(mip, dst_offset, mip_width, mip_height);
+
+			const uint8_t *src_mip = src_data + src_offset;
+			uint8_t *dst_mip = dst_data + dst_offset;
+
+			_process_rows(mip_height, mip_width * 4, [&](uint32_t p_from, uint32_t p_to) {
+				for (uint32_t ofs = p_from * mip_width; ofs < p_to * mip_width; ofs++) {
+					new_img._set_color_at_ofs(dst_mip, ofs, _get_color_at_ofs(src_mip, ofs));
 				}
-			}
-
-			int64_t mip_offset = 0;
-			int64_t mip_size = 0;
-			new_img.get_mipmap_offset_and_size(mip, mip_offset, mip_size);
-
-			memcpy(new_img.data.ptrw() + mip_offset, new_mip->data.ptr(), mip_size);
+			});
 		}
 
 		_copy_internals_from(new_img);
@@ -818,84 +863,81 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int height = p_src_height;
 	double xfac = (double)width / p_dst_width;
 	double yfac = (double)height / p_dst_height;
-	// coordinates of source points and coefficients
-	double ox, oy, dx, dy;
-	int ox1, oy1, ox2, oy2;
-	// destination pixel values
 	// width and height decreased by 1
 	int ymax = height - 1;
 	int xmax = width - 1;
-	// temporary pointer
-
-	for (uint32_t y = 0; y < p_dst_height; y++) {
-		// Y coordinates
-		oy = (double)y * yfac - 0.5f;
-		oy1 = (int)oy;
-		dy = oy - (double)oy1;
-
-		for (uint32_t x = 0; x < p_dst_width; x++) {
-			// X coordinates
-			ox = (double)x * xfac - 0.5f;
-			ox1 = (int)ox;
-			dx = ox - (double)ox1;
 
-			// initial pixel value
+	_process_rows(p_dst_height, p_dst_width * CC * 16, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t y = p_from; y < p_to; y++) {
+			// Y coordinates
+			double oy = (double)y * yfac - 0.5f;
+			int oy1 = (int)oy;
+			double dy = oy - (double)oy1;
 
-			T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
+			for (uint32_t x = 0; x < p_dst_width; x++) {
+				// X coordinates
+				double ox = (double)x * xfac - 0.5f;
+				int ox1 = (int)ox;
+				double dx = ox - (double)ox1;
 
-			double color[CC];
-			for (int i = 0; i < CC; i++) {
-				color[i] = 0;
-			}
+				// initial pixel value
 
-			for (int n = -1; n < 3; n++) {
-				// get Y coefficient
-				[[maybe_unused]] double k1 = _bicubic_interp_kernel(dy - (double)n);
+				T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
 
-				oy2 = oy1 + n;
-				if (oy2 < 0) {
-					oy2 = 0;
-				}
-				if (oy2 > ymax) {
-					oy2 = ymax;
+				double color[CC];
+				for (int i = 0; i < CC; i++) {
+					color[i] = 0;
 				}
 
-				for (int m = -1; m < 3; m++) {
-					// get X coefficient
-					[[maybe_unused]] double k2 = k1 * _bicubic_interp_kernel((double)m - dx);
+				for (int n = -1; n < 3; n++) {
+					// get Y coefficient
+					[[maybe_unused]] double k1 = _bicubic_interp_kernel(dy - (double)n);
 
-					ox2 = ox1 + m;
-					if (ox2 < 0) {
-						ox2 = 0;
+					int oy2 = oy1 + n;
+					if (oy2 < 0) {
+						oy2 = 0;
 					}
-					if (ox2 > xmax) {
-						ox2 = xmax;
+					if (oy2 > ymax) {
+						oy2 = ymax;
 					}
 
-					// get pixel of original image
-					const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+					for (int m = -1; m < 3; m++) {
+						// get X coefficient
+						[[maybe_unused]] double k2 = k1 * _bicubic_interp_kernel((double)m - dx);
 
-					for (int i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2) { //half float
-							color[i] = Math::half_to_float(p[i]);
-						} else {
-							color[i] += p[i] * k2;
+						int ox2 = ox1 + m;
+						if (ox2 < 0) {
+							ox2 = 0;
+						}
+						if (ox2 > xmax) {
+							ox2 = xmax;
+						}
+
+						// get pixel of original image
+						const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+
+						for (int i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2) { //half float
+								color[i] = Math::half_to_float(p[i]);
+							} else {
+								color[i] += p[i] * k2;
+							}
 						}
 					}
 				}
-			}
 
-			for (int i = 0; i < CC; i++) {
-				if constexpr (sizeof(T) == 1) { //byte
-					dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
-				} else if constexpr (sizeof(T) == 2) { //half float
-					dst[i] = Math::make_half_float(color[i]);
-				} else {
-					dst[i] = color[i];
+				for (int i = 0; i < CC; i++) {
+					if constexpr (sizeof(T) == 1) { //byte
+						dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
+					} else if constexpr (sizeof(T) == 2) { //half float
+						dst[i] = Math::make_half_float(color[i]);
+					} else {
+						dst[i] = color[i];
+					}
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T>
@@ -905,106 +947,124 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 	constexpr uint32_t FRAC_HALF = (FRAC_LEN >> 1);
 	constexpr uint32_t FRAC_MASK = FRAC_LEN - 1;
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
-		// Add 0.5 in order to interpolate based on pixel center
-		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
-		// Calculate nearest src pixel center above current, and truncate to get y index
-		uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
-		uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
-		if (src_yofs_down >= p_src_height) {
-			src_yofs_down = p_src_height - 1;
+	// Horizontal taps are the same for every row, compute them once.
+	LocalVector<uint32_t> xofs_left;
+	LocalVector<uint32_t> xofs_right;
+	LocalVector<uint32_t> xofs_frac;
+	xofs_left.resize(p_dst_width);
+	xofs_right.resize(p_dst_width);
+	xofs_frac.resize(p_dst_width);
+	for (uint32_t j = 0; j < p_dst_width; j++) {
+		uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
+		uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
+		uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
+		if (src_xofs_right >= p_src_width) {
+			src_xofs_right = p_src_width - 1;
 		}
-		// Calculate distance to pixel center of src_yofs_up
-		uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
-		src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
-
-		uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
-		uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
-
-		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
-			uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
-			uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
-			if (src_xofs_right >= p_src_width) {
-				src_xofs_right = p_src_width - 1;
+		uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
+		src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
+
+		xofs_left[j] = src_xofs_left * CC;
+		xofs_right[j] = src_xofs_right * CC;
+		xofs_frac[j] = src_xofs_frac;
+	}
+
+	_process_rows(p_dst_height, p_dst_width * CC * 4, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			// Add 0.5 in order to interpolate based on pixel center
+			uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
+			// Calculate nearest src pixel center above current, and truncate to get y index
+			uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
+			uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
+			if (src_yofs_down >= p_src_height) {
+				src_yofs_down = p_src_height - 1;
 			}
-			uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
-			src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
-
-			src_xofs_left *= CC;
-			src_xofs_right *= CC;
-
-			for (uint32_t l = 0; l < CC; l++) {
-				if constexpr (sizeof(T) == 1) { //uint8
-					uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
-					uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
-
-					uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
-					interp >>= FRAC_BITS;
-					p_dst[i * p_dst_width * CC + j * CC + l] = uint8_t(interp);
-				} else if constexpr (sizeof(T) == 2) { //half float
-
-					float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-					float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-					const T *src = ((const T *)p_src);
-					T *dst = ((T *)p_dst);
+			// Calculate distance to pixel center of src_yofs_up
+			uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
+			src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
+
+			uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
+			uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
+
+			for (uint32_t j = 0; j < p_dst_width; j++) {
+				const uint32_t src_xofs_left = xofs_left[j];
+				const uint32_t src_xofs_right = xofs_right[j];
+				const uint32_t src_xofs_frac = xofs_frac[j];
+
+				for (uint32_t l = 0; l < CC; l++) {
+					if constexpr (sizeof(T) == 1) { //uint8
+						uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
+						uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
+
+						uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
+						interp >>= FRAC_BITS;
+						p_dst[i * p_dst_width * CC + j * CC + l] = uint8_t(interp);
+					} else if constexpr (sizeof(T) == 2) { //half float
 
-					float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
-					float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
-					float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
-					float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
+						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+						const T *src = ((const T *)p_src);
+						T *dst = ((T *)p_dst);
 
-					float interp_up = p00 + (p10 - p00) * xofs_frac;
-					float interp_down = p01 + (p11 - p01) * xofs_frac;
-					float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+						float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
+						float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
+						float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
+						float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
 
-					dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
-				} else if constexpr (sizeof(T) == 4) { //float
+						float interp_up = p00 + (p10 - p00) * xofs_frac;
+						float interp_down = p01 + (p11 - p01) * xofs_frac;
+						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
 
-					float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-					float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-					const T *src = ((const T *)p_src);
-					T *dst = ((T *)p_dst);
+						dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
+					} else if constexpr (sizeof(T) == 4) { //float
+
+						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+						const T *src = ((const T *)p_src);
+						T *dst = ((T *)p_dst);
 
-					float p00 = src[y_ofs_up + src_xofs_left + l];
-					float p10 = src[y_ofs_up + src_xofs_right + l];
-					float p01 = src[y_ofs_down + src_xofs_left + l];
-					float p11 = src[y_ofs_down + src_xofs_right + l];
+						float p00 = src[y_ofs_up + src_xofs_left + l];
+						float p10 = src[y_ofs_up + src_xofs_right + l];
+						float p01 = src[y_ofs_down + src_xofs_left + l];
+						float p11 = src[y_ofs_down + src_xofs_right + l];
 
-					float interp_up = p00 + (p10 - p00) * xofs_frac;
-					float interp_down = p01 + (p11 - p01) * xofs_frac;
-					float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+						float interp_up = p00 + (p10 - p00) * xofs_frac;
+						float interp_down = p01 + (p11 - p01) * xofs_frac;
+						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
 
-					dst[i * p_dst_width * CC + j * CC + l] = interp;
+						dst[i * p_dst_width * CC + j * CC + l] = interp;
+					}
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T>
 static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
-		uint32_t src_yofs = i * p_src_height / p_dst_height;
-		uint32_t y_ofs = src_yofs * p_src_width * CC;
+	_process_rows(p_dst_height, p_dst_width * CC, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			uint32_t src_yofs = i * p_src_height / p_dst_height;
+			uint32_t y_ofs = src_yofs * p_src_width * CC;
 
-		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs = j * p_src_width / p_dst_width;
-			src_xofs *= CC;
+			for (uint32_t j = 0; j < p_dst_width; j++) {
+				uint32_t src_xofs = j * p_src_width / p_dst_width;
+				src_xofs *= CC;
 
-			for (uint32_t l = 0; l < CC; l++) {
-				const T *src = ((const T *)p_src);
-				T *dst = ((T *)p_dst);
+				for (uint32_t l = 0; l < CC; l++) {
+					const T *src = ((const T *)p_src);
+					T *dst = ((T *)p_dst);
 
-				T p = src[y_ofs + src_xofs + l];
-				dst[i * p_dst_width * CC + j * CC + l] = p;
+					T p = src[y_ofs + src_xofs + l];
+					dst[i * p_dst_width * CC + j * CC + l] = p;
+				}
 			}
 		}
-	}
+	});
 }
 
 #define LANCZOS_TYPE 3
@@ -1029,48 +1089,63 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 
 		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
+		int32_t kernel_size = half_kernel * 2;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		// The kernel of each column is the same for all rows, so build them all up front.
+		LocalVector<int32_t> column_start;
+		LocalVector<int32_t> column_end;
+		LocalVector<float> kernels;
+		column_start.resize(dst_width);
+		column_end.resize(dst_width);
+		kernels.resize(dst_width * kernel_size);
 
 		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
 			// The corresponding point on the source image
 			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
 			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
 			int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+			column_start[buffer_x] = start_x;
+			column_end[buffer_x] = end_x;
 
-			// Create the kernel used by all the pixels of the column
+			float *kernel = &kernels[buffer_x * kernel_size];
 			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
 				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
 			}
+		}
 
-			for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+		_process_rows(src_height, dst_width * CC * kernel_size, [&](uint32_t p_from, uint32_t p_to) {
+			for (int32_t buffer_y = p_from; buffer_y < (int32_t)p_to; buffer_y++) {
+				for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
+					const int32_t start_x = column_start[buffer_x];
+					const int32_t end_x = column_end[buffer_x];
+					const float *kernel = &kernels[buffer_x * kernel_size];
 
-				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-					float lanczos_val = kernel[target_x - start_x];
-					weight += lanczos_val;
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-					const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+					for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+						float lanczos_val = kernel[target_x - start_x];
+						weight += lanczos_val;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2) { //half float
-							pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
-						} else {
-							pixel[i] += src_data[i] * lanczos_val;
+						const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+
+						for (uint32_t i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2) { //half float
+								pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
+							} else {
+								pixel[i] += src_data[i] * lanczos_val;
+							}
 						}
 					}
-				}
 
-				float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
+					float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					for (uint32_t i = 0; i < CC; i++) {
+						dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					}
 				}
 			}
-		}
-
-		memdelete_arr(kernel);
+		});
 	} // End of first pass
 
 	{ // SECOND PASS (vertical + result)
@@ -1080,49 +1155,51 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(y_scale, 1);
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		_process_rows(dst_height, dst_width * CC * half_kernel * 2, [&](uint32_t p_from, uint32_t p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
-			float buffer_y = (dst_y + 0.5f) * y_scale;
-			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
-			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
+			for (int32_t dst_y = p_from; dst_y < (int32_t)p_to; dst_y++) {
+				float buffer_y = (dst_y + 0.5f) * y_scale;
+				int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
+				int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
 
-			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-				kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
-			}
+				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+					kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
+				}
 
-			for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-					float lanczos_val = kernel[target_y - start_y];
-					weight += lanczos_val;
+					for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+						float lanczos_val = kernel[target_y - start_y];
+						weight += lanczos_val;
 
-					float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
+						float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						pixel[i] += buffer_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							pixel[i] += buffer_data[i] * lanczos_val;
+						}
 					}
-				}
 
-				T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
+					T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					pixel[i] /= weight;
-
-					if constexpr (sizeof(T) == 1) { //byte
-						dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
-					} else if constexpr (sizeof(T) == 2) { //half float
-						dst_data[i] = Math::make_half_float(pixel[i]);
-					} else { // float
-						dst_data[i] = pixel[i];
+					for (uint32_t i = 0; i < CC; i++) {
+						pixel[i] /= weight;
+
+						if constexpr (sizeof(T) == 1) { //byte
+							dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
+						} else if constexpr (sizeof(T) == 2) { //half float
+							dst_data[i] = Math::make_half_float(pixel[i]);
+						} else { // float
+							dst_data[i] = pixel[i];
+						}
 					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of second pass
 
 	memdelete_arr(buffer);
@@ -1131,9 +1208,12 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 static void _overlay(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, float p_alpha, uint32_t p_width, uint32_t p_height, uint32_t p_pixel_size) {
 	uint16_t alpha = MIN((uint16_t)(p_alpha * 256.0f), 256);
 
-	for (uint32_t i = 0; i < p_width * p_height * p_pixel_size; i++) {
-		p_dst[i] = (p_dst[i] * (256 - alpha) + p_src[i] * alpha) >> 8;
-	}
+	const uint32_t row_size = p_width * p_pixel_size;
+	_process_rows(p_height, row_size, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from * row_size; i < p_to * row_size; i++) {
+			p_dst[i] = (p_dst[i] * (256 - alpha) + p_src[i] * alpha) >> 8;
+		}
+	});
 }
 
 bool Image::is_size_po2() const {
@@ -1790,6 +1870,41 @@ int64_t Image::_get_dst_image_size(int p_width, int p_height, Format p_format, i
 	return size;
 }
 
+#ifdef IMAGE_SSE2
+// Averages 2x2 blocks of RGBA8 pixels, two destination pixels per iteration. Returns how many were written.
+static uint32_t _average_row_rgba8_sse2(const uint8_t *p_up, const uint8_t *p_down, uint8_t *p_dst, uint32_t p_count) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i round = _mm_set1_epi16(2);
+	uint32_t i = 0;
+	for (; i + 2 <= p_count; i += 2) {
+		const __m128i up = _mm_loadu_si128((const __m128i *)(p_up + i * 8));
+		const __m128i down = _mm_loadu_si128((const __m128i *)(p_down + i * 8));
+		// Vertical sums of source pixels 0-1 and 2-3, widened to 16 bits.
+		const __m128i sum01 = _mm_add_epi16(_mm_unpacklo_epi8(up, zero), _mm_unpacklo_epi8(down, zero));
+		const __m128i sum23 = _mm_add_epi16(_mm_unpackhi_epi8(up, zero), _mm_unpackhi_epi8(down, zero));
+		// Horizontal sums: pixel 0 + pixel 1 and pixel 2 + pixel 3.
+		const __m128i h01 = _mm_add_epi16(sum01, _mm_srli_si128(sum01, 8));
+		const __m128i h23 = _mm_add_epi16(sum23, _mm_srli_si128(sum23, 8));
+		const __m128i avg = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(h01, h23), round), 2);
+		_mm_storel_epi64((__m128i *)(p_dst + i * 4), _mm_packus_epi16(avg, avg));
+	}
+	return i;
+}
+
+// Averages 2x2 blocks of RGBAF pixels. Additions happen in the same order as Image::average_4_float().
+static uint32_t _average_row_rgbaf_sse2(const float *p_up, const float *p_down, float *p_dst, uint32_t p_count) {
+	const __m128 quarter = _mm_set1_ps(0.25f);
+	for (uint32_t i = 0; i < p_count; i++) {
+		const __m128 a = _mm_loadu_ps(p_up + i * 8);
+		const __m128 b = _mm_loadu_ps(p_up + i * 8 + 4);
+		const __m128 c = _mm_loadu_ps(p_down + i * 8);
+		const __m128 d = _mm_loadu_ps(p_down + i * 8 + 4);
+		_mm_storeu_ps(p_dst + i * 4, _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(a, b), c), d), quarter));
+	}
+	return p_count;
+}
+#endif
+
 template <typename Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
@@ -1801,27 +1916,46 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
-		const Component *rup_ptr = &p_src[i * 2 * down_step];
-		const Component *rdown_ptr = rup_ptr + down_step;
-		Component *dst_ptr = &p_dst[i * dst_w * CC];
-		uint32_t count = dst_w;
-
-		while (count) {
-			count--;
-			for (int j = 0; j < CC; j++) {
-				average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
+	_process_rows(dst_h, dst_w * CC, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			const Component *rup_ptr = &p_src[i * 2 * down_step];
+			const Component *rdown_ptr = rup_ptr + down_step;
+			Component *dst_ptr = &p_dst[i * dst_w * CC];
+			uint32_t count = dst_w;
+
+#ifdef IMAGE_SSE2
+			if constexpr (CC == 4 && !renormalize) {
+				if (right_step != 0 && accelerated_processing) {
+					uint32_t done = 0;
+					if constexpr (std::is_same_v<Component, uint8_t>) {
+						done = _average_row_rgba8_sse2(rup_ptr, rdown_ptr, dst_ptr, count);
+					} else if constexpr (std::is_same_v<Component, float>) {
+						done = _average_row_rgbaf_sse2(rup_ptr, rdown_ptr, dst_ptr, count);
+					}
+					count -= done;
+					dst_ptr += done * CC;
+					rup_ptr += done * CC * 2;
+					rdown_ptr += done * CC * 2;
+				}
 			}
+#endif
 
-			if (renormalize) {
-				renormalize_func(dst_ptr);
-			}
+			while (count) {
+				count--;
+				for (int j = 0; j < CC; j++) {
+					average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
+				}
+
+				if (renormalize) {
+					renormalize_func(dst_ptr);
+				}
 
-			dst_ptr += CC;
-			rup_ptr += right_step * 2;
-			rdown_ptr += right_step * 2;
+				dst_ptr += CC;
+				rup_ptr += right_step * 2;
+				rdown_ptr += right_step * 2;
+			}
 		}
-	}
+	});
 }
 
 void Image::_generate_mipmap_from_format(Image::Format p_format, const uint8_t *p_src, uint8_t *p_dst, uint32_t p_width, uint32_t p_height, bool p_renormalize) {
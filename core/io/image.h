@@ -64,6 +64,8 @@ typedef Vector<uint8_t> (*SaveDDSBufferFunc)(const Ref<Image> &p_img);
 class Image : public Resource {
 	GDCLASS(Image, Resource);
 
+	friend class TestImageInternalsAccessor;
+
 public:
 	enum {
 		MAX_WIDTH = (1 << 24), // Force a limit somehow.
@@ -280,6 +282,9 @@ private:
 	static void renormalize_half(uint16_t *p_rgb);
 	static void renormalize_rgbe9995(uint32_t *p_rgb);
 
+	// Only turned off by tests, to compare threaded and SIMD processing against the plain kernels.
+	static void _set_accelerated_processing(bool p_enabled);
+
 public:
 	int get_width() const;
 	int get_height() const;
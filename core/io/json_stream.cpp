@@ -0,0 +1,991 @@
+/**************************************************************************/
+/*  json_stream.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "json_stream.h"
+
+#include "core/object/class_db.h"
+#include "core/variant/variant.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define JSON_STREAM_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+#ifdef JSON_STREAM_SSE2
+static _FORCE_INLINE_ uint32_t _lowest_bit_index(uint32_t p_mask) {
+#if defined(__GNUC__)
+	return __builtin_ctz(p_mask);
+#else
+	unsigned long index;
+	_BitScanForward(&index, p_mask);
+	return index;
+#endif
+}
+#endif
+
+// Returns the index of the first byte in [p_from, p_to) that ends a run of plain string
+// characters, a quote, a backslash or a line break. Checks 16 bytes at a time when possible.
+static uint32_t _find_string_special(const uint8_t *p_data, uint32_t p_from, uint32_t p_to) {
+	uint32_t i = p_from;
+#ifdef JSON_STREAM_SSE2
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+	const __m128i newline = _mm_set1_epi8('\n');
+	for (; i + 16 <= p_to; i += 16) {
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_data + i));
+		const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, quote), _mm_cmpeq_epi8(bytes, backslash)), _mm_cmpeq_epi8(bytes, newline));
+		const uint32_t mask = uint32_t(_mm_movemask_epi8(special));
+		if (mask != 0) {
+			return i + _lowest_bit_index(mask);
+		}
+	}
+#endif
+	for (; i < p_to; i++) {
+		const uint8_t c = p_data[i];
+		if (c == '"' || c == '\\' || c == '\n') {
+			return i;
+		}
+	}
+	return p_to;
+}
+
+template <typename T>
+static void _encode_utf8(LocalVector<T> &r_buffer, uint32_t p_char) {
+	if (p_char > 0x10ffff || (p_char & 0xfffff800) == 0xd800) {
+		p_char = 0xfffd; // Replacement character.
+	}
+	if (p_char < 0x80) {
+		r_buffer.push_back(T(p_char));
+	} else if (p_char < 0x800) {
+		r_buffer.push_back(T(0xc0 | (p_char >> 6)));
+		r_buffer.push_back(T(0x80 | (p_char & 0x3f)));
+	} else if (p_char < 0x10000) {
+		r_buffer.push_back(T(0xe0 | (p_char >> 12)));
+		r_buffer.push_back(T(0x80 | ((p_char >> 6) & 0x3f)));
+		r_buffer.push_back(T(0x80 | (p_char & 0x3f)));
+	} else {
+		r_buffer.push_back(T(0xf0 | (p_char >> 18)));
+		r_buffer.push_back(T(0x80 | ((p_char >> 12) & 0x3f)));
+		r_buffer.push_back(T(0x80 | ((p_char >> 6) & 0x3f)));
+		r_buffer.push_back(T(0x80 | (p_char & 0x3f)));
+	}
+}
+
+/* JSONReader */
+
+bool JSONReader::_fill() {
+	if (file.is_null() || file->eof_reached()) {
+		return false;
+	}
+	chunk.resize(CHUNK_SIZE);
+	const uint64_t read = file->get_buffer(chunk.ptr(), CHUNK_SIZE);
+	data = chunk.ptr();
+	data_size = read;
+	position = 0;
+	return read > 0;
+}
+
+void JSONReader::_reset() {
+	containers.clear();
+	state = STATE_ROOT;
+	token = TOKEN_NONE;
+	text.clear();
+	number = 0.0;
+	boolean = false;
+	err_str = String();
+	err_line = 0;
+	line = 0;
+
+	// Skip the UTF-8 BOM, if any.
+	if (data_size - position >= 3 && data[position] == 0xef && data[position + 1] == 0xbb && data[position + 2] == 0xbf) {
+		position += 3;
+	}
+}
+
+int JSONReader::_skip_whitespace() {
+	while (true) {
+		const int c = _peek();
+		if (c == -1 || c > 32) {
+			return c;
+		}
+		if (c == '\n') {
+			line++;
+		}
+		position++;
+	}
+}
+
+JSONReader::Token JSONReader::_error(const String &p_message) {
+	err_str = p_message;
+	err_line = line;
+	token = TOKEN_ERROR;
+	return token;
+}
+
+bool JSONReader::_read_hex(uint32_t &r_value) {
+	r_value = 0;
+	for (int i = 0; i < 4; i++) {
+		const int c = _next();
+		if (c == -1) {
+			_error("Unterminated string");
+			return false;
+		}
+		if (!is_hex_digit(c)) {
+			_error("Malformed hex constant in string");
+			return false;
+		}
+		uint32_t v;
+		if (is_digit(c)) {
+			v = c - '0';
+		} else if (c >= 'a' && c <= 'f') {
+			v = c - 'a' + 10;
+		} else {
+			v = c - 'A' + 10;
+		}
+		r_value = (r_value << 4) | v;
+	}
+	return true;
+}
+
+void JSONReader::_append_utf8(uint32_t p_char) {
+	_encode_utf8(text, p_char);
+}
+
+bool JSONReader::_read_string() {
+	text.clear();
+	while (true) {
+		if (position == data_size && !_fill()) {
+			_error("Unterminated string");
+			return false;
+		}
+
+		// Copy plain runs in one go, only quotes, escapes and line breaks need a closer look.
+		const uint32_t run_end = _find_string_special(data, position, data_size);
+		if (run_end > position) {
+			const uint32_t size = text.size();
+			text.resize(size + run_end - position);
+			memcpy(text.ptr() + size, data + position, run_end - position);
+			position = run_end;
+		}
+		if (position == data_size) {
+			continue;
+		}
+
+		const uint8_t c = data[position++];
+		if (c == '"') {
+			return true;
+		}
+		if (c == '\n') {
+			line++;
+			text.push_back('\n');
+			continue;
+		}
+
+		const int next = _next();
+		switch (next) {
+			case -1: {
+				_error("Unterminated string");
+				return false;
+			}
+			case 'b': {
+				text.push_back(8);
+			} break;
+			case 't': {
+				text.push_back(9);
+			} break;
+			case 'n': {
+				text.push_back(10);
+			} break;
+			case 'f': {
+				text.push_back(12);
+			} break;
+			case 'r': {
+				text.push_back(13);
+			} break;
+			case 'u': {
+				uint32_t res = 0;
+				if (!_read_hex(res)) {
+					return false;
+				}
+				if ((res & 0xfffffc00) == 0xd800) {
+					if (_next() != '\\' || _next() != 'u') {
+						_error("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+						return false;
+					}
+					uint32_t trail = 0;
+					if (!_read_hex(trail)) {
+						return false;
+					}
+					if ((trail & 0xfffffc00) != 0xdc00) {
+						_error("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+						return false;
+					}
+					res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+				} else if ((res & 0xfffffc00) == 0xdc00) {
+					_error("Invalid UTF-16 sequence in string, unpaired trail surrogate");
+					return false;
+				}
+				_append_utf8(res);
+			} break;
+			case '"':
+			case '\\':
+			case '/': {
+				text.push_back(char(next));
+			} break;
+			default: {
+				_error("Invalid escape sequence");
+				return false;
+			}
+		}
+	}
+}
+
+// Matches the number grammar of RFC 8259: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+static bool _is_valid_number(const char *p_text, uint32_t p_length) {
+	uint32_t i = 0;
+	if (i < p_length && p_text[i] == '-') {
+		i++;
+	}
+	if (i >= p_length || !is_digit(p_text[i])) {
+		return false;
+	}
+	if (p_text[i] == '0') {
+		i++; // No leading zeros.
+	} else {
+		while (i < p_length && is_digit(p_text[i])) {
+			i++;
+		}
+	}
+	if (i < p_length && p_text[i] == '.') {
+		i++;
+		if (i >= p_length || !is_digit(p_text[i])) {
+			return false;
+		}
+		while (i < p_length && is_digit(p_text[i])) {
+			i++;
+		}
+	}
+	if (i < p_length && (p_text[i] == 'e' || p_text[i] == 'E')) {
+		i++;
+		if (i < p_length && (p_text[i] == '+' || p_text[i] == '-')) {
+			i++;
+		}
+		if (i >= p_length || !is_digit(p_text[i])) {
+			return false;
+		}
+		while (i < p_length && is_digit(p_text[i])) {
+			i++;
+		}
+	}
+	return i == p_length;
+}
+
+JSONReader::Token JSONReader::_read_number() {
+	text.clear();
+	int c = _peek();
+	while (c != -1 && (is_digit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) {
+		text.push_back(char(c));
+		position++;
+		c = _peek();
+	}
+	if (!_is_valid_number(text.ptr(), text.size())) {
+		return _error(vformat("Invalid number '%s'", String::utf8(text.ptr(), text.size())));
+	}
+	// Keep the raw text around, so callers can parse large integers without losing precision.
+	text.push_back(0);
+	number = String::to_float(text.ptr());
+	text.resize(text.size() - 1);
+	token = TOKEN_NUMBER;
+	return token;
+}
+
+JSONReader::Token JSONReader::_read_literal() {
+	text.clear();
+	int c = _peek();
+	while (c != -1 && is_ascii_alphabet_char(c)) {
+		text.push_back(char(c));
+		position++;
+		c = _peek();
+	}
+
+	if (text.size() == 4 && memcmp(text.ptr(), "true", 4) == 0) {
+		boolean = true;
+		token = TOKEN_BOOL;
+	} else if (text.size() == 5 && memcmp(text.ptr(), "false", 5) == 0) {
+		boolean = false;
+		token = TOKEN_BOOL;
+	} else if (text.size() == 4 && memcmp(text.ptr(), "null", 4) == 0) {
+		token = TOKEN_NULL;
+	} else {
+		return _error(vformat("Expected 'true', 'false', or 'null', got '%s'", String::utf8(text.ptr(), text.size())));
+	}
+	text.clear();
+	return token;
+}
+
+JSONReader::Token JSONReader::_read_value(int p_char) {
+	switch (p_char) {
+		case '{':
+		case '[': {
+			if (containers.size() >= Variant::MAX_RECURSION_DEPTH) {
+				return _error("JSON structure is too deep");
+			}
+			position++;
+			containers.push_back(p_char == '{');
+			state = STATE_FIRST;
+			token = p_char == '{' ? TOKEN_OBJECT_BEGIN : TOKEN_ARRAY_BEGIN;
+			return token;
+		}
+		case '"': {
+			position++;
+			if (!_read_string()) {
+				return token;
+			}
+			token = TOKEN_STRING;
+		} break;
+		case -1: {
+			return _error("Expected value, got 'EOF'");
+		}
+		default: {
+			if (p_char == '-' || is_digit(p_char)) {
+				if (_read_number() == TOKEN_ERROR) {
+					return token;
+				}
+			} else if (is_ascii_alphabet_char(p_char)) {
+				if (_read_literal() == TOKEN_ERROR) {
+					return token;
+				}
+			} else {
+				return _error("Unexpected character");
+			}
+		}
+	}
+
+	state = containers.is_empty() ? STATE_DONE : STATE_AFTER_VALUE;
+	return token;
+}
+
+JSONReader::Token JSONReader::_close_container() {
+	position++;
+	const bool object = containers[containers.size() - 1];
+	containers.resize(containers.size() - 1);
+	state = containers.is_empty() ? STATE_DONE : STATE_AFTER_VALUE;
+	token = object ? TOKEN_OBJECT_END : TOKEN_ARRAY_END;
+	return token;
+}
+
+Error JSONReader::open(const String &p_path) {
+	close();
+
+	Error err;
+	file = FileAccess::open(p_path, FileAccess::READ, &err);
+	if (file.is_null()) {
+		return err;
+	}
+	_fill();
+	_reset();
+	return OK;
+}
+
+Error JSONReader::open_buffer(const Vector<uint8_t> &p_buffer) {
+	close();
+
+	source = p_buffer;
+	data = source.ptr();
+	data_size = source.size();
+	_reset();
+	return OK;
+}
+
+void JSONReader::close() {
+	file.unref();
+	source.clear();
+	chunk.reset();
+	data = nullptr;
+	data_size = 0;
+	position = 0;
+	_reset();
+}
+
+JSONReader::Token JSONReader::read() {
+	if (token == TOKEN_ERROR || token == TOKEN_END) {
+		return token;
+	}
+
+	int c = _skip_whitespace();
+	switch (state) {
+		case STATE_ROOT: {
+			return _read_value(c);
+		}
+		case STATE_DONE: {
+			if (c != -1) {
+				return _error("Expected 'EOF'");
+			}
+			token = TOKEN_END;
+			return token;
+		}
+		case STATE_AFTER_VALUE: {
+			const bool object = containers[containers.size() - 1];
+			if (c == (object ? '}' : ']')) {
+				return _close_container();
+			}
+			if (c != ',') {
+				if (c == -1) {
+					return _error(object ? "Expected '}'" : "Expected ']'");
+				}
+				return _error(object ? "Expected '}' or ','" : "Expected ','");
+			}
+			position++;
+			c = _skip_whitespace();
+			state = object ? STATE_KEY : STATE_VALUE;
+		} break;
+		default: {
+		} break;
+	}
+
+	const bool object = containers[containers.size() - 1];
+	// Like JSON, accept trailing commas. In objects STATE_VALUE comes after ':', so a value is required.
+	if ((!object || state != STATE_VALUE) && c == (object ? '}' : ']')) {
+		return _close_container();
+	}
+	if (!object || state == STATE_VALUE) {
+		return _read_value(c);
+	}
+
+	if (c != '"') {
+		return _error(c == -1 ? "Expected '}'" : "Expected key");
+	}
+	position++;
+	if (!_read_string()) {
+		return token;
+	}
+	if (_skip_whitespace() != ':') {
+		return _error("Expected ':'");
+	}
+	position++;
+	state = STATE_VALUE;
+	token = TOKEN_KEY;
+	return token;
+}
+
+Variant JSONReader::get_value() const {
+	switch (token) {
+		case TOKEN_KEY:
+		case TOKEN_STRING:
+			return String::utf8(text.ptr(), text.size());
+		case TOKEN_NUMBER:
+			return number;
+		case TOKEN_BOOL:
+			return boolean;
+		default:
+			return Variant();
+	}
+}
+
+Variant JSONReader::read_value() {
+	switch (token) {
+		case TOKEN_OBJECT_BEGIN: {
+			Dictionary object;
+			while (read() == TOKEN_KEY) {
+				const String key = get_value();
+				read();
+				const Variant value = read_value();
+				if (token == TOKEN_ERROR) {
+					return Variant();
+				}
+				object[key] = value;
+			}
+			return token == TOKEN_OBJECT_END ? Variant(object) : Variant();
+		}
+		case TOKEN_ARRAY_BEGIN: {
+			Array array;
+			while (read() != TOKEN_ARRAY_END) {
+				const Variant value = read_value();
+				if (token == TOKEN_ERROR) {
+					return Variant();
+				}
+				array.push_back(value);
+			}
+			return array;
+		}
+		default: {
+			return get_value();
+		}
+	}
+}
+
+Error JSONReader::skip() {
+	if (token != TOKEN_OBJECT_BEGIN && token != TOKEN_ARRAY_BEGIN) {
+		return token == TOKEN_ERROR ? ERR_PARSE_ERROR : OK;
+	}
+
+	const uint32_t depth = containers.size() - 1;
+	while (read() != TOKEN_ERROR) {
+		if (containers.size() == depth && (token == TOKEN_OBJECT_END || token == TOKEN_ARRAY_END)) {
+			return OK;
+		}
+	}
+	return ERR_PARSE_ERROR;
+}
+
+Error JSONReader::read_with_callback(const Callable &p_callback) {
+	ERR_FAIL_COND_V(!p_callback.is_valid(), ERR_INVALID_PARAMETER);
+
+	while (true) {
+		const Token current = read();
+		if (current == TOKEN_END) {
+			return OK;
+		}
+		if (current == TOKEN_ERROR) {
+			return ERR_PARSE_ERROR;
+		}
+		const Variant ret = p_callback.call(current, get_value());
+		if (ret.get_type() == Variant::BOOL && !ret.operator bool()) {
+			return ERR_SKIP;
+		}
+	}
+}
+
+void JSONReader::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path"), &JSONReader::open);
+	ClassDB::bind_method(D_METHOD("open_buffer", "buffer"), &JSONReader::open_buffer);
+	ClassDB::bind_method(D_METHOD("close"), &JSONReader::close);
+
+	ClassDB::bind_method(D_METHOD("read"), &JSONReader::read);
+	ClassDB::bind_method(D_METHOD("get_token"), &JSONReader::get_token);
+	ClassDB::bind_method(D_METHOD("get_depth"), &JSONReader::get_depth);
+	ClassDB::bind_method(D_METHOD("get_value"), &JSONReader::get_value);
+	ClassDB::bind_method(D_METHOD("read_value"), &JSONReader::read_value);
+	ClassDB::bind_method(D_METHOD("skip"), &JSONReader::skip);
+	ClassDB::bind_method(D_METHOD("read_with_callback", "callback"), &JSONReader::read_with_callback);
+
+	ClassDB::bind_method(D_METHOD("get_error_line"), &JSONReader::get_error_line);
+	ClassDB::bind_method(D_METHOD("get_error_message"), &JSONReader::get_error_message);
+
+	BIND_ENUM_CONSTANT(TOKEN_NONE);
+	BIND_ENUM_CONSTANT(TOKEN_OBJECT_BEGIN);
+	BIND_ENUM_CONSTANT(TOKEN_OBJECT_END);
+	BIND_ENUM_CONSTANT(TOKEN_ARRAY_BEGIN);
+	BIND_ENUM_CONSTANT(TOKEN_ARRAY_END);
+	BIND_ENUM_CONSTANT(TOKEN_KEY);
+	BIND_ENUM_CONSTANT(TOKEN_STRING);
+	BIND_ENUM_CONSTANT(TOKEN_NUMBER);
+	BIND_ENUM_CONSTANT(TOKEN_BOOL);
+	BIND_ENUM_CONSTANT(TOKEN_NULL);
+	BIND_ENUM_CONSTANT(TOKEN_END);
+	BIND_ENUM_CONSTANT(TOKEN_ERROR);
+}
+
+/* JSONWriter */
+
+void JSONWriter::_append_indent(uint32_t p_depth) {
+	if (indent_utf8.length() == 0) {
+		return;
+	}
+	buffer.push_back('\n');
+	for (uint32_t i = 0; i < p_depth; i++) {
+		_append(indent_utf8.get_data(), indent_utf8.length());
+	}
+}
+
+void JSONWriter::_append_string(const String &p_string) {
+	buffer.push_back('"');
+	const char32_t *str = p_string.ptr();
+	const int length = p_string.length();
+	for (int i = 0; i < length; i++) {
+		// Same escapes as String::json_escape().
+		switch (str[i]) {
+			case '\\':
+				_append("\\\\", 2);
+				break;
+			case '\b':
+				_append("\\b", 2);
+				break;
+			case '\f':
+				_append("\\f", 2);
+				break;
+			case '\n':
+				_append("\\n", 2);
+				break;
+			case '\r':
+				_append("\\r", 2);
+				break;
+			case '\t':
+				_append("\\t", 2);
+				break;
+			case '\v':
+				_append("\\v", 2);
+				break;
+			case '"':
+				_append("\\\"", 2);
+				break;
+			default:
+				_encode_utf8(buffer, str[i]);
+		}
+	}
+	buffer.push_back('"');
+}
+
+void JSONWriter::_append_element() {
+	Scope &scope = scopes[scopes.size() - 1];
+	if (!scope.empty) {
+		buffer.push_back(',');
+	}
+	scope.empty = false;
+	_append_indent(scopes.size());
+}
+
+bool JSONWriter::_begin_value() {
+	if (scopes.is_empty()) {
+		ERR_FAIL_COND_V_MSG(root_written, false, "A JSON document can only have one root value.");
+		root_written = true;
+		return true;
+	}
+	if (scopes[scopes.size() - 1].object) {
+		ERR_FAIL_COND_V_MSG(!after_key, false, "Values in a JSON object must be preceded by a key.");
+		after_key = false;
+		return true;
+	}
+	_append_element();
+	return true;
+}
+
+void JSONWriter::_write_variant(const Variant &p_value, HashSet<const void *> &p_markers) {
+	if (scopes.size() > Variant::MAX_RECURSION_DEPTH) {
+		write_string("...");
+		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
+	}
+
+	switch (p_value.get_type()) {
+		case Variant::NIL: {
+			write_null();
+		} break;
+		case Variant::BOOL: {
+			write_bool(p_value);
+		} break;
+		case Variant::INT: {
+			write_int(p_value);
+		} break;
+		case Variant::FLOAT: {
+			write_number(p_value);
+		} break;
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+		case Variant::PACKED_STRING_ARRAY:
+		case Variant::ARRAY: {
+			Array array = p_value;
+			if (p_markers.has(array.id())) {
+				write_string("[...]");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
+			p_markers.insert(array.id());
+
+			begin_array();
+			for (const Variant &value : array) {
+				_write_variant(value, p_markers);
+			}
+			end_array();
+
+			p_markers.erase(array.id());
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary dict = p_value;
+			if (p_markers.has(dict.id())) {
+				write_string("{...}");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
+			p_markers.insert(dict.id());
+
+			begin_object();
+			if (sort_keys) {
+				List<Variant> keys;
+				dict.get_key_list(&keys);
+				keys.sort_custom<StringLikeVariantOrder>();
+				for (const Variant &key : keys) {
+					write_key(key);
+					_write_variant(dict[key], p_markers);
+				}
+			} else {
+				for (const KeyValue<Variant, Variant> &kv : dict) {
+					write_key(kv.key);
+					_write_variant(kv.value, p_markers);
+				}
+			}
+			end_object();
+
+			p_markers.erase(dict.id());
+		} break;
+		default: {
+			write_string(p_value);
+		} break;
+	}
+}
+
+Error JSONWriter::open(const String &p_path) {
+	close();
+	clear();
+
+	Error err;
+	file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	if (file.is_null()) {
+		return err;
+	}
+	return OK;
+}
+
+Error JSONWriter::close() {
+	const Error err = flush();
+	file.unref();
+	return err;
+}
+
+Error JSONWriter::flush() {
+	if (file.is_null() || buffer.is_empty()) {
+		return error;
+	}
+	if (!file->store_buffer(buffer.ptr(), buffer.size())) {
+		error = ERR_FILE_CANT_WRITE;
+	}
+	buffer.clear();
+	return error;
+}
+
+void JSONWriter::clear() {
+	buffer.clear();
+	scopes.clear();
+	after_key = false;
+	root_written = false;
+	error = OK;
+}
+
+Vector<uint8_t> JSONWriter::get_data() const {
+	Vector<uint8_t> ret;
+	ret.resize(buffer.size());
+	if (!buffer.is_empty()) {
+		memcpy(ret.ptrw(), buffer.ptr(), buffer.size());
+	}
+	return ret;
+}
+
+String JSONWriter::get_as_text() const {
+	return String::utf8(reinterpret_cast<const char *>(buffer.ptr()), buffer.size());
+}
+
+void JSONWriter::set_indent(const String &p_indent) {
+	indent = p_indent;
+	indent_utf8 = p_indent.utf8();
+}
+
+String JSONWriter::get_indent() const {
+	return indent;
+}
+
+void JSONWriter::set_sort_keys(bool p_sort_keys) {
+	sort_keys = p_sort_keys;
+}
+
+bool JSONWriter::is_sorting_keys() const {
+	return sort_keys;
+}
+
+void JSONWriter::set_full_precision(bool p_full_precision) {
+	full_precision = p_full_precision;
+}
+
+bool JSONWriter::is_full_precision() const {
+	return full_precision;
+}
+
+void JSONWriter::begin_object() {
+	if (!_begin_value()) {
+		return;
+	}
+	buffer.push_back('{');
+	scopes.push_back(Scope{ true, true });
+}
+
+void JSONWriter::end_object() {
+	ERR_FAIL_COND_MSG(scopes.is_empty() || !scopes[scopes.size() - 1].object, "There is no JSON object to end.");
+	ERR_FAIL_COND_MSG(after_key, "The last key of the JSON object has no value.");
+	if (!scopes[scopes.size() - 1].empty) {
+		_append_indent(scopes.size() - 1);
+	}
+	buffer.push_back('}');
+	scopes.resize(scopes.size() - 1);
+	_flush_if_needed();
+}
+
+void JSONWriter::begin_array() {
+	if (!_begin_value()) {
+		return;
+	}
+	buffer.push_back('[');
+	scopes.push_back(Scope{ false, true });
+}
+
+void JSONWriter::end_array() {
+	ERR_FAIL_COND_MSG(scopes.is_empty() || scopes[scopes.size() - 1].object, "There is no JSON array to end.");
+	if (!scopes[scopes.size() - 1].empty) {
+		_append_indent(scopes.size() - 1);
+	}
+	buffer.push_back(']');
+	scopes.resize(scopes.size() - 1);
+	_flush_if_needed();
+}
+
+void JSONWriter::write_key(const String &p_key) {
+	ERR_FAIL_COND_MSG(scopes.is_empty() || !scopes[scopes.size() - 1].object, "Keys can only be written inside a JSON object.");
+	ERR_FAIL_COND_MSG(after_key, "The previous key of the JSON object has no value.");
+	_append_element();
+	_append_string(p_key);
+	buffer.push_back(':');
+	if (indent_utf8.length() != 0) {
+		buffer.push_back(' ');
+	}
+	after_key = true;
+}
+
+void JSONWriter::write_string(const String &p_string) {
+	if (!_begin_value()) {
+		return;
+	}
+	_append_string(p_string);
+	_flush_if_needed();
+}
+
+void JSONWriter::write_number(double p_number) {
+	if (!_begin_value()) {
+		return;
+	}
+
+	// Only for exactly 0. If we have approximately 0 let the user decide how much
+	// precision they want.
+	if (p_number == double(0)) {
+		_append("0.0", 3);
+		_flush_if_needed();
+		return;
+	}
+
+	const double magnitude = log10(Math::abs(p_number));
+	const int total_digits = full_precision ? 17 : 14;
+	const int precision = MAX(1, total_digits - (int)Math::floor(magnitude));
+
+	const String number_text = String::num(p_number, precision);
+	const char32_t *str = number_text.ptr();
+	for (int i = 0; i < number_text.length(); i++) {
+		buffer.push_back(uint8_t(str[i]));
+	}
+	_flush_if_needed();
+}
+
+void JSONWriter::write_int(int64_t p_number) {
+	if (!_begin_value()) {
+		return;
+	}
+
+	char digits[20];
+	int count = 0;
+	uint64_t value = p_number < 0 ? uint64_t(0) - uint64_t(p_number) : uint64_t(p_number);
+	do {
+		digits[count++] = char('0' + value % 10);
+		value /= 10;
+	} while (value != 0);
+
+	if (p_number < 0) {
+		buffer.push_back('-');
+	}
+	while (count > 0) {
+		buffer.push_back(digits[--count]);
+	}
+	_flush_if_needed();
+}
+
+void JSONWriter::write_bool(bool p_value) {
+	if (!_begin_value()) {
+		return;
+	}
+	if (p_value) {
+		_append("true", 4);
+	} else {
+		_append("false", 5);
+	}
+	_flush_if_needed();
+}
+
+void JSONWriter::write_null() {
+	if (!_begin_value()) {
+		return;
+	}
+	_append("null", 4);
+	_flush_if_needed();
+}
+
+void JSONWriter::write_value(const Variant &p_value) {
+	HashSet<const void *> markers;
+	_write_variant(p_value, markers);
+	_flush_if_needed();
+}
+
+void JSONWriter::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path"), &JSONWriter::open);
+	ClassDB::bind_method(D_METHOD("close"), &JSONWriter::close);
+	ClassDB::bind_method(D_METHOD("flush"), &JSONWriter::flush);
+	ClassDB::bind_method(D_METHOD("clear"), &JSONWriter::clear);
+	ClassDB::bind_method(D_METHOD("get_data"), &JSONWriter::get_data);
+	ClassDB::bind_method(D_METHOD("get_as_text"), &JSONWriter::get_as_text);
+
+	ClassDB::bind_method(D_METHOD("set_indent", "indent"), &JSONWriter::set_indent);
+	ClassDB::bind_method(D_METHOD("get_indent"), &JSONWriter::get_indent);
+	ClassDB::bind_method(D_METHOD("set_sort_keys", "enable"), &JSONWriter::set_sort_keys);
+	ClassDB::bind_method(D_METHOD("is_sorting_keys"), &JSONWriter::is_sorting_keys);
+	ClassDB::bind_method(D_METHOD("set_full_precision", "enable"), &JSONWriter::set_full_precision);
+	ClassDB::bind_method(D_METHOD("is_full_precision"), &JSONWriter::is_full_precision);
+
+	ClassDB::bind_method(D_METHOD("begin_object"), &JSONWriter::begin_object);
+	ClassDB::bind_method(D_METHOD("end_object"), &JSONWriter::end_object);
+	ClassDB::bind_method(D_METHOD("begin_array"), &JSONWriter::begin_array);
+	ClassDB::bind_method(D_METHOD("end_array"), &JSONWriter::end_array);
+	ClassDB::bind_method(D_METHOD("write_key", "key"), &JSONWriter::write_key);
+	ClassDB::bind_method(D_METHOD("write_string", "string"), &JSONWriter::write_string);
+	ClassDB::bind_method(D_METHOD("write_number", "number"), &JSONWriter::write_number);
+	ClassDB::bind_method(D_METHOD("write_int", "number"), &JSONWriter::write_int);
+	ClassDB::bind_method(D_METHOD("write_bool", "value"), &JSONWriter::write_bool);
+	ClassDB::bind_method(D_METHOD("write_null"), &JSONWriter::write_null);
+	ClassDB::bind_method(D_METHOD("write_value", "value"), &JSONWriter::write_value);
+
+	ADD_PROPERTY(PropertyInfo(Variant::STRING, "indent"), "set_indent", "get_indent");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "sort_keys"), "set_sort_keys", "is_sorting_keys");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "full_precision"), "set_full_precision", "is_full_precision");
+}
@@ -0,0 +1,218 @@
+/**************************************************************************/
+/*  json_stream.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/file_access.h"
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/span.h"
+
+// Pull parser reading UTF-8 JSON straight from a byte buffer or a file, one token at a time.
+// Nothing but the current token is kept in memory, so documents far larger than the memory
+// budget can be processed, and values are only converted to Variant when asked for.
+class JSONReader : public RefCounted {
+	GDCLASS(JSONReader, RefCounted);
+
+public:
+	enum Token {
+		TOKEN_NONE,
+		TOKEN_OBJECT_BEGIN,
+		TOKEN_OBJECT_END,
+		TOKEN_ARRAY_BEGIN,
+		TOKEN_ARRAY_END,
+		TOKEN_KEY,
+		TOKEN_STRING,
+		TOKEN_NUMBER,
+		TOKEN_BOOL,
+		TOKEN_NULL,
+		TOKEN_END,
+		TOKEN_ERROR,
+	};
+
+private:
+	enum State {
+		STATE_ROOT,
+		STATE_FIRST, // After '{' or '['.
+		STATE_KEY, // After ',' in an object.
+		STATE_VALUE, // After ',' in an array or ':' in an object.
+		STATE_AFTER_VALUE,
+		STATE_DONE,
+	};
+
+	static constexpr uint32_t CHUNK_SIZE = 65536;
+
+	Ref<FileAccess> file;
+	Vector<uint8_t> source;
+	LocalVector<uint8_t> chunk;
+
+	// Window of the input currently being parsed, either `source` or the last chunk read from `file`.
+	const uint8_t *data = nullptr;
+	uint32_t data_size = 0;
+	uint32_t position = 0;
+
+	LocalVector<bool> containers; // `true` for objects.
+	State state = STATE_ROOT;
+	Token token = TOKEN_NONE;
+
+	// UTF-8 text of the current key or string, reused between tokens.
+	LocalVector<char> text;
+	double number = 0.0;
+	bool boolean = false;
+
+	String err_str;
+	int err_line = 0;
+	int line = 0;
+
+	bool _fill();
+	_FORCE_INLINE_ int _peek() {
+		if (unlikely(position == data_size) && !_fill()) {
+			return -1;
+		}
+		return data[position];
+	}
+	_FORCE_INLINE_ int _next() {
+		const int c = _peek();
+		if (c != -1) {
+			position++;
+		}
+		return c;
+	}
+
+	void _reset();
+	int _skip_whitespace();
+	Token _error(const String &p_message);
+	bool _read_hex(uint32_t &r_value);
+	void _append_utf8(uint32_t p_char);
+	bool _read_string();
+	Token _read_number();
+	Token _read_literal();
+	Token _read_value(int p_char);
+	Token _close_container();
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path);
+	Error open_buffer(const Vector<uint8_t> &p_buffer);
+	void close();
+
+	Token read();
+	Token get_token() const { return token; }
+	int get_depth() const { return containers.size(); }
+
+	Variant get_value() const;
+	// Raw UTF-8 text of the current key or string, valid until the next call to read().
+	Span<char> get_text_utf8() const { return Span<char>(text.ptr(), text.size()); }
+	double get_number() const { return number; }
+
+	Variant read_value();
+	Error skip();
+	Error read_with_callback(const Callable &p_callback);
+
+	int get_error_line() const { return err_line; }
+	String get_error_message() const { return err_str; }
+};
+
+VARIANT_ENUM_CAST(JSONReader::Token);
+
+// Push writer producing UTF-8 JSON into a growable byte buffer, optionally flushed to a file as it fills up.
+// The formatting matches JSON::stringify().
+class JSONWriter : public RefCounted {
+	GDCLASS(JSONWriter, RefCounted);
+
+	static constexpr uint32_t FLUSH_SIZE = 65536;
+
+	struct Scope {
+		bool object = false;
+		bool empty = true;
+	};
+
+	Ref<FileAccess> file;
+	LocalVector<uint8_t> buffer;
+	LocalVector<Scope> scopes;
+	bool after_key = false;
+	bool root_written = false;
+	Error error = OK;
+
+	String indent;
+	CharString indent_utf8;
+	bool sort_keys = true;
+	bool full_precision = false;
+
+	_FORCE_INLINE_ void _append(const char *p_str, uint32_t p_len) {
+		const uint32_t size = buffer.size();
+		buffer.resize(size + p_len);
+		memcpy(buffer.ptr() + size, p_str, p_len);
+	}
+	void _append_indent(uint32_t p_depth);
+	void _append_string(const String &p_string);
+	void _append_element();
+	bool _begin_value();
+	void _flush_if_needed() {
+		if (file.is_valid() && buffer.size() >= FLUSH_SIZE) {
+			flush();
+		}
+	}
+	void _write_variant(const Variant &p_value, HashSet<const void *> &p_markers);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path);
+	Error close();
+	Error flush();
+	void clear();
+
+	Vector<uint8_t> get_data() const;
+	String get_as_text() const;
+
+	void set_indent(const String &p_indent);
+	String get_indent() const;
+	void set_sort_keys(bool p_sort_keys);
+	bool is_sorting_keys() const;
+	void set_full_precision(bool p_full_precision);
+	bool is_full_precision() const;
+
+	void begin_object();
+	void end_object();
+	void begin_array();
+	void end_array();
+	void write_key(const String &p_key);
+	void write_string(const String &p_string);
+	void write_number(double p_number);
+	void write_int(int64_t p_number);
+	void write_bool(bool p_value);
+	void write_null();
+	void write_value(const Variant &p_value);
+};
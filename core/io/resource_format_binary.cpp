@@ -31,8 +31,10 @@
 #include "resource_format_binary.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/compression.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
 #include "core/version.h"
@@ -93,9 +95,11 @@ enum {
 	// Version 4: New string ID for ext/subresources, breaks forward compat.
 	// Version 5: Ability to store script class in the header.
 	// Version 6: Added PackedVector4Array Variant type.
-	FORMAT_VERSION = 6,
+	// Version 7: Per-resource compressed property blocks (only written when used).
+	FORMAT_VERSION = 7,
 	FORMAT_VERSION_CAN_RENAME_DEPS = 1,
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
+	FORMAT_VERSION_COMPRESSED_PROPERTIES = 7,
 };
 
 void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
@@ -155,12 +159,17 @@ StringName ResourceLoaderBinary::_get_string() {
 	uint32_t id = f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
-		if ((int)len > str_buf.size()) {
-			str_buf.resize(len);
-		}
 		if (len == 0) {
 			return StringName();
 		}
+		// Parse straight from the mapped file when possible.
+		Span<uint8_t> span = f->get_mapped_span(len);
+		if (!span.is_empty()) {
+			return String::utf8((const char *)span.ptr(), len);
+		}
+		if ((int)len > str_buf.size()) {
+			str_buf.resize(len);
+		}
 		f->get_buffer((uint8_t *)&str_buf[0], len);
 		return String::utf8(&str_buf[0], len);
 	}
@@ -400,6 +409,20 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 					if (using_named_scene_ids) { // New format.
 						ERR_FAIL_INDEX_V((int)index, internal_resources.size(), ERR_PARSE_ERROR);
+						if (!internal_resources[index].loaded && (int)index < loading_index) {
+							// Dependencies are stored first, so this only happens on random access loads.
+							// Forward references are circular and stay null, as on a full load.
+							Ref<FileAccess> prev_f = f;
+							uint64_t prev_pos = f->get_position();
+							int prev_index = loading_index;
+							Error err = _load_internal_resource(index);
+							loading_index = prev_index;
+							f = prev_f;
+							f->seek(prev_pos);
+							if (err != OK) {
+								return err;
+							}
+						}
 						path = internal_resources[index].path;
 					} else {
 						path += res_path + "::" + itos(index);
@@ -444,6 +467,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
 					} else {
+						Error err = _start_external_load(erindex);
+						if (err != OK) {
+							return err;
+						}
 						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
 							Error err;
@@ -676,229 +703,347 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
+Error ResourceLoaderBinary::_start_external_load(int p_index) {
+	if (external_resources[p_index].load_started) {
+		return OK;
 	}
+	external_resources.write[p_index].load_started = true;
 
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+	String path = external_resources[p_index].path;
+
+	if (remaps.has(path)) {
+		path = remaps[path];
+	}
 
-		if (remaps.has(path)) {
-			path = remaps[path];
+	if (!path.contains("://") && path.is_relative_path()) {
+		// path is relative to file being loaded, so convert to a resource path
+		path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[p_index].path));
+	}
+
+	external_resources.write[p_index].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+	external_resources.write[p_index].load_token = ResourceLoader::_load_start(path, external_resources[p_index].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+	if (external_resources[p_index].load_token.is_null()) {
+		if (!ResourceLoader::get_abort_on_missing_resources()) {
+			ResourceLoader::notify_dependency_error(local_path, path, external_resources[p_index].type);
+		} else {
+			error = ERR_FILE_MISSING_DEPENDENCIES;
+			ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
 		}
+	}
+	return OK;
+}
+
+Error ResourceLoaderBinary::_load_internal_resource(int p_index) {
+	bool main = p_index == (internal_resources.size() - 1);
+	internal_resources.write[p_index].loaded = true;
+	loading_index = p_index;
+
+	//maybe it is loaded already
+	String path;
+	String id;
+
+	if (!main) {
+		path = internal_resources[p_index].path;
+
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+			internal_resources.write[p_index].path = path; // Update path.
 		}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (external_resources[i].load_token.is_null()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				internal_index_cache[path] = cached;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	uint64_t offset = internal_resources[p_index].offset;
+
+	f = resource_f;
+	f->seek(offset);
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	String t = get_unicode_string();
 
-		if (!main) {
-			path = internal_resources[i].path;
+	Ref<Resource> res;
+	Resource *r = nullptr;
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	MissingResource *missing_resource = nullptr;
 
-				internal_resources.write[i].path = path; // Update path.
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
 			}
+		}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					missing_resource = memnew(MissingResource);
+					missing_resource->set_original_class(t);
+					missing_resource->set_recording_properties(true);
+					obj = missing_resource;
+				} else {
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
 				}
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				error = ERR_FILE_CORRUPT;
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
 			}
-		}
 
-		uint64_t offset = internal_resources[i].offset;
+			res = Ref<Resource>(r);
+		}
+	}
 
-		f->seek(offset);
+	if (r) {
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
+			}
+		}
+		r->set_scene_unique_id(id);
+	}
 
-		String t = get_unicode_string();
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		Ref<Resource> res;
-		Resource *r = nullptr;
+	int pc = f->get_32();
 
-		MissingResource *missing_resource = nullptr;
+	// Version 7 files may store the property list as a separately compressed block.
+	Vector<uint8_t> block;
+	if (using_compressed_properties) {
+		uint32_t block_size = f->get_32();
+		uint32_t compressed_size = f->get_32();
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
+		// Validate the sizes before allocating anything. Whatever is stored must fit in the rest of
+		// the file, and a zstd frame can't expand more than its 128 KiB RLE blocks allow (4 bytes each).
+		uint64_t remaining = f->get_length() - f->get_position();
+		uint64_t stored_size = compressed_size > 0 ? compressed_size : block_size;
+		if (stored_size > remaining || block_size > uint64_t(INT32_MAX) || (compressed_size > 0 && block_size > (uint64_t(compressed_size) << 15))) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Invalid property block size for resource of type '%s'.", local_path, t));
 		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
+
+		if (compressed_size > 0) {
+			block.resize(block_size);
+			Vector<uint8_t> compressed;
+			compressed.resize(compressed_size);
+			f->get_buffer(compressed.ptrw(), compressed_size);
+			int ret = Compression::decompress(block.ptrw(), block_size, compressed.ptr(), compressed_size, Compression::MODE_ZSTD);
+			if (ret < 0 || uint32_t(ret) != block_size) {
+				error = ERR_FILE_CORRUPT;
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Failed to decompress the properties of resource of type '%s'.", local_path, t));
 			}
 
-			if (res.is_null()) {
-				//did not replace
-
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource;
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
-					}
-				}
+			Ref<FileAccessMemory> fam;
+			fam.instantiate();
+			fam->open_custom(block.ptr(), block.size());
+			fam->set_big_endian(resource_f->is_big_endian());
+			fam->real_is_double = resource_f->real_is_double;
+			f = fam;
+		}
+		// Otherwise the block was stored uncompressed and follows inline.
+	}
 
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
-					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
-				}
+	//set properties
+
+	Dictionary missing_resource_properties;
+
+	for (int j = 0; j < pc; j++) {
+		StringName name = _get_string();
+
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
+
+		Variant value;
+
+		error = parse_variant(value);
+		if (error) {
+			return error;
+		}
 
-				res = Ref<Resource>(r);
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
 		}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
-				} else {
-					r->set_path_cache(path);
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
+			}
+		}
+
+		if (value.get_type() == Variant::DICTIONARY) {
+			Dictionary set_dict = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+				Dictionary get_dict = get_value;
+				if (!set_dict.is_same_typed(get_dict)) {
+					value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+							get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
 				}
 			}
-			r->set_scene_unique_id(id);
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		if (set_valid) {
+			res->set(name, value);
 		}
+	}
 
-		int pc = f->get_32();
+	if (missing_resource) {
+		missing_resource->set_recording_properties(false);
+	}
 
-		//set properties
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
-		Dictionary missing_resource_properties;
+#ifdef TOOLS_ENABLED
+	res->set_edited(false);
+#endif
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+	f = resource_f;
+	loaded_count++;
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+	if (progress) {
+		*progress = loaded_count / float(internal_resources.size());
+	}
 
-			Variant value;
+	resource_cache.push_back(res);
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+	if (main) {
+		resource = res;
+	}
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+	return OK;
+}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
+	resource_f = f;
 
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
-				}
+	if (!sub_resource_id.is_empty()) {
+		// Random access: decode only the requested internal resource. With named scene IDs,
+		// its dependencies (internal and external) are decoded when first referenced.
+		int index = -1;
+		for (int i = 0; i < internal_resources.size() - 1; i++) {
+			const String &ir_path = internal_resources[i].path;
+			if (ir_path == "local://" + sub_resource_id || ir_path == res_path + "::" + sub_resource_id) {
+				index = i;
+				break;
 			}
+		}
+		if (index == -1) {
+			error = ERR_FILE_NOT_FOUND;
+			f.unref();
+			resource_f.unref();
+			ERR_FAIL_V_MSG(error, vformat("'%s': Sub-resource not found: '%s'.", local_path, sub_resource_id));
+		}
 
-			if (set_valid) {
-				res->set(name, value);
+		if (using_named_scene_ids) {
+			error = _load_internal_resource(index);
+		} else {
+			// Old files reference internal resources by position only, so load everything up to it.
+			for (int i = 0; i < external_resources.size() && error == OK; i++) {
+				error = _start_external_load(i);
+			}
+			for (int i = 0; i <= index && error == OK; i++) {
+				if (!internal_resources[i].loaded) {
+					error = _load_internal_resource(i);
+				}
 			}
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		f.unref();
+		resource_f.unref();
+		if (error != OK) {
+			return error;
 		}
-
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+		resource = internal_index_cache[internal_resources[index].path];
+		if (resource.is_null()) {
+			error = ERR_FILE_CORRUPT;
+			return error;
 		}
+		resource->set_as_translation_remapped(translation_remapped);
+		return OK;
+	}
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
-
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+	for (int i = 0; i < external_resources.size(); i++) {
+		Error err = _start_external_load(i);
+		if (err != OK) {
+			return err;
 		}
+	}
 
-		resource_cache.push_back(res);
+	if (internal_resources.is_empty()) {
+		return ERR_FILE_EOF;
+	}
 
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
-			return OK;
+	for (int i = 0; i < internal_resources.size(); i++) {
+		if (internal_resources[i].loaded) {
+			continue;
+		}
+		error = _load_internal_resource(i);
+		if (error != OK) {
+			return error;
 		}
 	}
 
-	return ERR_FILE_EOF;
+	f.unref();
+	resource_f.unref();
+	resource->set_as_translation_remapped(translation_remapped);
+	error = OK;
+	return OK;
 }
 
 void ResourceLoaderBinary::set_translation_remapped(bool p_remapped) {
@@ -921,12 +1066,16 @@ static String get_ustring(Ref<FileAccess> f) {
 
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
-	}
 	if (len == 0) {
 		return String();
 	}
+	Span<uint8_t> span = len > 0 ? f->get_mapped_span(len) : Span<uint8_t>();
+	if (!span.is_empty()) {
+		return String::utf8((const char *)span.ptr(), len);
+	}
+	if (len > str_buf.size()) {
+		str_buf.resize(len);
+	}
 	f->get_buffer((uint8_t *)&str_buf[0], len);
 	return String::utf8(&str_buf[0], len);
 }
@@ -1040,6 +1189,9 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 	if (flags & ResourceFormatSaverBinaryInstance::FORMAT_FLAG_UIDS) {
 		using_uids = true;
 	}
+	if (flags & ResourceFormatSaverBinaryInstance::FORMAT_FLAG_COMPRESSED_PROPERTIES) {
+		using_compressed_properties = true;
+	}
 	f->real_is_double = (flags & ResourceFormatSaverBinaryInstance::FORMAT_FLAG_REAL_T_IS_DOUBLE) != 0;
 
 	if (using_uids) {
@@ -1213,10 +1365,19 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 		*r_error = ERR_FILE_CANT_OPEN;
 	}
 
+	// "file.res::id" loads a single built-in sub-resource without decoding the rest of the file.
+	String file_path = p_path;
+	String sub_resource_id;
+	int sub_resource_pos = p_path.rfind("::");
+	if (sub_resource_pos != -1) {
+		file_path = p_path.substr(0, sub_resource_pos);
+		sub_resource_id = p_path.substr(sub_resource_pos + 2);
+	}
+
 	Error err;
-	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ, &err);
 
-	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), vformat("Cannot open file '%s'.", p_path));
+	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), vformat("Cannot open file '%s'.", file_path));
 
 	ResourceLoaderBinary loader;
 	switch (p_cache_mode) {
@@ -1238,8 +1399,15 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	loader.use_sub_threads = p_use_sub_threads;
 	loader.progress = r_progress;
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
+	if (!sub_resource_id.is_empty()) {
+		int pos = path.rfind("::");
+		if (pos != -1) {
+			path = path.substr(0, pos);
+		}
+	}
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
+	loader.sub_resource_id = sub_resource_id;
 	loader.open(f);
 
 	err = loader.load();
@@ -1287,11 +1455,31 @@ void ResourceFormatLoaderBinary::get_recognized_extensions(List<String> *p_exten
 	}
 }
 
+// Only load() handles "file.res::id" paths. The other operations read whole files, and must not
+// open a path with the sub-resource ID still attached.
+static bool _is_sub_resource_path(const String &p_path) {
+	return p_path.contains("::");
+}
+
+bool ResourceFormatLoaderBinary::recognize_path(const String &p_path, const String &p_for_type) const {
+	int sub_resource_pos = p_path.rfind("::");
+	if (sub_resource_pos == -1) {
+		return ResourceFormatLoader::recognize_path(p_path, p_for_type);
+	}
+
+	// Built-in sub-resource path, claimed if the containing file is a binary resource.
+	return ResourceFormatLoader::recognize_path(p_path.substr(0, sub_resource_pos));
+}
+
 bool ResourceFormatLoaderBinary::handles_type(const String &p_type) const {
 	return true; //handles all
 }
 
 void ResourceFormatLoaderBinary::get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types) {
+	if (_is_sub_resource_path(p_path)) {
+		return;
+	}
+
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), vformat("Cannot open file '%s'.", p_path));
 
@@ -1302,6 +1490,10 @@ void ResourceFormatLoaderBinary::get_dependencies(const String &p_path, List<Str
 }
 
 Error ResourceFormatLoaderBinary::rename_dependencies(const String &p_path, const HashMap<String, String> &p_map) {
+	if (_is_sub_resource_path(p_path)) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_OPEN, vformat("Cannot open file '%s'.", p_path));
 
@@ -1514,6 +1706,10 @@ Error ResourceFormatLoaderBinary::rename_dependencies(const String &p_path, cons
 }
 
 void ResourceFormatLoaderBinary::get_classes_used(const String &p_path, HashSet<StringName> *r_classes) {
+	if (_is_sub_resource_path(p_path)) {
+		return;
+	}
+
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), vformat("Cannot open file '%s'.", p_path));
 
@@ -1524,6 +1720,10 @@ void ResourceFormatLoaderBinary::get_classes_used(const String &p_path, HashSet<
 }
 
 String ResourceFormatLoaderBinary::get_resource_type(const String &p_path) const {
+	if (_is_sub_resource_path(p_path)) {
+		return "";
+	}
+
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	if (f.is_null()) {
 		return ""; //could not read
@@ -1537,6 +1737,10 @@ String ResourceFormatLoaderBinary::get_resource_type(const String &p_path) const
 }
 
 String ResourceFormatLoaderBinary::get_resource_script_class(const String &p_path) const {
+	if (_is_sub_resource_path(p_path)) {
+		return "";
+	}
+
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	if (f.is_null()) {
 		return ""; //could not read
@@ -1549,6 +1753,10 @@ String ResourceFormatLoaderBinary::get_resource_script_class(const String &p_pat
 }
 
 ResourceUID::ID ResourceFormatLoaderBinary::get_resource_uid(const String &p_path) const {
+	if (_is_sub_resource_path(p_path)) {
+		return ResourceUID::INVALID_ID;
+	}
+
 	String ext = p_path.get_extension().to_lower();
 	if (!ClassDB::is_resource_extension(ext)) {
 		return ResourceUID::INVALID_ID;
@@ -2150,6 +2358,8 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 	bundle_resources = p_flags & ResourceSaver::FLAG_BUNDLE_RESOURCES;
 	big_endian = p_flags & ResourceSaver::FLAG_SAVE_BIG_ENDIAN;
 	takeover_paths = p_flags & ResourceSaver::FLAG_REPLACE_SUBRESOURCE_PATHS;
+	// Compressing each block again would be pointless when the whole file is compressed.
+	compress_properties = (p_flags & ResourceSaver::FLAG_COMPRESS_PROPERTIES) && !(p_flags & ResourceSaver::FLAG_COMPRESS);
 
 	if (!p_path.begins_with("res://")) {
 		takeover_paths = false;
@@ -2176,7 +2386,8 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 	f->store_32(0); //64 bits file, false for now
 	f->store_32(GODOT_VERSION_MAJOR);
 	f->store_32(GODOT_VERSION_MINOR);
-	f->store_32(FORMAT_VERSION);
+	// Keep files without compressed properties readable by engines that only know version 6.
+	f->store_32(compress_properties ? FORMAT_VERSION : FORMAT_VERSION_COMPRESSED_PROPERTIES - 1);
 
 	if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
 		return ERR_CANT_CREATE;
@@ -2191,6 +2402,9 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 #ifdef REAL_T_IS_DOUBLE
 		format_flags |= FORMAT_FLAG_REAL_T_IS_DOUBLE;
 #endif
+		if (compress_properties) {
+			format_flags |= FORMAT_FLAG_COMPRESSED_PROPERTIES;
+		}
 		if (!p_resource->is_class("PackedScene")) {
 			Ref<Script> s = p_resource->get_script();
 			if (s.is_valid()) {
@@ -2350,9 +2564,37 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 		save_unicode_string(f, rd.type);
 		f->store_32(uint32_t(rd.properties.size()));
 
+		if (!compress_properties) {
+			for (const Property &p : rd.properties) {
+				f->store_32(uint32_t(p.name_idx));
+				write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+			}
+			continue;
+		}
+
+		// Serialize the properties into memory, then store them as a single zstd block
+		// (or raw, when compression doesn't pay off) prefixed by both sizes.
+		Ref<FileAccessMemory> block;
+		block.instantiate();
+		block->open_growable();
+		block->set_big_endian(big_endian);
 		for (const Property &p : rd.properties) {
-			f->store_32(uint32_t(p.name_idx));
-			write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+			block->store_32(uint32_t(p.name_idx));
+			write_variant(block, p.value, resource_map, external_resources, string_map, p.pi);
+		}
+
+		Span<uint8_t> raw = block->get_growable_data();
+		Vector<uint8_t> compressed;
+		compressed.resize(Compression::get_max_compressed_buffer_size(raw.size(), Compression::MODE_ZSTD));
+		int compressed_size = Compression::compress(compressed.ptrw(), raw.ptr(), raw.size(), Compression::MODE_ZSTD);
+
+		f->store_32(uint32_t(raw.size()));
+		if (compressed_size > 0 && (uint64_t)compressed_size < raw.size()) {
+			f->store_32(uint32_t(compressed_size));
+			f->store_buffer(compressed.ptr(), compressed_size);
+		} else {
+			f->store_32(0);
+			f->store_buffer(raw.ptr(), raw.size());
 		}
 	}
 
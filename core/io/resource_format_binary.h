@@ -43,6 +43,8 @@ class ResourceLoaderBinary {
 	uint32_t ver_format = 0;
 
 	Ref<FileAccess> f;
+	// File the internal resource offsets refer to. `f` points to a decompressed property block while one is parsed.
+	Ref<FileAccess> resource_f;
 
 	uint64_t importmd_ofs = 0;
 
@@ -60,10 +62,12 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		bool load_started = false;
 	};
 
 	bool using_named_scene_ids = false;
 	bool using_uids = false;
+	bool using_compressed_properties = false;
 	String script_class;
 	bool use_sub_threads = false;
 	float *progress = nullptr;
@@ -72,8 +76,13 @@ class ResourceLoaderBinary {
 	struct IntResource {
 		String path;
 		uint64_t offset;
+		bool loaded = false;
 	};
 
+	String sub_resource_id; // When set, only this internal resource and its dependencies are loaded.
+	int loaded_count = 0;
+	int loading_index = 0; // Internal resource whose properties are being parsed.
+
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
@@ -89,6 +98,8 @@ class ResourceLoaderBinary {
 	friend class ResourceFormatLoaderBinary;
 
 	Error parse_variant(Variant &r_v);
+	Error _start_external_load(int p_index);
+	Error _load_internal_resource(int p_index);
 
 	HashMap<String, Ref<Resource>> dependency_cache;
 
@@ -118,6 +129,7 @@ public:
 	virtual void get_classes_used(const String &p_path, HashSet<StringName> *r_classes) override;
 	virtual ResourceUID::ID get_resource_uid(const String &p_path) const override;
 	virtual bool has_custom_uid_support() const override;
+	virtual bool recognize_path(const String &p_path, const String &p_for_type = String()) const override;
 	virtual void get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types = false) override;
 	virtual Error rename_dependencies(const String &p_path, const HashMap<String, String> &p_map) override;
 };
@@ -131,6 +143,7 @@ class ResourceFormatSaverBinaryInstance {
 	bool skip_editor;
 	bool big_endian;
 	bool takeover_paths;
+	bool compress_properties;
 	String magic;
 	HashSet<Ref<Resource>> resource_set;
 
@@ -169,6 +182,7 @@ public:
 		FORMAT_FLAG_UIDS = 2,
 		FORMAT_FLAG_REAL_T_IS_DOUBLE = 4,
 		FORMAT_FLAG_HAS_SCRIPT_CLASS = 8,
+		FORMAT_FLAG_COMPRESSED_PROPERTIES = 16,
 
 		// Amount of reserved 32-bit fields in resource header
 		RESERVED_FIELDS = 11
@@ -42,6 +42,7 @@
 #include "core/string/print_string.h"
 #include "core/string/translation_server.h"
 #include "core/templates/rb_set.h"
+#include "core/templates/sort_array.h"
 #include "core/variant/variant_parser.h"
 #include "servers/rendering_server.h"
 
@@ -410,6 +411,8 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	} else {
 		load_task.status = THREAD_LOAD_LOADED;
 	}
+	// The task may be gone once the token is released below, so keep what the load graph needs.
+	String load_graph_path = load_task.notify_load_graph ? load_task.local_path : String();
 
 	if (load_task.cond_var && load_task.need_wait) {
 		load_task.cond_var->notify_all();
@@ -501,6 +504,10 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	}
 
 	curr_load_task = curr_load_task_backup;
+
+	if (!load_graph_path.is_empty()) {
+		_load_graph_task_finished(load_graph_path);
+	}
 }
 
 String ResourceLoader::_validate_local_path(const String &p_path) {
@@ -651,6 +658,8 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			} else {
 				load_task_ptr->thread_id = Thread::get_caller_id();
 			}
+		} else if (p_thread_mode == LOAD_THREAD_DEFERRED) {
+			load_task_ptr->deferred = true;
 		} else {
 			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_task, load_task_ptr);
 		}
@@ -775,6 +784,441 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 	return res;
 }
 
+Error ResourceLoader::load_threaded_request_graph(const String &p_path, const String &p_type_hint, int p_priority, ResourceFormatLoader::CacheMode p_cache_mode) {
+	// Prefetching dependencies only pays off if the root load is going to take them from the cache.
+	bool prefetch = p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE || p_cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE;
+	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, prefetch ? LOAD_THREAD_DEFERRED : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, true);
+	if (token.is_null()) {
+		return FAILED;
+	}
+	if (!prefetch) {
+		return OK;
+	}
+
+	LoadGraphRequest *request = memnew(LoadGraphRequest);
+	request->load_token = token;
+	request->local_path = _validate_local_path(p_path);
+	request->type_hint = p_type_hint;
+	request->priority = p_priority;
+
+	MutexLock lock(load_graph_mutex);
+	for (uint32_t i = 0; i < load_graph_discovery_tasks.size();) {
+		if (WorkerThreadPool::get_singleton()->is_task_completed(load_graph_discovery_tasks[i])) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(load_graph_discovery_tasks[i]);
+			load_graph_discovery_tasks.remove_at_unordered(i);
+		} else {
+			i++;
+		}
+	}
+	load_graph_requests.push_back(request);
+	load_graph_discovery_tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_graph_discovery, request));
+	return OK;
+}
+
+void ResourceLoader::load_threaded_set_priority(const String &p_path, int p_priority) {
+	String local_path = _validate_local_path(p_path);
+
+	MutexLock lock(load_graph_mutex);
+	for (LoadGraphRequest *request : load_graph_requests) {
+		if (request->local_path == local_path) {
+			request->priority = p_priority;
+		}
+	}
+
+	LoadGraphNode *root = load_graph_nodes.getptr(local_path);
+	if (!root) {
+		return;
+	}
+
+	// Dependencies shared with other requests keep the highest priority asked for.
+	HashSet<LoadGraphNode *> visited;
+	LocalVector<LoadGraphNode *> stack;
+	stack.push_back(root);
+	while (!stack.is_empty()) {
+		LoadGraphNode *node = stack[stack.size() - 1];
+		stack.resize(stack.size() - 1);
+		if (node->state == LoadGraphNode::STATE_DONE || visited.has(node)) {
+			continue;
+		}
+		visited.insert(node);
+		node->priority = (node == root || node->request_count <= 1) ? p_priority : MAX(node->priority, p_priority);
+		for (LoadGraphNode *dependency : node->dependencies) {
+			stack.push_back(dependency);
+		}
+	}
+
+	SortArray<LoadGraphNode *, LoadGraphNodeSort> sorter;
+	sorter.make_heap(0, load_graph_queue.size(), load_graph_queue.ptr());
+}
+
+void ResourceLoader::_load_graph_get_dependencies(const String &p_local_path, LocalVector<String> &r_dependencies, HashMap<String, String> &r_types) {
+	List<String> dependencies;
+	get_dependencies(p_local_path, &dependencies, true);
+	for (const String &E : dependencies) {
+		// Entries are "path::type", where the path may be an UID followed by a fallback path.
+		Vector<String> parts = E.split("::");
+		String path = parts[0];
+		if (path.begins_with("uid://")) {
+			ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(path);
+			if (ResourceUID::get_singleton()->has_id(uid)) {
+				path = ResourceUID::get_singleton()->get_id_path(uid);
+			} else if (parts.size() > 2) {
+				path = parts[2];
+			} else {
+				continue;
+			}
+		}
+
+		String local_path = _validate_local_path(path);
+		if (!exists(local_path)) {
+			continue; // Reported by the loader of the dependent resource.
+		}
+		r_dependencies.push_back(local_path);
+		if (parts.size() > 1 && !parts[1].is_empty()) {
+			r_types[local_path] = parts[1];
+		}
+	}
+}
+
+void ResourceLoader::_run_load_graph_discovery(void *p_userdata) {
+	LoadGraphRequest *request = (LoadGraphRequest *)p_userdata;
+
+	// Walk the whole dependency graph before loading anything, reading only resource headers.
+	// Cached resources and the ones already scheduled end the walk. Edges back into the path
+	// being walked are cyclic references, which the loaders resolve on their own, so they are dropped.
+	HashMap<String, LocalVector<String>> found_dependencies;
+	HashMap<String, String> found_types;
+	{
+		struct Frame {
+			String local_path;
+			LocalVector<String> dependencies;
+			uint32_t next = 0;
+		};
+		LocalVector<Frame> stack;
+		HashSet<String> in_stack;
+
+		bool scheduled = false;
+		{
+			MutexLock lock(load_graph_mutex);
+			scheduled = load_graph_nodes.has(request->local_path);
+		}
+		if (!scheduled && !ResourceCache::has(request->local_path)) {
+			Frame frame;
+			frame.local_path = request->local_path;
+			_load_graph_get_dependencies(frame.local_path, frame.dependencies, found_types);
+			found_dependencies.insert(frame.local_path, LocalVector<String>());
+			in_stack.insert(frame.local_path);
+			stack.push_back(frame);
+		}
+
+		while (!stack.is_empty()) {
+			Frame &frame = stack[stack.size() - 1];
+			if (frame.next == frame.dependencies.size()) {
+				in_stack.erase(frame.local_path);
+				stack.resize(stack.size() - 1);
+				continue;
+			}
+
+			const String dependency = frame.dependencies[frame.next++];
+			if (in_stack.has(dependency) || ResourceCache::has(dependency)) {
+				continue;
+			}
+			found_dependencies[frame.local_path].push_back(dependency);
+			if (found_dependencies.has(dependency)) {
+				continue;
+			}
+			found_dependencies.insert(dependency, LocalVector<String>());
+
+			{
+				MutexLock lock(load_graph_mutex);
+				scheduled = load_graph_nodes.has(dependency);
+			}
+			if (!scheduled) {
+				Frame dependency_frame;
+				dependency_frame.local_path = dependency;
+				_load_graph_get_dependencies(dependency, dependency_frame.dependencies, found_types);
+				in_stack.insert(dependency);
+				stack.push_back(dependency_frame);
+			}
+		}
+	}
+
+	LocalVector<Ref<LoadToken>> released_tokens;
+	{
+		MutexLock lock(load_graph_mutex);
+		load_graph_requests.erase(request);
+
+		if (!load_graph_cleaning) {
+			LocalVector<LoadGraphNode *> created;
+			bool node_created = false;
+			LoadGraphNode *root = _load_graph_get_node(request->local_path, request->type_hint, &node_created);
+			if (node_created) {
+				created.push_back(root);
+			}
+			for (const KeyValue<String, LocalVector<String>> &E : found_dependencies) {
+				node_created = false;
+				const String *type_hint = found_types.getptr(E.key);
+				LoadGraphNode *node = _load_graph_get_node(E.key, type_hint ? *type_hint : String(), &node_created);
+				if (node_created) {
+					created.push_back(node);
+				}
+			}
+
+			// Nodes scheduled by other requests already have their edges.
+			for (LoadGraphNode *node : created) {
+				node->priority = request->priority;
+				const LocalVector<String> *dependencies = found_dependencies.getptr(node->local_path);
+				if (!dependencies) {
+					continue;
+				}
+				for (const String &dependency_path : *dependencies) {
+					const String *type_hint = found_types.getptr(dependency_path);
+					LoadGraphNode *dependency = _load_graph_get_node(dependency_path, type_hint ? *type_hint : String());
+					node->dependencies.push_back(dependency);
+					if (dependency->state != LoadGraphNode::STATE_DONE) {
+						node->pending_dependencies++;
+						dependency->dependents.push_back(node);
+					}
+				}
+			}
+
+			if (root->state == LoadGraphNode::STATE_WAITING || root->state == LoadGraphNode::STATE_QUEUED) {
+				if (root->load_token.is_null()) {
+					root->load_token = request->load_token;
+					root->user_request = true;
+				}
+			} else {
+				MutexLock thread_load_lock(thread_load_mutex);
+				ThreadLoadTask *load_task = thread_load_tasks.getptr(request->load_token->local_path);
+				if (load_task) {
+					_load_start_deferred(*load_task);
+				}
+			}
+
+			// Everything the root needs is kept alive until the root is loaded.
+			LocalVector<LoadGraphNode *> request_nodes;
+			HashSet<LoadGraphNode *> visited;
+			LocalVector<LoadGraphNode *> stack;
+			stack.push_back(root);
+			bool reorder = false;
+			while (!stack.is_empty()) {
+				LoadGraphNode *node = stack[stack.size() - 1];
+				stack.resize(stack.size() - 1);
+				if (visited.has(node)) {
+					continue;
+				}
+				visited.insert(node);
+				node->request_count++;
+				request_nodes.push_back(node);
+
+				if (request->priority > node->priority) {
+					node->priority = request->priority;
+					reorder = reorder || node->state == LoadGraphNode::STATE_QUEUED;
+				}
+				if (node->state == LoadGraphNode::STATE_WAITING && node->pending_dependencies == 0) {
+					_load_graph_enqueue(node);
+				}
+				if (node->state != LoadGraphNode::STATE_DONE) {
+					for (LoadGraphNode *dependency : node->dependencies) {
+						stack.push_back(dependency);
+					}
+				}
+			}
+			if (reorder) {
+				SortArray<LoadGraphNode *, LoadGraphNodeSort> sorter;
+				sorter.make_heap(0, load_graph_queue.size(), load_graph_queue.ptr());
+			}
+
+			if (root->state == LoadGraphNode::STATE_DONE) {
+				_load_graph_finish_request(request_nodes, released_tokens);
+			} else {
+				for (LoadGraphNode *node : request_nodes) {
+					root->request_nodes.push_back(node);
+				}
+			}
+
+			_load_graph_pump(released_tokens);
+		}
+	}
+
+	memdelete(request);
+}
+
+ResourceLoader::LoadGraphNode *ResourceLoader::_load_graph_get_node(const String &p_local_path, const String &p_type_hint, bool *r_created) {
+	HashMap<String, LoadGraphNode>::Iterator E = load_graph_nodes.find(p_local_path);
+	if (!E) {
+		LoadGraphNode node;
+		node.local_path = p_local_path;
+		node.type_hint = p_type_hint;
+		node.order = load_graph_order++;
+		E = load_graph_nodes.insert(p_local_path, node);
+		if (r_created) {
+			*r_created = true;
+		}
+	}
+	return &E->value;
+}
+
+void ResourceLoader::_load_graph_enqueue(LoadGraphNode *p_node) {
+	p_node->state = LoadGraphNode::STATE_QUEUED;
+	load_graph_queue.push_back(p_node);
+	SortArray<LoadGraphNode *, LoadGraphNodeSort> sorter;
+	sorter.push_heap(0, load_graph_queue.size() - 1, 0, p_node, load_graph_queue.ptr());
+}
+
+void ResourceLoader::_load_graph_pump(LocalVector<Ref<LoadToken>> &r_released_tokens) {
+	// Keeping about one load per worker thread in flight lets the queue order decide what loads next.
+	const uint32_t max_running = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count());
+
+	SortArray<LoadGraphNode *, LoadGraphNodeSort> sorter;
+	while (!load_graph_cleaning && load_graph_running < max_running && !load_graph_queue.is_empty()) {
+		sorter.pop_heap(0, load_graph_queue.size(), load_graph_queue.ptr());
+		LoadGraphNode *node = load_graph_queue[load_graph_queue.size() - 1];
+		load_graph_queue.resize(load_graph_queue.size() - 1);
+
+		if (_load_graph_start_node(node, r_released_tokens)) {
+			load_graph_running++;
+		} else {
+			_load_graph_node_done(node, r_released_tokens);
+		}
+	}
+}
+
+// Returns false if there's nothing to wait for, because the resource is loaded already or can't be loaded.
+bool ResourceLoader::_load_graph_start_node(LoadGraphNode *p_node, LocalVector<Ref<LoadToken>> &r_released_tokens) {
+	if (p_node->load_token.is_null()) {
+		p_node->load_token = _load_start(p_node->local_path, p_node->type_hint, LOAD_THREAD_SPAWN_SINGLE, ResourceFormatLoader::CACHE_MODE_REUSE);
+		if (p_node->load_token.is_null()) {
+			return false;
+		}
+	}
+
+	bool started = false;
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+		LoadToken *load_token = p_node->load_token.ptr();
+		ThreadLoadTask *load_task = load_token->task_if_unregistered ? load_token->task_if_unregistered : thread_load_tasks.getptr(load_token->local_path);
+		if (load_task && load_task->status == THREAD_LOAD_IN_PROGRESS) {
+			_load_start_deferred(*load_task);
+			load_task->notify_load_graph = true;
+			started = true;
+		}
+	}
+
+	if (p_node->user_request) {
+		// The user token keeps the load alive until it's collected. Holding it here too could make the graph
+		// drop the last reference from the task that runs the load, which can't await itself.
+		r_released_tokens.push_back(p_node->load_token);
+		p_node->load_token.unref();
+	}
+
+	if (started) {
+		p_node->state = LoadGraphNode::STATE_LOADING;
+	}
+	return started;
+}
+
+void ResourceLoader::_load_graph_node_done(LoadGraphNode *p_node, LocalVector<Ref<LoadToken>> &r_released_tokens) {
+	p_node->state = LoadGraphNode::STATE_DONE;
+	for (LoadGraphNode *dependent : p_node->dependents) {
+		DEV_ASSERT(dependent->pending_dependencies > 0);
+		dependent->pending_dependencies--;
+		if (dependent->pending_dependencies == 0 && dependent->state == LoadGraphNode::STATE_WAITING) {
+			_load_graph_enqueue(dependent);
+		}
+	}
+	p_node->dependents.reset();
+	p_node->dependencies.reset();
+
+	if (!p_node->request_nodes.is_empty()) {
+		LocalVector<LoadGraphNode *> request_nodes = p_node->request_nodes;
+		p_node->request_nodes.reset();
+		_load_graph_finish_request(request_nodes, r_released_tokens);
+	}
+}
+
+void ResourceLoader::_load_graph_finish_request(const LocalVector<LoadGraphNode *> &p_nodes, LocalVector<Ref<LoadToken>> &r_released_tokens) {
+	LocalVector<LoadGraphNode *> unused;
+	for (LoadGraphNode *node : p_nodes) {
+		DEV_ASSERT(node->request_count > 0);
+		node->request_count--;
+		if (node->request_count == 0) {
+			unused.push_back(node);
+		}
+	}
+
+	// The root is loaded, so from now on it's the one keeping its dependencies alive.
+	for (LoadGraphNode *node : unused) {
+		DEV_ASSERT(node->state == LoadGraphNode::STATE_DONE);
+		if (node->load_token.is_valid()) {
+			r_released_tokens.push_back(node->load_token);
+		}
+		load_graph_nodes.erase(node->local_path);
+	}
+}
+
+void ResourceLoader::_load_graph_task_finished(const String &p_local_path) {
+	// Tokens are released once the lock is, since dropping the last reference to one may await its task.
+	LocalVector<Ref<LoadToken>> released_tokens;
+	MutexLock lock(load_graph_mutex);
+
+	LoadGraphNode *node = load_graph_nodes.getptr(p_local_path);
+	if (!node || node->state != LoadGraphNode::STATE_LOADING) {
+		return;
+	}
+	load_graph_running--;
+	if (load_graph_idle_waiting && load_graph_running == 0) {
+		load_graph_idle_waiting = false;
+		load_graph_idle_semaphore.post();
+	}
+	_load_graph_node_done(node, released_tokens);
+	_load_graph_pump(released_tokens);
+}
+
+void ResourceLoader::_load_graph_clear() {
+	LocalVector<WorkerThreadPool::TaskID> discovery_tasks;
+	{
+		MutexLock lock(load_graph_mutex);
+		load_graph_cleaning = true;
+		discovery_tasks = load_graph_discovery_tasks;
+		load_graph_discovery_tasks.clear();
+	}
+	for (WorkerThreadPool::TaskID task_id : discovery_tasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	}
+
+	LocalVector<Ref<LoadToken>> released_tokens;
+	MutexLock lock(load_graph_mutex);
+
+	// Loads already started can't be cancelled, but nothing else will be started.
+	// The last of them to finish posts the semaphore, only while this is waiting on it.
+	if (load_graph_running > 0) {
+		load_graph_idle_waiting = true;
+		lock.temp_unlock();
+		load_graph_idle_semaphore.wait();
+		lock.temp_relock();
+	}
+	DEV_ASSERT(load_graph_running == 0);
+
+	for (KeyValue<String, LoadGraphNode> &E : load_graph_nodes) {
+		if (E.value.load_token.is_valid()) {
+			released_tokens.push_back(E.value.load_token);
+		}
+	}
+	load_graph_nodes.clear();
+	load_graph_queue.clear();
+	load_graph_cleaning = false;
+}
+
+// Must be called with thread_load_mutex locked.
+void ResourceLoader::_load_start_deferred(ThreadLoadTask &p_load_task) {
+	if (!p_load_task.deferred) {
+		return;
+	}
+	p_load_task.deferred = false;
+	p_load_task.task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_task, &p_load_task);
+}
+
 Ref<Resource> ResourceLoader::_load_complete(LoadToken &p_load_token, Error *r_error) {
 	MutexLock thread_load_lock(thread_load_mutex);
 	return _load_complete_inner(p_load_token, r_error, thread_load_lock);
@@ -802,6 +1246,20 @@ Ref<Resource> ResourceLoader::_load_complete_inner(LoadToken &p_load_token, Erro
 
 		ThreadLoadTask &load_task = thread_load_tasks[p_load_token.local_path];
 
+		if (load_task.deferred) {
+			// The load graph has not started this one yet, but it's needed now.
+			if (WorkerThreadPool::get_singleton()->get_caller_task_id() != WorkerThreadPool::INVALID_TASK_ID) {
+				// Keep loads in pool tasks initiated by the engine; just start it and await it as usual.
+				_load_start_deferred(load_task);
+			} else {
+				load_task.deferred = false;
+				load_task.thread_id = Thread::get_caller_id();
+				p_thread_load_lock.temp_unlock();
+				_run_load_task(&load_task);
+				p_thread_load_lock.temp_relock();
+			}
+		}
+
 		if (load_task.status == THREAD_LOAD_IN_PROGRESS) {
 			DEV_ASSERT((load_task.task_id == 0) != (load_task.thread_id == 0));
 
@@ -1382,6 +1840,8 @@ void ResourceLoader::clear_translation_remaps() {
 void ResourceLoader::clear_thread_load_tasks() {
 	// Bring the thing down as quickly as possible without causing deadlocks or leaks.
 
+	_load_graph_clear();
+
 	MutexLock thread_load_lock(thread_load_mutex);
 	cleaning_tasks = true;
 
@@ -1389,6 +1849,16 @@ void ResourceLoader::clear_thread_load_tasks() {
 		bool none_running = true;
 		if (thread_load_tasks.size()) {
 			for (KeyValue<String, ResourceLoader::ThreadLoadTask> &E : thread_load_tasks) {
+				if (E.value.deferred) {
+					// Nothing will start it anymore.
+					E.value.deferred = false;
+					E.value.status = THREAD_LOAD_FAILED;
+					if (E.value.cond_var && E.value.need_wait) {
+						E.value.cond_var->notify_all();
+					}
+					E.value.need_wait = false;
+					continue;
+				}
 				if (E.value.status == THREAD_LOAD_IN_PROGRESS) {
 					if (E.value.cond_var && E.value.need_wait) {
 						E.value.cond_var->notify_all();
@@ -1601,6 +2071,17 @@ bool ResourceLoader::cleaning_tasks = false;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
+Mutex ResourceLoader::load_graph_mutex;
+HashMap<String, ResourceLoader::LoadGraphNode> ResourceLoader::load_graph_nodes;
+LocalVector<ResourceLoader::LoadGraphNode *> ResourceLoader::load_graph_queue;
+LocalVector<ResourceLoader::LoadGraphRequest *> ResourceLoader::load_graph_requests;
+LocalVector<WorkerThreadPool::TaskID> ResourceLoader::load_graph_discovery_tasks;
+uint64_t ResourceLoader::load_graph_order = 0;
+uint32_t ResourceLoader::load_graph_running = 0;
+bool ResourceLoader::load_graph_cleaning = false;
+bool ResourceLoader::load_graph_idle_waiting = false;
+Semaphore ResourceLoader::load_graph_idle_semaphore;
+
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
 HashMap<String, String> ResourceLoader::path_remaps;
@@ -105,6 +105,7 @@ typedef void (*ResourceLoadedCallback)(Ref<Resource> p_resource, const String &p
 class ResourceLoader {
 	friend class LoadToken;
 	friend class CoreBind::ResourceLoader;
+	friend class TestResourceLoaderInternalsAccessor;
 
 	enum {
 		MAX_LOADERS = 64
@@ -124,6 +125,7 @@ public:
 		LOAD_THREAD_FROM_CURRENT,
 		LOAD_THREAD_SPAWN_SINGLE,
 		LOAD_THREAD_DISTRIBUTE,
+		LOAD_THREAD_DEFERRED, // Registered, but only started by the load graph scheduler or whoever awaits it first.
 	};
 
 	struct LoadToken : public RefCounted {
@@ -192,6 +194,8 @@ private:
 		Error error = OK;
 		Ref<Resource> resource;
 		bool use_sub_threads = false;
+		bool deferred = false; // Started with LOAD_THREAD_DEFERRED and not run yet.
+		bool notify_load_graph = false; // The load graph scheduler is tracking this load.
 		HashSet<String> sub_tasks;
 
 		struct ResourceChangedConnection {
@@ -218,6 +222,64 @@ private:
 
 	static HashMap<String, LoadToken *> user_load_tokens;
 
+	struct LoadGraphNode {
+		enum State {
+			STATE_WAITING, // Some dependencies are not loaded yet.
+			STATE_QUEUED,
+			STATE_LOADING,
+			STATE_DONE,
+		};
+
+		String local_path;
+		String type_hint;
+		State state = STATE_WAITING;
+		int priority = 0;
+		uint64_t order = 0; // Among equal priorities, what was requested first loads first.
+		uint32_t pending_dependencies = 0;
+		uint32_t request_count = 0;
+		bool user_request = false; // The token belongs to a user request for this path.
+		LocalVector<LoadGraphNode *> dependencies;
+		LocalVector<LoadGraphNode *> dependents;
+		LocalVector<LoadGraphNode *> request_nodes; // Only on roots. Nodes kept alive until the root is loaded.
+		Ref<LoadToken> load_token;
+	};
+
+	struct LoadGraphNodeSort {
+		_FORCE_INLINE_ bool operator()(const LoadGraphNode *p_a, const LoadGraphNode *p_b) const { // Returns true when A should load after B.
+			return p_a->priority < p_b->priority || (p_a->priority == p_b->priority && p_a->order > p_b->order);
+		}
+	};
+
+	struct LoadGraphRequest {
+		Ref<LoadToken> load_token;
+		String local_path;
+		String type_hint;
+		int priority = 0;
+	};
+
+	static Mutex load_graph_mutex;
+	static HashMap<String, LoadGraphNode> load_graph_nodes;
+	static LocalVector<LoadGraphNode *> load_graph_queue; // Binary heap of nodes whose dependencies are loaded.
+	static LocalVector<LoadGraphRequest *> load_graph_requests; // Still discovering their dependencies.
+	static LocalVector<WorkerThreadPool::TaskID> load_graph_discovery_tasks;
+	static uint64_t load_graph_order;
+	static uint32_t load_graph_running;
+	static bool load_graph_cleaning;
+	static bool load_graph_idle_waiting; // Clearing is waiting for the running loads to finish.
+	static Semaphore load_graph_idle_semaphore; // Posted when the last running load finishes while clearing waits for it.
+
+	static void _run_load_graph_discovery(void *p_userdata);
+	static void _load_graph_get_dependencies(const String &p_local_path, LocalVector<String> &r_dependencies, HashMap<String, String> &r_types);
+	static LoadGraphNode *_load_graph_get_node(const String &p_local_path, const String &p_type_hint, bool *r_created = nullptr);
+	static void _load_graph_enqueue(LoadGraphNode *p_node);
+	static void _load_graph_pump(LocalVector<Ref<LoadToken>> &r_released_tokens);
+	static bool _load_graph_start_node(LoadGraphNode *p_node, LocalVector<Ref<LoadToken>> &r_released_tokens);
+	static void _load_graph_node_done(LoadGraphNode *p_node, LocalVector<Ref<LoadToken>> &r_released_tokens);
+	static void _load_graph_finish_request(const LocalVector<LoadGraphNode *> &p_nodes, LocalVector<Ref<LoadToken>> &r_released_tokens);
+	static void _load_graph_task_finished(const String &p_local_path);
+	static void _load_graph_clear();
+	static void _load_start_deferred(ThreadLoadTask &p_load_task);
+
 	static float _dependency_get_progress(const String &p_path);
 
 	static bool _ensure_load_progress();
@@ -228,6 +290,8 @@ public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static Error load_threaded_request_graph(const String &p_path, const String &p_type_hint = "", int p_priority = 0, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
+	static void load_threaded_set_priority(const String &p_path, int p_priority);
 
 	static bool is_within_load() { return load_nesting > 0; }
 
@@ -382,6 +382,51 @@ public:
 		return params.result_count_overall;
 	}
 
+	// Culls a batch of segments in packets of BVHTREE_CLASS::SEGMENT_PACKET_SIZE. Each segment gets p_result_max
+	// entries in the result arrays, and its hit count in r_result_counts.
+	// This doesn't lock, so it can be called from several threads at once. When the BVH is thread safe,
+	// surround the batch with lock_culling() / unlock_culling() so it can't be modified meanwhile.
+	int cull_segments(const POINT *p_from, const POINT *p_to, int p_count, T **p_result_array, int p_result_max, int *r_result_counts, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) const {
+		typename BVHTREE_CLASS::CullSegmentsParams params;
+
+		params.result_max = p_result_max;
+		params.tester = p_tester;
+		params.tree_collision_mask = p_tree_collision_mask;
+
+		int total = 0;
+
+		for (int first = 0; first < p_count; first += BVHTREE_CLASS::SEGMENT_PACKET_SIZE) {
+			params.count = MIN(p_count - first, (int)BVHTREE_CLASS::SEGMENT_PACKET_SIZE);
+			params.result_array = p_result_array + first * p_result_max;
+			params.subindex_array = p_subindex_array ? p_subindex_array + first * p_result_max : nullptr;
+
+			for (int n = 0; n < params.count; n++) {
+				params.segments[n].from = p_from[first + n];
+				params.segments[n].to = p_to[first + n];
+			}
+
+			total += tree.cull_segments(params);
+
+			for (int n = 0; n < params.count; n++) {
+				r_result_counts[first + n] = params.result_counts[n];
+			}
+		}
+
+		return total;
+	}
+
+	void lock_culling() {
+		if (BVH_THREAD_SAFE && _thread_safe) {
+			_mutex.lock();
+		}
+	}
+
+	void unlock_culling() {
+		if (BVH_THREAD_SAFE && _thread_safe) {
+			_mutex.unlock();
+		}
+	}
+
 	int cull_point(const POINT &p_point, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
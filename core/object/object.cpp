@@ -1172,6 +1172,65 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+// Builds the snapshot for the current connections of p_signal. Connecting appends to slot_map and
+// disconnecting keeps the order of the other slots, so the methods resolved for p_previous are reused
+// for the slots it already had, and only new ones are looked up in ClassDB.
+Object::SignalData::Snapshot *Object::_build_signal_snapshot(const SignalData &p_signal, const SignalData::Snapshot *p_previous) {
+	if (p_signal.slot_map.is_empty()) {
+		return nullptr;
+	}
+
+	SignalData::Snapshot *snapshot = memnew(SignalData::Snapshot);
+	snapshot->refcount.init();
+	snapshot->entries.resize(p_signal.slot_map.size());
+
+	uint32_t index = 0;
+	uint32_t previous_index = 0;
+	const uint32_t previous_count = p_previous ? p_previous->entries.size() : 0;
+	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : p_signal.slot_map) {
+		SignalData::Snapshot::Entry &entry = snapshot->entries[index++];
+		entry.callable = slot_kv.value.conn.callable;
+		entry.flags = slot_kv.value.conn.flags;
+
+		// Skip the slot that was disconnected, if any.
+		while (previous_index < previous_count && p_previous->entries[previous_index].callable != entry.callable) {
+			previous_index++;
+		}
+		if (previous_index < previous_count) {
+			entry.method = p_previous->entries[previous_index++].method;
+			continue;
+		}
+
+		// Plain object/method callables can skip the method lookup on every call. Extension classes
+		// are left out, since their methods can be replaced when the extension is reloaded.
+		if (entry.callable.is_custom() || entry.callable.get_method() == CoreStringName(free_)) {
+			continue;
+		}
+		Object *target = entry.callable.get_object();
+		if (target && !target->_extension) {
+			entry.method = ClassDB::get_method(target->get_class_name(), entry.callable.get_method());
+		}
+	}
+
+	return snapshot;
+}
+
+// Validated calls skip argument conversion, but need exactly the declared argument types.
+// Object, Array and Dictionary arguments are left to the regular call, which checks their class
+// or element types.
+static bool _can_validated_call_signal_method(const MethodBind *p_method, const Variant **p_args, int p_argcount) {
+	if (p_method->is_vararg() || p_method->has_return() || p_method->get_argument_count() != p_argcount) {
+		return false;
+	}
+	for (int i = 0; i < p_argcount; i++) {
+		const Variant::Type type = p_args[i]->get_type();
+		if (type == Variant::OBJECT || type == Variant::ARRAY || type == Variant::DICTIONARY || type != p_method->get_argument_type(i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
@@ -1194,29 +1253,25 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	// Ensure that disconnecting the signal or even deleting the object
 	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
+	SignalData::Snapshot *snapshot = s->ref_snapshot();
+	if (!snapshot) {
+		return OK; // No connections left.
 	}
 
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	const uint32_t slot_count = snapshot->entries.size();
+	const SignalData::Snapshot::Entry *slots = snapshot->entries.ptr();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		bool disconnect = slots[i].flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (slots[i].flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
 			disconnect = false;
 		}
 #endif
 		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			_disconnect(p_name, slots[i].callable);
 		}
 	}
 
@@ -1225,17 +1280,54 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Error err = OK;
 
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+		const Callable &callable = slots[i].callable;
+		const uint32_t &flags = slots[i].flags;
+
+		const Variant **args = p_args;
+		int argc = p_argcount;
+
+		if (slots[i].method && !(flags & CONNECT_DEFERRED)) {
+			// Fast path, call the resolved method directly unless a script was attached since.
+			Object *target = ObjectDB::get_instance(callable.get_object_id());
+			if (!target) {
+				// Target might have been deleted during signal callback, this is expected and OK.
+				continue;
+			}
+			if (!target->script_instance) {
+				const MethodBind *method = slots[i].method;
+				Callable::CallError ce;
+				_emitting = true;
+				{
+#ifdef DEBUG_ENABLED
+					_ObjectDebugLock target_lock(target);
+#endif
+					if (_can_validated_call_signal_method(method, args, argc)) {
+						Variant ret;
+						method->validated_call(target, args, &ret);
+					} else {
+						method->call(target, args, argc, ce);
+					}
+				}
+				_emitting = false;
+
+				if (ce.error != Callable::CallError::CALL_OK) {
+#ifdef DEBUG_ENABLED
+					if (flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
+						continue;
+					}
+#endif
+					ERR_PRINT(vformat("Error calling from signal '%s' to callable: %s.", String(p_name), Variant::get_callable_error_text(callable, args, argc, ce)));
+					err = ERR_METHOD_NOT_FOUND;
+				}
+				continue;
+			}
+		}
 
 		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
 		}
 
-		const Variant **args = p_args;
-		int argc = p_argcount;
-
 		if (flags & CONNECT_DEFERRED) {
 			MessageQueue::get_singleton()->push_callablep(callable, args, argc, true);
 		} else {
@@ -1262,8 +1354,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
+	if (snapshot->refcount.unref()) {
+		memdelete(snapshot);
 	}
 
 	return err;
@@ -1479,6 +1571,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->set_snapshot(_build_signal_snapshot(*s, s->snapshot.load(std::memory_order_relaxed)));
 
 	return OK;
 }
@@ -1554,6 +1647,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->set_snapshot(_build_signal_snapshot(*s, s->snapshot.load(std::memory_order_relaxed)));
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -2236,8 +2330,9 @@ void ObjectDB::debug_objects(DebugFunc p_func) {
 	spin_lock.lock();
 
 	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
+		const ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.get_validator()) {
+			p_func(object_slot.object);
 			count--;
 		}
 	}
@@ -2292,8 +2387,8 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 
 SpinLock ObjectDB::spin_lock;
 uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
+std::atomic<uint32_t> ObjectDB::slot_max = 0;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::object_slot_blocks[OBJECTDB_SLOT_BLOCK_COUNT] = {};
 uint64_t ObjectDB::validator_counter = 0;
 
 int ObjectDB::get_object_count() {
@@ -2305,29 +2400,28 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 	if (unlikely(slot_count == slot_max)) {
 		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+		const uint32_t block_start = slot_max;
+		ObjectSlot *block = memnew_arr(ObjectSlot, OBJECTDB_SLOT_BLOCK_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_SLOT_BLOCK_SIZE; i++) {
+			block[i].data = block_start + i;
+			block[i].object = nullptr;
 		}
-		slot_max = new_slot_max;
+		// Publish the block before the slots in it can be looked up.
+		object_slot_blocks[block_start >> OBJECTDB_SLOT_BLOCK_BITS] = block;
+		slot_max = block_start + OBJECTDB_SLOT_BLOCK_SIZE;
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	uint32_t slot = _get_slot(slot_count).get_next_free();
+	ObjectSlot &object_slot = _get_slot(slot);
+	if (object_slot.object != nullptr) {
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+		ERR_FAIL_COND_V(object_slot.object != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
+	object_slot.object = p_object;
 	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
 	if (unlikely(validator_counter == 0)) {
 		validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
 
 	uint64_t id = validator_counter;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
@@ -2337,6 +2431,9 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
+	// Set after the object, see get_instance().
+	object_slot.data = (id & ~OBJECTDB_SLOT_MAX_COUNT_MASK) | object_slot.get_next_free();
+
 	slot_count++;
 
 	spin_lock.unlock();
@@ -2350,17 +2447,19 @@ void ObjectDB::remove_instance(Object *p_object) {
 
 	spin_lock.lock();
 
+	ObjectSlot &object_slot = _get_slot(slot);
+
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
+	if (object_slot.object != p_object) {
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+		ERR_FAIL_COND(object_slot.object != p_object);
 	}
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
+		if (object_slot.get_validator() != validator) {
 			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+			ERR_FAIL_COND(object_slot.get_validator() != validator);
 		}
 	}
 
@@ -2368,11 +2467,10 @@ void ObjectDB::remove_instance(Object *p_object) {
 	//decrease slot count
 	slot_count--;
 	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	_get_slot(slot_count).set_next_free(slot);
+	//invalidate, so checks against it fail; cleared before the object, see get_instance()
+	object_slot.data = object_slot.get_next_free();
+	object_slot.object = nullptr;
 
 	spin_lock.unlock();
 }
@@ -2395,8 +2493,9 @@ void ObjectDB::cleanup() {
 			Callable::CallError call_error;
 
 			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+				const ObjectSlot &object_slot = _get_slot(i);
+				if (object_slot.get_validator()) {
+					Object *obj = object_slot.object;
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2406,7 +2505,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | (object_slot.get_validator() << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slot.is_ref_counted() ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2417,9 +2516,11 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < slot_max; i += OBJECTDB_SLOT_BLOCK_SIZE) {
+		memdelete_arr(object_slot_blocks[i >> OBJECTDB_SLOT_BLOCK_BITS].load());
+		object_slot_blocks[i >> OBJECTDB_SLOT_BLOCK_BITS] = nullptr;
 	}
+	slot_max = 0;
 
 	spin_lock.unlock();
 }
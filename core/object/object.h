@@ -38,6 +38,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/callable_bind.h"
@@ -613,9 +614,53 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Immutable copy of the connections, rebuilt next to every change of slot_map and swapped in atomically.
+		// Each emission holds a reference, so connecting or disconnecting from a callback is safe.
+		struct Snapshot {
+			struct Entry {
+				Callable callable;
+				uint32_t flags = 0;
+				MethodBind *method = nullptr; // Target method of plain object/method callables, resolved once.
+			};
+
+			SafeRefCount refcount;
+			LocalVector<Entry> entries;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		std::atomic<Snapshot *> snapshot{ nullptr }; // Null while there are no connections.
 		bool removable = false;
+
+		static void unref_snapshot(Snapshot *p_snapshot) {
+			if (p_snapshot && p_snapshot->refcount.unref()) {
+				memdelete(p_snapshot);
+			}
+		}
+
+		// Only called where slot_map is changed, emission never builds or drops snapshots.
+		void set_snapshot(Snapshot *p_snapshot) {
+			unref_snapshot(snapshot.exchange(p_snapshot, std::memory_order_acq_rel));
+		}
+
+		Snapshot *ref_snapshot() const {
+			Snapshot *current = snapshot.load(std::memory_order_acquire);
+			if (current) {
+				current->refcount.ref();
+			}
+			return current;
+		}
+
+		SignalData() {}
+		SignalData(const SignalData &p_other) :
+				user(p_other.user), slot_map(p_other.slot_map), snapshot(p_other.ref_snapshot()), removable(p_other.removable) {}
+		void operator=(const SignalData &p_other) {
+			set_snapshot(p_other.ref_snapshot());
+			user = p_other.user;
+			slot_map = p_other.slot_map;
+			removable = p_other.removable;
+		}
+		~SignalData() { set_snapshot(nullptr); }
 	};
 
 	HashMap<StringName, SignalData> signal_map;
@@ -646,6 +691,7 @@ private:
 	bool _has_user_signal(const StringName &p_name) const;
 	void _remove_user_signal(const StringName &p_name);
 	Error _emit_signal(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	static SignalData::Snapshot *_build_signal_snapshot(const SignalData &p_signal, const SignalData::Snapshot *p_previous);
 	TypedArray<Dictionary> _get_signal_list() const;
 	TypedArray<Dictionary> _get_signal_connection_list(const StringName &p_signal) const;
 	TypedArray<Dictionary> _get_incoming_connections() const;
@@ -1031,19 +1077,34 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+	// Slots are allocated in blocks that never move until cleanup, so get_instance() can read them
+	// without taking spin_lock. Adding and removing instances still serializes on it.
+#define OBJECTDB_SLOT_BLOCK_BITS 12
+#define OBJECTDB_SLOT_BLOCK_SIZE (1 << OBJECTDB_SLOT_BLOCK_BITS)
+#define OBJECTDB_SLOT_BLOCK_MASK (OBJECTDB_SLOT_BLOCK_SIZE - 1)
+#define OBJECTDB_SLOT_BLOCK_COUNT (1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_BLOCK_BITS))
+
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		// Same layout as ObjectID, with the next free slot in place of the slot index.
+		std::atomic<uint64_t> data;
+		std::atomic<Object *> object;
+
+		_ALWAYS_INLINE_ uint64_t get_validator() const { return (data.load() >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK; }
+		_ALWAYS_INLINE_ uint32_t get_next_free() const { return data.load() & OBJECTDB_SLOT_MAX_COUNT_MASK; }
+		_ALWAYS_INLINE_ bool is_ref_counted() const { return data.load() & OBJECTDB_REFERENCE_BIT; }
+		_ALWAYS_INLINE_ void set_next_free(uint32_t p_next_free) { data.store((data.load() & ~OBJECTDB_SLOT_MAX_COUNT_MASK) | p_next_free); }
 	};
 
 	static SpinLock spin_lock;
 	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
+	static std::atomic<uint32_t> slot_max;
+	static std::atomic<ObjectSlot *> object_slot_blocks[OBJECTDB_SLOT_BLOCK_COUNT];
 	static uint64_t validator_counter;
 
+	_ALWAYS_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return object_slot_blocks[p_slot >> OBJECTDB_SLOT_BLOCK_BITS].load()[p_slot & OBJECTDB_SLOT_BLOCK_MASK];
+	}
+
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
@@ -1061,20 +1122,23 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ERR_FAIL_COND_V(slot >= slot_max.load(), nullptr); // This should never happen unless RID is corrupted.
 
+		const ObjectSlot &object_slot = _get_slot(slot);
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely(object_slot.get_validator() != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load();
 
-		spin_lock.unlock();
+		// Removing an instance clears the validator before the object, and adding one sets the object
+		// before the validator. If the slot was freed or reused while the object was read, the
+		// validator no longer matches.
+		if (unlikely(object_slot.get_validator() != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
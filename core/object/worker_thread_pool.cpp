@@ -88,39 +88,45 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 #endif
 
 	if (p_task->group) {
-		// Handling a group
-		bool do_post = false;
+		if (p_task->group->min_chunk) {
+			// Handling a range group; completion is posted by whoever finishes the last range.
+			_process_group_ranges(p_task->group);
+		} else {
+			// Handling a group
+			bool do_post = false;
 
-		while (true) {
-			uint32_t work_index = p_task->group->index.postincrement();
+			while (true) {
+				uint32_t work_index = p_task->group->index.postincrement();
 
-			if (work_index >= p_task->group->max) {
-				break;
-			}
-			if (p_task->native_group_func) {
-				p_task->native_group_func(p_task->native_func_userdata, work_index);
-			} else if (p_task->template_userdata) {
-				p_task->template_userdata->callback_indexed(work_index);
-			} else {
-				p_task->callable.call(work_index);
-			}
+				if (work_index >= p_task->group->max) {
+					break;
+				}
+				if (p_task->native_group_func) {
+					p_task->native_group_func(p_task->native_func_userdata, work_index);
+				} else if (p_task->template_userdata) {
+					p_task->template_userdata->callback_indexed(work_index);
+				} else {
+					p_task->callable.call(work_index);
+				}
 
-			// This is the only way to ensure posting is done when all tasks are really complete.
-			uint32_t completed_amount = p_task->group->completed_index.increment();
+				// This is the only way to ensure posting is done when all tasks are really complete.
+				uint32_t completed_amount = p_task->group->completed_index.increment();
 
-			if (completed_amount == p_task->group->max) {
-				do_post = true;
+				if (completed_amount == p_task->group->max) {
+					do_post = true;
+				}
 			}
-		}
 
-		if (do_post && p_task->template_userdata) {
-			memdelete(p_task->template_userdata); // This is no longer needed at this point, so get rid of it.
-		}
+			if (do_post && p_task->template_userdata) {
+				memdelete(p_task->template_userdata); // This is no longer needed at this point, so get rid of it.
+			}
 
-		if (do_post) {
-			p_task->group->done_semaphore.post();
-			p_task->group->completed.set_to(true);
+			if (do_post) {
+				p_task->group->done_semaphore.post();
+				p_task->group->completed.set_to(true);
+			}
 		}
+
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
 
@@ -180,12 +186,52 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 #endif
 }
 
+void WorkerThreadPool::_process_group_ranges(Group *p_group) {
+	// Guided self-scheduling: claim a fraction of what's left, so early chunks are large
+	// (cheap dispatch) and late ones small (good balance when some threads run out of work).
+	uint32_t participants = p_group->tasks_used + 1; // Including the waiter, which helps.
+
+	while (true) {
+		uint64_t claimed = p_group->range_index.get();
+		if (claimed >= p_group->max) {
+			break;
+		}
+
+		uint32_t remaining = p_group->max - claimed;
+		uint32_t chunk = MAX(p_group->min_chunk, remaining / (participants * 2));
+		uint64_t begin = p_group->range_index.postadd(chunk);
+		if (begin >= p_group->max) {
+			break;
+		}
+		uint32_t end = MIN(begin + chunk, (uint64_t)p_group->max);
+
+		if (p_group->native_range_func) {
+			p_group->native_range_func(p_group->native_func_userdata, begin, end);
+		} else {
+			p_group->template_userdata->callback_range(begin, end);
+		}
+
+		// This is the only way to ensure posting is done when all ranges are really complete.
+		if (p_group->completed_index.add(end - begin) == p_group->max) {
+			if (p_group->template_userdata) {
+				memdelete(p_group->template_userdata); // This is no longer needed at this point, so get rid of it.
+			}
+			p_group->done_semaphore.post();
+			p_group->completed.set_to(true);
+		}
+	}
+}
+
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 
 	while (true) {
 		Task *task_to_process = nullptr;
-		{
+		if (thread_data->pool->work_stealing) {
+			// Fast path: keep going with local or stolen work without touching the mutex.
+			task_to_process = thread_data->pool->_pop_or_steal_task(thread_data);
+		}
+		if (!task_to_process) {
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -199,6 +245,14 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 				thread_data->signaled = false;
 
 				if (!thread_data->pool->task_queue.first()) {
+					if (thread_data->pool->work_stealing) {
+						// Checked under the lock, since that's how pushes and notifications are serialized.
+						task_to_process = thread_data->pool->_pop_or_steal_task(thread_data);
+						if (task_to_process) {
+							break;
+						}
+					}
+
 					// There wasn't a task available yet.
 					// Let's wait for the next notification, then recheck.
 					thread_data->cond_var.wait(lock);
@@ -240,10 +294,17 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
 
+	// In work-stealing mode, pool threads push to their own deque so they can pop their
+	// tasks back without locking and idle threads can steal them. Other threads can't
+	// own a deque, so they keep feeding the shared queue.
+	WorkStealingDeque<Task> *local_tasks = (work_stealing && caller_pool_thread) ? &caller_pool_thread->local_tasks : nullptr;
+
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			if (!local_tasks || !local_tasks->push(p_tasks[i])) {
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -322,6 +383,41 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 	}
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_pop_or_steal_task(ThreadData *p_thread_data) {
+	Task *task = p_thread_data->local_tasks.pop();
+	if (task) {
+		return task;
+	}
+
+	// Steal from the rest, starting at the next thread so victims are spread out.
+	// A steal can fail because another thread won the race for the same item, so
+	// only move on once the victim looks empty. Otherwise, a caller about to sleep
+	// could leave work behind nobody has been notified about.
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		ThreadData &victim = threads[(p_thread_data->index + i) % thread_count];
+		while (!victim.local_tasks.is_empty()) {
+			task = victim.local_tasks.steal();
+			if (task) {
+				return task;
+			}
+		}
+	}
+	return nullptr;
+}
+
+bool WorkerThreadPool::_are_local_tasks_pending() const {
+	if (!work_stealing) {
+		return false;
+	}
+	for (const ThreadData &th : threads) {
+		if (!th.local_tasks.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool WorkerThreadPool::_try_promote_low_priority_task() {
 	if (low_priority_task_queue.first()) {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
@@ -489,7 +585,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || _are_local_tasks_pending()) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -510,6 +606,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 			if (p_caller_pool_thread->pool->task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				task_queue.remove(task_queue.first());
+			} else if (work_stealing) {
+				task_to_process = _pop_or_steal_task(p_caller_pool_thread);
 			}
 
 			if (!task_to_process) {
@@ -555,7 +653,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_are_local_tasks_pending()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -618,18 +716,30 @@ void WorkerThreadPool::notify_yield_over(TaskID p_task_id) {
 	td.cond_var.notify_one();
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void (*p_range_func)(void *, uint32_t, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, int p_min_chunk, bool p_high_priority, const String &p_description) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
 	}
 
+	// A non-zero minimum chunk means this is a range group. Negative asks for an automatic size,
+	// which keeps the smallest chunks big enough to amortize claiming them.
+	const bool is_range = p_min_chunk != 0;
+	if (p_min_chunk < 0) {
+		p_min_chunk = MAX(1, p_elements / (MAX(1, p_tasks) * 32));
+	}
+
 	MutexLock<BinaryMutex> lock(task_mutex);
 
 	Group *group = group_allocator.alloc();
 	GroupID id = last_task++;
 	group->max = p_elements;
 	group->self = id;
+	if (is_range) {
+		group->min_chunk = p_min_chunk;
+		group->native_range_func = p_range_func;
+		group->native_func_userdata = p_userdata;
+	}
 
 	Task **tasks_posted = nullptr;
 	if (p_elements == 0) {
@@ -643,6 +753,13 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 		}
 
 	} else {
+		if (is_range) {
+			// The group owns the callback, so it can be run by the waiter as well.
+			group->template_userdata = p_template_userdata;
+			p_template_userdata = nullptr;
+			// There's no point in more tasks than chunks.
+			p_tasks = MIN(p_tasks, (p_elements + p_min_chunk - 1) / p_min_chunk);
+		}
 		group->tasks_used = p_tasks;
 		tasks_posted = (Task **)alloca(sizeof(Task *) * p_tasks);
 		for (int i = 0; i < p_tasks; i++) {
@@ -666,11 +783,17 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 }
 
 WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+	return _add_group_task(Callable(), p_func, nullptr, p_userdata, nullptr, p_elements, p_tasks, 0, p_high_priority, p_description);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_range_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, int p_elements, int p_tasks, int p_min_chunk, bool p_high_priority, const String &p_description) {
+	ERR_FAIL_NULL_V(p_func, INVALID_TASK_ID);
+	// Zero would turn this into a per-element group.
+	return _add_group_task(Callable(), nullptr, p_func, p_userdata, nullptr, p_elements, p_tasks, p_min_chunk == 0 ? 1 : p_min_chunk, p_high_priority, p_description);
 }
 
 WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_action, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, nullptr, p_elements, p_tasks, 0, p_high_priority, p_description);
 }
 
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
@@ -702,6 +825,11 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 	{
 		Group *group = *groupp;
 
+		if (group->min_chunk) {
+			// Rather than just blocking, help process the group.
+			_process_group_ranges(group);
+		}
+
 		if (this == singleton) {
 			_unlock_unlockable_mutexes();
 		}
@@ -765,7 +893,7 @@ void WorkerThreadPool::thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {
 }
 #endif
 
-void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio) {
+void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio, bool p_work_stealing) {
 	ERR_FAIL_COND(threads.size() > 0);
 
 	runlevel = RUNLEVEL_NORMAL;
@@ -776,7 +904,9 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 
 	max_low_priority_threads = CLAMP(p_thread_count * p_low_priority_task_ratio, 1, p_thread_count - 1);
 
-	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority.", p_thread_count, max_low_priority_threads));
+	work_stealing = p_work_stealing;
+
+	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority%s.", p_thread_count, max_low_priority_threads, work_stealing ? ", work stealing" : ""));
 
 	threads.resize(p_thread_count);
 
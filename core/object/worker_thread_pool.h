@@ -39,6 +39,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -56,6 +57,7 @@ private:
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
 		virtual void callback_indexed(uint32_t p_index) {}
+		virtual void callback_range(uint32_t p_begin, uint32_t p_end) {}
 		virtual ~BaseTemplateUserdata() {}
 	};
 
@@ -68,6 +70,15 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+
+		// Range groups only (min_chunk != 0). Work is claimed in guided chunks:
+		// each claim takes a share of what's left, but never less than min_chunk.
+		// The callback lives here so the waiter can help run the group.
+		uint32_t min_chunk = 0;
+		SafeNumeric<uint64_t> range_index; // 64-bit so concurrent claims past the end can't wrap.
+		void (*native_range_func)(void *, uint32_t, uint32_t) = nullptr;
+		void *native_func_userdata = nullptr;
+		BaseTemplateUserdata *template_userdata = nullptr;
 	};
 
 	struct Task {
@@ -119,6 +130,7 @@ private:
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
+		WorkStealingDeque<Task> local_tasks; // Only used in work-stealing mode. Pushed to only by this thread.
 
 		ThreadData() :
 				signaled(false),
@@ -163,6 +175,7 @@ private:
 	uint32_t max_low_priority_threads = 0;
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; // For rotating across threads, no help distributing load.
+	bool work_stealing = false;
 
 	uint64_t last_task = 1;
 
@@ -177,6 +190,11 @@ private:
 
 	bool _try_promote_low_priority_task();
 
+	void _process_group_ranges(Group *p_group);
+
+	Task *_pop_or_steal_task(ThreadData *p_thread_data);
+	bool _are_local_tasks_pending() const;
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -189,7 +207,7 @@ private:
 #endif
 
 	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void (*p_range_func)(void *, uint32_t, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, int p_min_chunk, bool p_high_priority, const String &p_description);
 
 	template <typename C, typename M, typename U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -211,6 +229,16 @@ private:
 		}
 	};
 
+	template <typename C, typename M, typename U>
+	struct GroupRangeUserData : public BaseTemplateUserdata {
+		C *instance;
+		M method;
+		U userdata;
+		virtual void callback_range(uint32_t p_begin, uint32_t p_end) override {
+			(instance->*method)(p_begin, p_end, userdata);
+		}
+	};
+
 	void _wait_collaboratively(ThreadData *p_caller_pool_thread, Task *p_task);
 
 	void _switch_runlevel(Runlevel p_runlevel);
@@ -252,9 +280,24 @@ public:
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description);
+		return _add_group_task(Callable(), nullptr, nullptr, nullptr, ud, p_elements, p_tasks, 0, p_high_priority, p_description);
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	// Range-based group tasks: the callback receives [p_begin, p_end) ranges instead of single elements,
+	// which amortizes dispatch over cheap per-element work. Chunks shrink as the group runs out of work,
+	// down to p_min_chunk (-1 picks one automatically, 0 is treated as 1). The thread waiting for the group helps process it.
+	template <typename C, typename M, typename U>
+	GroupID add_template_group_range_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, int p_min_chunk = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef GroupRangeUserData<C, M, U> GroupRangeUD;
+		GroupRangeUD *ud = memnew(GroupRangeUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, nullptr, ud, p_elements, p_tasks, p_min_chunk == 0 ? 1 : p_min_chunk, p_high_priority, p_description);
+	}
+	GroupID add_native_group_range_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, int p_min_chunk = -1, bool p_high_priority = false, const String &p_description = String());
+
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
@@ -287,7 +330,9 @@ public:
 	static void thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {}
 #endif
 
-	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3);
+	_FORCE_INLINE_ bool is_work_stealing_enabled() const { return work_stealing; }
+
+	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3, bool p_work_stealing = false);
 	void exit_languages_threads();
 	void finish();
 	WorkerThreadPool(bool p_singleton = true);
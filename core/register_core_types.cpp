@@ -49,6 +49,7 @@
 #include "core/io/http_client.h"
 #include "core/io/image_loader.h"
 #include "core/io/json.h"
+#include "core/io/json_stream.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/io/packed_data_container.h"
@@ -257,6 +258,8 @@ void register_core_types() {
 
 	GDREGISTER_CLASS(XMLParser);
 	GDREGISTER_CLASS(JSON);
+	GDREGISTER_CLASS(JSONReader);
+	GDREGISTER_CLASS(JSONWriter);
 
 	GDREGISTER_CLASS(ConfigFile);
 
@@ -321,6 +324,7 @@ void register_core_settings() {
 
 	GLOBAL_DEF("threading/worker_pool/max_threads", -1);
 	GLOBAL_DEF("threading/worker_pool/low_priority_thread_ratio", 0.3);
+	GLOBAL_DEF("threading/worker_pool/use_work_stealing", false);
 }
 
 void register_early_core_singletons() {
@@ -31,8 +31,43 @@
 #include "string_name.h"
 
 #include "core/os/os.h"
+#include "core/os/rw_lock.h"
 #include "core/string/print_string.h"
 
+// The table buckets are split into shards, each with its own lock. Lookups of existing names only
+// take a shard's read lock, so threads interning names only wait on each other when one of them
+// inserts or releases a name in the same shard.
+static constexpr uint32_t STRING_TABLE_SHARD_BITS = 6;
+static constexpr uint32_t STRING_TABLE_SHARD_COUNT = 1 << STRING_TABLE_SHARD_BITS;
+static constexpr uint32_t STRING_TABLE_SHARD_MASK = STRING_TABLE_SHARD_COUNT - 1;
+
+struct alignas(64) StringNameShard {
+	RWLock lock;
+	SafeNumeric<uint64_t> lookups;
+	SafeNumeric<uint64_t> hits;
+	SafeNumeric<uint64_t> contended;
+};
+
+static StringNameShard string_name_shards[STRING_TABLE_SHARD_COUNT];
+
+static _FORCE_INLINE_ StringNameShard &_get_shard(uint32_t p_idx) {
+	return string_name_shards[p_idx & STRING_TABLE_SHARD_MASK];
+}
+
+static _FORCE_INLINE_ void _shard_read_lock(StringNameShard &p_shard) {
+	if (unlikely(!p_shard.lock.read_try_lock())) {
+		p_shard.contended.increment();
+		p_shard.lock.read_lock();
+	}
+}
+
+static _FORCE_INLINE_ void _shard_write_lock(StringNameShard &p_shard) {
+	if (unlikely(!p_shard.lock.write_try_lock())) {
+		p_shard.contended.increment();
+		p_shard.lock.write_lock();
+	}
+}
+
 StaticCString StaticCString::create(const char *p_ptr) {
 	StaticCString scs;
 	scs.ptr = p_ptr;
@@ -95,10 +130,10 @@ void StringName::cleanup() {
 		int unreferenced_stringnames = 0;
 		int rarely_referenced_stringnames = 0;
 		for (int i = 0; i < data.size(); i++) {
-			print_line(itos(i + 1) + ": " + data[i]->get_name() + " - " + itos(data[i]->debug_references));
-			if (data[i]->debug_references == 0) {
+			print_line(itos(i + 1) + ": " + data[i]->get_name() + " - " + itos(data[i]->debug_references.get()));
+			if (data[i]->debug_references.get() == 0) {
 				unreferenced_stringnames += 1;
-			} else if (data[i]->debug_references < 5) {
+			} else if (data[i]->debug_references.get() < 5) {
 				rarely_referenced_stringnames += 1;
 			}
 		}
@@ -128,6 +163,12 @@ void StringName::cleanup() {
 	if (lost_strings) {
 		print_verbose(vformat("StringName: %d unclaimed string names at exit.", lost_strings));
 	}
+	if (OS::get_singleton()->is_stdout_verbose()) {
+		const TableStats stats = get_table_stats();
+		if (stats.lookups > 0) {
+			print_line(vformat("StringName: %d lookups, %.2f%% hits, %d contended locks.", (int64_t)stats.lookups, stats.hits / double(stats.lookups) * 100, (int64_t)stats.contended));
+		}
+	}
 	configured = false;
 }
 
@@ -135,7 +176,8 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		StringNameShard &shard = _get_shard(_data->idx);
+		_shard_write_lock(shard);
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			if (_data->cname) {
@@ -156,6 +198,7 @@ void StringName::unref() {
 		if (_data->next) {
 			_data->next->prev = _data->prev;
 		}
+		shard.lock.write_unlock();
 		memdelete(_data);
 	}
 
@@ -260,119 +303,112 @@ void StringName::assign_static_unique_class_name(StringName *ptr, const char *p_
 	}
 }
 
-StringName::StringName(const char *p_name, bool p_static) {
-	_data = nullptr;
-
-	ERR_FAIL_COND(!configured);
-
-	if (!p_name || p_name[0] == 0) {
-		return; //empty, ignore
+template <typename T>
+StringName::_Data *StringName::_find_and_ref(uint32_t p_idx, uint32_t p_hash, const T &p_name) {
+	for (_Data *data = _table[p_idx]; data; data = data->next) {
+		// Compare hash first. A name whose last reference is being released fails to ref, and will
+		// be unlinked as soon as the lock is released; keep looking for a live duplicate.
+		if (data->hash == p_hash && data->operator==(p_name) && data->refcount.ref()) {
+#ifdef DEBUG_ENABLED
+			if (unlikely(debug_stringname)) {
+				data->debug_references.increment();
+			}
+#endif
+			return data;
+		}
 	}
+	return nullptr;
+}
 
-	const uint32_t hash = String::hash(p_name);
-	const uint32_t idx = hash & STRING_TABLE_MASK;
-
-	MutexLock lock(mutex);
-	_data = _table[idx];
+template <typename T>
+StringName::_Data *StringName::_intern(uint32_t p_hash, const T &p_name, const char *p_cname, bool p_static) {
+	const uint32_t idx = p_hash & STRING_TABLE_MASK;
+	StringNameShard &shard = _get_shard(idx);
+	shard.lookups.increment();
+
+	_shard_read_lock(shard);
+	_Data *data = _find_and_ref(idx, p_hash, p_name);
+	shard.lock.read_unlock();
+
+	if (!data) {
+		_shard_write_lock(shard);
+		// Another thread may have added the name since the read lock was released.
+		data = _find_and_ref(idx, p_hash, p_name);
+		if (!data) {
+			data = memnew(_Data);
+			if (p_cname) {
+				data->cname = p_cname;
+			} else {
+				data->name = p_name;
+			}
+			data->refcount.init();
+			data->static_count.set(p_static ? 1 : 0);
+			data->hash = p_hash;
+			data->idx = idx;
+			data->next = _table[idx];
+			data->prev = nullptr;
+#ifdef DEBUG_ENABLED
+			if (unlikely(debug_stringname)) {
+				// Keep in memory, force static.
+				data->refcount.ref();
+				data->static_count.increment();
+			}
+#endif
+			if (_table[idx]) {
+				_table[idx]->prev = data;
+			}
+			_table[idx] = data;
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
+			shard.lock.write_unlock();
+			return data;
 		}
-		_data = _data->next;
+		shard.lock.write_unlock();
 	}
 
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
+	// Exists.
+	shard.hits.increment();
+	if (p_static) {
+		data->static_count.increment();
 	}
+	return data;
+}
 
-	_data = memnew(_Data);
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
+template <typename T>
+StringName::_Data *StringName::_search(uint32_t p_hash, const T &p_name) {
+	const uint32_t idx = p_hash & STRING_TABLE_MASK;
+	StringNameShard &shard = _get_shard(idx);
+	shard.lookups.increment();
 
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
+	_shard_read_lock(shard);
+	_Data *data = _find_and_ref(idx, p_hash, p_name);
+	shard.lock.read_unlock();
+
+	if (data) {
+		shard.hits.increment();
 	}
-	_table[idx] = _data;
+	return data;
 }
 
-StringName::StringName(const StaticCString &p_static_string, bool p_static) {
+StringName::StringName(const char *p_name, bool p_static) {
 	_data = nullptr;
 
 	ERR_FAIL_COND(!configured);
 
-	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
-
-	const uint32_t hash = String::hash(p_static_string.ptr);
-	const uint32_t idx = hash & STRING_TABLE_MASK;
+	if (!p_name || p_name[0] == 0) {
+		return; //empty, ignore
+	}
 
-	MutexLock lock(mutex);
-	_data = _table[idx];
+	_data = _intern(String::hash(p_name), p_name, nullptr, p_static);
+}
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_static_string.ptr)) {
-			break;
-		}
-		_data = _data->next;
-	}
+StringName::StringName(const StaticCString &p_static_string, bool p_static) {
+	_data = nullptr;
 
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
+	ERR_FAIL_COND(!configured);
 
-	_data = memnew(_Data);
+	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = p_static_string.ptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_data = _intern(String::hash(p_static_string.ptr), p_static_string.ptr, p_static_string.ptr, p_static);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -384,53 +420,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	const uint32_t hash = p_name.hash();
-	const uint32_t idx = hash & STRING_TABLE_MASK;
-
-	MutexLock lock(mutex);
-	_data = _table[idx];
-
-	while (_data) {
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = memnew(_Data);
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_data = _intern(p_name.hash(), p_name, nullptr, p_static);
 }
 
 StringName StringName::search(const char *p_name) {
@@ -441,31 +431,8 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	const uint32_t hash = String::hash(p_name);
-	const uint32_t idx = hash & STRING_TABLE_MASK;
-
-	MutexLock lock(mutex);
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-
-		return StringName(_data);
-	}
-
-	return StringName(); //does not exist
+	_Data *data = _search(String::hash(p_name), p_name);
+	return data ? StringName(data) : StringName();
 }
 
 StringName StringName::search(const char32_t *p_name) {
@@ -476,54 +443,33 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	const uint32_t hash = String::hash(p_name);
-	const uint32_t idx = hash & STRING_TABLE_MASK;
-
-	MutexLock lock(mutex);
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		return StringName(_data);
-	}
-
-	return StringName(); //does not exist
+	_Data *data = _search(String::hash(p_name), p_name);
+	return data ? StringName(data) : StringName();
 }
 
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	const uint32_t hash = p_name.hash();
-	const uint32_t idx = hash & STRING_TABLE_MASK;
-
-	MutexLock lock(mutex);
-	_Data *_data = _table[idx];
+	_Data *data = _search(p_name.hash(), p_name);
+	return data ? StringName(data) : StringName();
+}
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->operator==(p_name)) {
-			break;
-		}
-		_data = _data->next;
+StringName::TableStats StringName::get_table_stats() {
+	TableStats stats;
+	for (const StringNameShard &shard : string_name_shards) {
+		stats.lookups += shard.lookups.get();
+		stats.hits += shard.hits.get();
+		stats.contended += shard.contended.get();
 	}
+	return stats;
+}
 
-	if (_data && _data->refcount.ref()) {
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return StringName(_data);
+void StringName::reset_table_stats() {
+	for (StringNameShard &shard : string_name_shards) {
+		shard.lookups.set(0);
+		shard.hits.set(0);
+		shard.contended.set(0);
 	}
-
-	return StringName(); //does not exist
 }
 
 bool operator==(const String &p_name, const StringName &p_string_name) {
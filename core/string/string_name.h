@@ -56,7 +56,7 @@ class StringName {
 		const char *cname = nullptr;
 		String name;
 #ifdef DEBUG_ENABLED
-		uint32_t debug_references = 0;
+		SafeNumeric<uint32_t> debug_references;
 #endif
 		String get_name() const { return cname ? String(cname) : name; }
 		bool operator==(const String &p_name) const;
@@ -76,6 +76,12 @@ class StringName {
 	_Data *_data = nullptr;
 
 	void unref();
+	template <typename T>
+	static _Data *_find_and_ref(uint32_t p_idx, uint32_t p_hash, const T &p_name);
+	template <typename T>
+	static _Data *_intern(uint32_t p_hash, const T &p_name, const char *p_cname, bool p_static);
+	template <typename T>
+	static _Data *_search(uint32_t p_hash, const T &p_name);
 	friend void register_core_types();
 	friend void unregister_core_types();
 	friend class Main;
@@ -87,7 +93,7 @@ class StringName {
 #ifdef DEBUG_ENABLED
 	struct DebugSortReferences {
 		bool operator()(const _Data *p_left, const _Data *p_right) const {
-			return p_left->debug_references > p_right->debug_references;
+			return p_left->debug_references.get() > p_right->debug_references.get();
 		}
 	};
 
@@ -165,6 +171,15 @@ public:
 	static StringName search(const char32_t *p_name);
 	static StringName search(const String &p_name);
 
+	struct TableStats {
+		uint64_t lookups = 0; // Interning and search calls.
+		uint64_t hits = 0; // Lookups that found an existing name.
+		uint64_t contended = 0; // Table lock acquisitions that had to wait for another thread.
+	};
+
+	static TableStats get_table_stats();
+	static void reset_table_stats();
+
 	struct AlphCompare {
 		template <typename LT, typename RT>
 		_FORCE_INLINE_ bool operator()(const LT &l, const RT &r) const {
@@ -0,0 +1,769 @@
+/**************************************************************************/
+/*  swiss_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/hash_map.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SWISS_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define SWISS_CTZ32(x) __builtin_ctz(x)
+#define SWISS_CLZ32(x) __builtin_clz(x)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+static _FORCE_INLINE_ uint32_t __swiss_bsf_ctz32(uint32_t x) {
+	unsigned long index;
+	_BitScanForward(&index, x);
+	return index;
+}
+static _FORCE_INLINE_ uint32_t __swiss_bsr_clz32(uint32_t x) {
+	unsigned long index;
+	_BitScanReverse(&index, x);
+	return 31 - index;
+}
+#define SWISS_CTZ32(x) __swiss_bsf_ctz32(x)
+#define SWISS_CLZ32(x) __swiss_bsr_clz32(x)
+#else
+static _FORCE_INLINE_ uint32_t __swiss_ctz32(uint32_t x) {
+	uint32_t index = 0;
+	while (!(x & 1)) {
+		x >>= 1;
+		index++;
+	}
+	return index;
+}
+static _FORCE_INLINE_ uint32_t __swiss_clz32(uint32_t x) {
+	uint32_t index = 0;
+	while (!(x & 0x80000000)) {
+		x <<= 1;
+		index++;
+	}
+	return index;
+}
+#define SWISS_CTZ32(x) __swiss_ctz32(x)
+#define SWISS_CLZ32(x) __swiss_clz32(x)
+#endif
+
+/**
+ * A HashMap implementation that uses open addressing with SwissTable-style
+ * control bytes. Every bucket has one control byte holding either the low 7
+ * bits of the hash of the entry stored there, or a marker for empty and
+ * deleted buckets. Lookups load 16 control bytes at once and compare them all
+ * in parallel (with SSE2 where available), so only buckets with a matching
+ * fingerprint ever touch the keys.
+ *
+ * Buckets store indices into a dense entry array, which keeps insertion order
+ * like HashMap does, and makes iteration a linear scan. The entries are stored
+ * by value in pages that double in size and are never reallocated, so there is
+ * no allocation per element, and inserting never moves an element.
+ *
+ * Pointers to elements (from getptr(), operator[] or iterators) and iterators
+ * stay valid while inserting. Dictionary relies on this, e.g. when a reference
+ * returned by operator[] is assigned to after inserting another key.
+ *
+ * Unlike HashMap, erasing can move the other elements: erased entries are left
+ * as tombstones, and once they outnumber the live ones the entries are packed
+ * together again, keeping their order. So erase() and sort() invalidate all
+ * pointers and iterators into the map.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class SwissHashMap {
+public:
+	// Must be a power of two, and at least one probing group wide.
+	static constexpr uint32_t MIN_CAPACITY = 16;
+	static constexpr uint32_t GROUP_WIDTH = 16;
+	static constexpr uint32_t ERASED_HASH = 0;
+
+	static constexpr uint8_t CTRL_EMPTY = 0x80;
+	static constexpr uint8_t CTRL_DELETED = 0xFE;
+	static constexpr uint8_t CTRL_HASH_MASK = 0x7F;
+
+	// Entries in the first page. Page `i > 0` holds `FIRST_PAGE_SIZE << (i - 1)` entries, so the capacity doubles
+	// with every page.
+	static constexpr uint32_t FIRST_PAGE_SHIFT = 3;
+	static constexpr uint32_t FIRST_PAGE_SIZE = 1 << FIRST_PAGE_SHIFT;
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	// A group of GROUP_WIDTH consecutive control bytes. The match methods return a bitmask with bit `i` set if
+	// the control byte at `i` matches.
+	struct Group {
+#ifdef SWISS_HASH_MAP_SSE2
+		__m128i ctrl;
+
+		_FORCE_INLINE_ explicit Group(const uint8_t *p_ctrl) {
+			ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl));
+		}
+		_FORCE_INLINE_ uint32_t match(uint8_t p_value) const {
+			return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(char(p_value)), ctrl)));
+		}
+		// Empty and deleted buckets are the only ones with the high bit set.
+		_FORCE_INLINE_ uint32_t match_free() const {
+			return uint32_t(_mm_movemask_epi8(ctrl));
+		}
+#else
+		const uint8_t *ctrl = nullptr;
+
+		_FORCE_INLINE_ explicit Group(const uint8_t *p_ctrl) {
+			ctrl = p_ctrl;
+		}
+		_FORCE_INLINE_ uint32_t match(uint8_t p_value) const {
+			uint32_t mask = 0;
+			for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+				mask |= uint32_t(ctrl[i] == p_value) << i;
+			}
+			return mask;
+		}
+		_FORCE_INLINE_ uint32_t match_free() const {
+			uint32_t mask = 0;
+			for (uint32_t i = 0; i < GROUP_WIDTH; i++) {
+				mask |= uint32_t(ctrl[i] >> 7) << i;
+			}
+			return mask;
+		}
+#endif
+		_FORCE_INLINE_ uint32_t match_empty() const {
+			return match(CTRL_EMPTY);
+		}
+	};
+
+	// Dense entry array in insertion order, split in `page_count` pages. `entry_hashes[i] == ERASED_HASH` marks
+	// a tombstone, its entry is not constructed.
+	MapKeyValue **pages = nullptr;
+	uint32_t *entry_hashes = nullptr;
+	// `bucket_mask + 1 + GROUP_WIDTH` control bytes, the last GROUP_WIDTH mirror the first ones so a group can be
+	// loaded at any position without wrapping around.
+	uint8_t *ctrl = nullptr;
+	uint32_t *buckets = nullptr;
+
+	// Due to optimization, this is `capacity - 1`. Use + 1 to get normal capacity.
+	uint32_t bucket_mask = MIN_CAPACITY - 1;
+	uint32_t growth_left = 0;
+	uint32_t page_count = 0;
+	// Number of used slots in the entry array, including tombstones.
+	uint32_t entry_count = 0;
+	uint32_t num_elements = 0;
+
+	_FORCE_INLINE_ static uint32_t _hash(const TKey &p_key) {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == ERASED_HASH)) {
+			hash = ERASED_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	// Maximum load factor is 7/8.
+	_FORCE_INLINE_ static uint32_t _get_max_load(uint32_t p_capacity) {
+		return p_capacity - p_capacity / 8;
+	}
+
+	static uint32_t _get_capacity_for(uint32_t p_elements) {
+		uint32_t capacity = MIN_CAPACITY;
+		while (_get_max_load(capacity) < p_elements) {
+			capacity <<= 1;
+		}
+		return capacity;
+	}
+
+	_FORCE_INLINE_ static uint32_t _get_page_size(uint32_t p_page) {
+		return p_page == 0 ? FIRST_PAGE_SIZE : FIRST_PAGE_SIZE << (p_page - 1);
+	}
+
+	_FORCE_INLINE_ static MapKeyValue *_get_entry_in(MapKeyValue *const *p_pages, uint32_t p_index) {
+		if (p_index < FIRST_PAGE_SIZE) {
+			return p_pages[0] + p_index;
+		}
+		// Pages after the first start at `FIRST_PAGE_SIZE << (page - 1)`.
+		const uint32_t page = 32 - SWISS_CLZ32(p_index >> FIRST_PAGE_SHIFT);
+		return p_pages[page] + (p_index - (FIRST_PAGE_SIZE << (page - 1)));
+	}
+
+	_FORCE_INLINE_ MapKeyValue *_get_entry(uint32_t p_index) const {
+		return _get_entry_in(pages, p_index);
+	}
+
+	_FORCE_INLINE_ uint32_t _get_entry_capacity() const {
+		return page_count == 0 ? 0 : FIRST_PAGE_SIZE << (page_count - 1);
+	}
+
+	void _add_page() {
+		pages = reinterpret_cast<MapKeyValue **>(Memory::realloc_static(pages, sizeof(MapKeyValue *) * (page_count + 1)));
+		pages[page_count] = reinterpret_cast<MapKeyValue *>(Memory::alloc_static(sizeof(MapKeyValue) * _get_page_size(page_count)));
+		page_count++;
+		entry_hashes = reinterpret_cast<uint32_t *>(Memory::realloc_static(entry_hashes, sizeof(uint32_t) * _get_entry_capacity()));
+	}
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_bucket, uint8_t p_value) {
+		ctrl[p_bucket] = p_value;
+		ctrl[((p_bucket - GROUP_WIDTH) & bucket_mask) + GROUP_WIDTH] = p_value;
+	}
+
+	bool _lookup_bucket(const TKey &p_key, uint32_t p_hash, uint32_t &r_bucket) const {
+		if (unlikely(ctrl == nullptr)) {
+			return false; // Failed lookups, no elements.
+		}
+
+		const uint8_t h2 = p_hash & CTRL_HASH_MASK;
+		uint32_t pos = (p_hash >> 7) & bucket_mask;
+		uint32_t stride = 0;
+		while (true) {
+			const Group group(ctrl + pos);
+			for (uint32_t mask = group.match(h2); mask != 0; mask &= mask - 1) {
+				const uint32_t bucket = (pos + SWISS_CTZ32(mask)) & bucket_mask;
+				const uint32_t index = buckets[bucket];
+				if (entry_hashes[index] == p_hash && Comparator::compare(_get_entry(index)->key, p_key)) {
+					r_bucket = bucket;
+					return true;
+				}
+			}
+
+			if (group.match_empty() != 0) {
+				return false;
+			}
+
+			// Triangular probing visits every group once when the capacity is a power of two.
+			stride += GROUP_WIDTH;
+			pos = (pos + stride) & bucket_mask;
+		}
+	}
+
+	_FORCE_INLINE_ bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		uint32_t bucket = 0;
+		if (!_lookup_bucket(p_key, _hash(p_key), bucket)) {
+			return false;
+		}
+		r_pos = buckets[bucket];
+		return true;
+	}
+
+	uint32_t _find_free_bucket(uint32_t p_hash) const {
+		uint32_t pos = (p_hash >> 7) & bucket_mask;
+		uint32_t stride = 0;
+		while (true) {
+			const uint32_t mask = Group(ctrl + pos).match_free();
+			if (mask != 0) {
+				return (pos + SWISS_CTZ32(mask)) & bucket_mask;
+			}
+			stride += GROUP_WIDTH;
+			pos = (pos + stride) & bucket_mask;
+		}
+	}
+
+	void _rebuild_buckets() {
+		memset(ctrl, CTRL_EMPTY, bucket_mask + 1 + GROUP_WIDTH);
+		for (uint32_t i = 0; i < entry_count; i++) {
+			if (entry_hashes[i] == ERASED_HASH) {
+				continue;
+			}
+			const uint32_t bucket = _find_free_bucket(entry_hashes[i]);
+			_set_ctrl(bucket, entry_hashes[i] & CTRL_HASH_MASK);
+			buckets[bucket] = i;
+		}
+		growth_left = _get_max_load(bucket_mask + 1) - num_elements;
+	}
+
+	// Reallocates the buckets and rehashes the entries into them. The entries themselves don't move.
+	void _resize_buckets(uint32_t p_capacity) {
+		if (ctrl != nullptr) {
+			Memory::free_static(ctrl);
+			Memory::free_static(buckets);
+		}
+
+		bucket_mask = p_capacity - 1;
+		ctrl = reinterpret_cast<uint8_t *>(Memory::alloc_static(p_capacity + GROUP_WIDTH));
+		buckets = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * p_capacity));
+
+		_rebuild_buckets();
+	}
+
+	// Moves the live entries down over the tombstones, keeping their order.
+	void _compact() {
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < entry_count; i++) {
+			if (entry_hashes[i] == ERASED_HASH) {
+				continue;
+			}
+			if (i != count) {
+				MapKeyValue *entry = _get_entry(i);
+				memnew_placement(_get_entry(count), MapKeyValue(*entry));
+				entry->~MapKeyValue();
+				entry_hashes[count] = entry_hashes[i];
+			}
+			count++;
+		}
+		entry_count = count;
+
+		_rebuild_buckets();
+	}
+
+	uint32_t _insert_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(ctrl == nullptr)) {
+			// Allocate on demand to save memory.
+			_resize_buckets(bucket_mask + 1);
+		} else if (unlikely(growth_left == 0)) {
+			uint32_t capacity = bucket_mask + 1;
+			if (num_elements >= _get_max_load(capacity) / 2) {
+				capacity <<= 1;
+			}
+			// Otherwise most buckets are marked as deleted, rehashing at the same size is enough.
+			_resize_buckets(capacity);
+		}
+
+		if (unlikely(entry_count == _get_entry_capacity())) {
+			_add_page();
+		}
+
+		const uint32_t bucket = _find_free_bucket(p_hash);
+		if (ctrl[bucket] == CTRL_EMPTY) {
+			growth_left--;
+		}
+		_set_ctrl(bucket, p_hash & CTRL_HASH_MASK);
+		buckets[bucket] = entry_count;
+
+		memnew_placement(_get_entry(entry_count), MapKeyValue(p_key, p_value));
+		entry_hashes[entry_count] = p_hash;
+		num_elements++;
+		return entry_count++;
+	}
+
+	void _init_from(const SwissHashMap &p_other) {
+		bucket_mask = p_other.bucket_mask;
+		for (uint32_t i = 0; i < p_other.entry_count; i++) {
+			if (p_other.entry_hashes[i] != ERASED_HASH) {
+				const MapKeyValue *entry = p_other._get_entry(i);
+				_insert_element(entry->key, entry->value, p_other.entry_hashes[i]);
+			}
+		}
+	}
+
+	void _destroy_entries() {
+		for (uint32_t i = 0; i < entry_count; i++) {
+			if (entry_hashes[i] != ERASED_HASH) {
+				_get_entry(i)->~MapKeyValue();
+			}
+		}
+	}
+
+	_FORCE_INLINE_ uint32_t _skip_erased(uint32_t p_index) const {
+		while (p_index < entry_count && entry_hashes[p_index] == ERASED_HASH) {
+			p_index++;
+		}
+		return p_index;
+	}
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return bucket_mask + 1; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (ctrl == nullptr || entry_count == 0) {
+			return;
+		}
+
+		_destroy_entries();
+		memset(ctrl, CTRL_EMPTY, bucket_mask + 1 + GROUP_WIDTH);
+		growth_left = _get_max_load(bucket_mask + 1);
+		entry_count = 0;
+		num_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "SwissHashMap key not found.");
+		return _get_entry(pos)->value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "SwissHashMap key not found.");
+		return _get_entry(pos)->value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &_get_entry(pos)->value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &_get_entry(pos)->value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t pos = 0;
+		return _lookup_pos(p_key, pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t bucket = 0;
+		if (!_lookup_bucket(p_key, _hash(p_key), bucket)) {
+			return false;
+		}
+
+		const uint32_t pos = buckets[bucket];
+		_set_ctrl(bucket, CTRL_DELETED);
+		_get_entry(pos)->~MapKeyValue();
+		entry_hashes[pos] = ERASED_HASH;
+		num_elements--;
+
+		if (num_elements == 0) {
+			// Nothing left to probe past, drop all the tombstones.
+			memset(ctrl, CTRL_EMPTY, bucket_mask + 1 + GROUP_WIDTH);
+			growth_left = _get_max_load(bucket_mask + 1);
+			entry_count = 0;
+			return true;
+		}
+
+		// Trailing tombstones in the entry array can be reused right away.
+		while (entry_hashes[entry_count - 1] == ERASED_HASH) {
+			entry_count--;
+		}
+		if (entry_count - num_elements > num_elements) {
+			_compact();
+		}
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		const uint32_t capacity = _get_capacity_for(p_new_capacity);
+		if (capacity <= bucket_mask + 1) {
+			return;
+		}
+		if (ctrl == nullptr) {
+			bucket_mask = capacity - 1;
+			return; // Unallocated yet.
+		}
+		_resize_buckets(capacity);
+	}
+
+	// Sorts the elements by key using the Variant ordering, like HashMap::sort().
+	void sort() {
+		if (ctrl == nullptr || num_elements < 2) {
+			return; // An empty or single element map is already sorted.
+		}
+		if (entry_count != num_elements) {
+			_compact();
+		}
+
+		// Sort the indices, then copy the entries in that order to new pages.
+		// Use insertion sort because we want this operation to be fast for the
+		// common case where the input is already sorted or nearly sorted.
+		uint32_t *order = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * entry_count));
+		for (uint32_t i = 0; i < entry_count; i++) {
+			const uint32_t inserting = i;
+			const MapKeyValue *inserting_entry = _get_entry(inserting);
+
+			uint32_t j = i;
+			while (j > 0 && _hashmap_variant_less_than(inserting_entry->key, _get_entry(order[j - 1])->key)) {
+				order[j] = order[j - 1];
+				j--;
+			}
+			order[j] = inserting;
+		}
+
+		MapKeyValue **new_pages = reinterpret_cast<MapKeyValue **>(Memory::alloc_static(sizeof(MapKeyValue *) * page_count));
+		for (uint32_t i = 0; i < page_count; i++) {
+			new_pages[i] = reinterpret_cast<MapKeyValue *>(Memory::alloc_static(sizeof(MapKeyValue) * _get_page_size(i)));
+		}
+		uint32_t *new_entry_hashes = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * _get_entry_capacity()));
+
+		for (uint32_t i = 0; i < entry_count; i++) {
+			MapKeyValue *entry = _get_entry(order[i]);
+			memnew_placement(_get_entry_in(new_pages, i), MapKeyValue(*entry));
+			entry->~MapKeyValue();
+			new_entry_hashes[i] = entry_hashes[order[i]];
+		}
+
+		for (uint32_t i = 0; i < page_count; i++) {
+			Memory::free_static(pages[i]);
+		}
+		Memory::free_static(pages);
+		Memory::free_static(entry_hashes);
+		Memory::free_static(order);
+		pages = new_pages;
+		entry_hashes = new_entry_hashes;
+
+		_rebuild_buckets();
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return *map->_get_entry(index);
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return map->_get_entry(index);
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			index = map->_skip_erased(index + 1);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return map == b.map && index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return map != b.map || index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && index < map->entry_count;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const SwissHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+
+	private:
+		const SwissHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return *map->_get_entry(index);
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return map->_get_entry(index);
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			index = map->_skip_erased(index + 1);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return map == b.map && index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return map != b.map || index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && index < map->entry_count;
+		}
+
+		_FORCE_INLINE_ Iterator(SwissHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, index);
+		}
+
+	private:
+		SwissHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _skip_erased(0));
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, entry_count);
+	}
+	// The last entry is never a tombstone, those are trimmed on erase.
+	_FORCE_INLINE_ Iterator last() {
+		if (unlikely(num_elements == 0)) {
+			return Iterator(nullptr, 0);
+		}
+		return Iterator(this, entry_count - 1);
+	}
+
+	Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return Iterator(this, pos);
+	}
+
+	void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _skip_erased(0));
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, entry_count);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		if (unlikely(num_elements == 0)) {
+			return ConstIterator(nullptr, 0);
+		}
+		return ConstIterator(this, entry_count - 1);
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return ConstIterator(this, pos);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return _get_entry(pos)->value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t bucket = 0;
+		const uint32_t hash = _hash(p_key);
+		if (_lookup_bucket(p_key, hash, bucket)) {
+			return _get_entry(buckets[bucket])->value;
+		}
+		const uint32_t pos = _insert_element(p_key, TValue(), hash);
+		return _get_entry(pos)->value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t bucket = 0;
+		uint32_t pos = 0;
+		const uint32_t hash = _hash(p_key);
+		if (_lookup_bucket(p_key, hash, bucket)) {
+			pos = buckets[bucket];
+			_get_entry(pos)->value = p_value;
+		} else {
+			pos = _insert_element(p_key, p_value, hash);
+		}
+		return Iterator(this, pos);
+	}
+
+	// Inserts an element without checking if it already exists.
+	Iterator insert_new(const TKey &p_key, const TValue &p_value) {
+		DEV_ASSERT(!has(p_key));
+		const uint32_t pos = _insert_element(p_key, p_value, _hash(p_key));
+		return Iterator(this, pos);
+	}
+
+	/* Constructors */
+
+	SwissHashMap(const SwissHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	void operator=(const SwissHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		reset();
+
+		_init_from(p_other);
+	}
+
+	SwissHashMap(uint32_t p_initial_capacity) {
+		bucket_mask = _get_capacity_for(p_initial_capacity) - 1;
+	}
+	SwissHashMap() {}
+
+	SwissHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void reset() {
+		if (ctrl != nullptr) {
+			_destroy_entries();
+			Memory::free_static(ctrl);
+			Memory::free_static(buckets);
+			ctrl = nullptr;
+			buckets = nullptr;
+		}
+		if (pages != nullptr) {
+			for (uint32_t i = 0; i < page_count; i++) {
+				Memory::free_static(pages[i]);
+			}
+			Memory::free_static(pages);
+			Memory::free_static(entry_hashes);
+			pages = nullptr;
+			entry_hashes = nullptr;
+		}
+		bucket_mask = MIN_CAPACITY - 1;
+		growth_left = 0;
+		page_count = 0;
+		entry_count = 0;
+		num_elements = 0;
+	}
+
+	~SwissHashMap() {
+		reset();
+	}
+};
@@ -351,6 +351,7 @@ RasterizerGLES3::RasterizerGLES3() {
 
 				if (!shader_cache_dir.is_empty()) {
 					ShaderGLES3::set_shader_cache_dir(shader_cache_dir);
+					ShaderCompiler::set_cache_dir(shader_cache_dir.path_join("shader_compiler"));
 				}
 			}
 		}
@@ -381,6 +382,7 @@ RasterizerGLES3::RasterizerGLES3() {
 }
 
 RasterizerGLES3::~RasterizerGLES3() {
+	ShaderCompiler::set_cache_dir(String());
 }
 
 void RasterizerGLES3::_blit_render_target_to_screen(RID p_render_target, DisplayServer::WindowID p_screen, const Rect2 &p_screen_rect, uint32_t p_layer, bool p_first) {
@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -171,6 +172,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped_data) {
+		munmap((void *)mapped_data, mapped_length);
+		mapped_data = nullptr;
+		mapped_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -225,6 +232,12 @@ String FileAccessUnix::get_real_path() const {
 void FileAccessUnix::seek(uint64_t p_position) {
 	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
 
+	if (mapped_data) {
+		mapped_pos = p_position;
+		mapped_eof = false;
+		return;
+	}
+
 	if (fseeko(f, p_position, SEEK_SET)) {
 		check_errors();
 	}
@@ -233,6 +246,12 @@ void FileAccessUnix::seek(uint64_t p_position) {
 void FileAccessUnix::seek_end(int64_t p_position) {
 	ERR_FAIL_NULL_MSG(f, "File must be opened before use.");
 
+	if (mapped_data) {
+		mapped_pos = mapped_length + p_position;
+		mapped_eof = false;
+		return;
+	}
+
 	if (fseeko(f, p_position, SEEK_END)) {
 		check_errors();
 	}
@@ -241,6 +260,10 @@ void FileAccessUnix::seek_end(int64_t p_position) {
 uint64_t FileAccessUnix::get_position() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
+	if (mapped_data) {
+		return mapped_pos;
+	}
+
 	int64_t pos = ftello(f);
 	if (pos < 0) {
 		check_errors();
@@ -252,6 +275,10 @@ uint64_t FileAccessUnix::get_position() const {
 uint64_t FileAccessUnix::get_length() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
+	if (mapped_data) {
+		return mapped_length;
+	}
+
 	int64_t pos = ftello(f);
 	ERR_FAIL_COND_V(pos < 0, 0);
 	ERR_FAIL_COND_V(fseeko(f, 0, SEEK_END), 0);
@@ -263,6 +290,9 @@ uint64_t FileAccessUnix::get_length() const {
 }
 
 bool FileAccessUnix::eof_reached() const {
+	if (mapped_data) {
+		return mapped_eof;
+	}
 	return feof(f);
 }
 
@@ -270,12 +300,64 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_NULL_V_MSG(f, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
+	if (mapped_data) {
+		const uint64_t left = mapped_pos < mapped_length ? mapped_length - mapped_pos : 0;
+		const uint64_t read = MIN(p_length, left);
+		memcpy(p_dst, mapped_data + mapped_pos, read);
+		mapped_pos += read;
+		// Same as feof(), only set when trying to read past the end.
+		mapped_eof = read < p_length;
+		last_error = mapped_eof ? ERR_FILE_EOF : OK;
+		return read;
+	}
+
 	uint64_t read = fread(p_dst, 1, p_length, f);
 	check_errors();
 
 	return read;
 }
 
+Error FileAccessUnix::map_to_memory() {
+	ERR_FAIL_NULL_V_MSG(f, ERR_FILE_CANT_OPEN, "File must be opened before use.");
+
+	if (mapped_data) {
+		return OK;
+	}
+	if (flags != READ) {
+		return ERR_UNAVAILABLE;
+	}
+
+	struct stat st = {};
+	if (fstat(fileno(f), &st) != 0 || st.st_size <= 0 || (uint64_t)st.st_size > (uint64_t)SIZE_MAX) {
+		return ERR_UNAVAILABLE;
+	}
+
+	int64_t pos = ftello(f);
+	ERR_FAIL_COND_V(pos < 0, ERR_FILE_CANT_READ);
+
+	void *data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (data == MAP_FAILED) {
+		return ERR_FILE_CANT_READ;
+	}
+
+	mapped_data = (const uint8_t *)data;
+	mapped_length = st.st_size;
+	mapped_pos = pos;
+	mapped_eof = false;
+	last_error = OK;
+	return OK;
+}
+
+Span<uint8_t> FileAccessUnix::get_mapped_span(uint64_t p_length) const {
+	if (!mapped_data || mapped_pos > mapped_length || p_length > mapped_length - mapped_pos) {
+		return Span<uint8_t>();
+	}
+
+	Span<uint8_t> span(mapped_data + mapped_pos, p_length);
+	mapped_pos += p_length;
+	return span;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
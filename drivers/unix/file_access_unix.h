@@ -46,6 +46,12 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	// Read-only mapping of the whole file, used instead of `f` for reading once mapped.
+	const uint8_t *mapped_data = nullptr;
+	uint64_t mapped_length = 0;
+	mutable uint64_t mapped_pos = 0;
+	mutable bool mapped_eof = false;
+
 	void _close();
 
 #if defined(TOOLS_ENABLED)
@@ -71,6 +77,9 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
 
+	virtual Error map_to_memory() override;
+	virtual Span<uint8_t> get_mapped_span(uint64_t p_length) const override;
+
 	virtual Error get_error() const override; ///< get last error
 
 	virtual Error resize(int64_t p_length) override;
@@ -1902,7 +1902,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		} else {
 			int worker_threads = GLOBAL_GET("threading/worker_pool/max_threads");
 			float low_priority_ratio = GLOBAL_GET("threading/worker_pool/low_priority_thread_ratio");
-			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio);
+			bool work_stealing = GLOBAL_GET("threading/worker_pool/use_work_stealing");
+			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio, work_stealing);
 		}
 #else
 		WorkerThreadPool::get_singleton()->init(0, 0);
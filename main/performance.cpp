@@ -119,6 +119,8 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
+	BIND_ENUM_CONSTANT(SHADER_COMPILATION_QUEUE_DEPTH);
+	BIND_ENUM_CONSTANT(SHADER_COMPILATION_LATENCY);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -193,6 +195,8 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_connected"),
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
+		PNAME("pipeline/shader_compilation_queue_depth"),
+		PNAME("pipeline/shader_compilation_latency"),
 	};
 	static_assert(std::size(names) == MONITOR_MAX);
 
@@ -351,6 +355,10 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
 		case NAVIGATION_3D_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
+		case SHADER_COMPILATION_QUEUE_DEPTH:
+			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_SHADER_COMPILATION_QUEUE_DEPTH);
+		case SHADER_COMPILATION_LATENCY:
+			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_SHADER_COMPILATION_LATENCY) / 1000000.0;
 
 		default: {
 		}
@@ -422,6 +430,8 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
@@ -125,6 +125,8 @@ public:
 		NAVIGATION_3D_EDGE_CONNECTION_COUNT,
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
+		SHADER_COMPILATION_QUEUE_DEPTH,
+		SHADER_COMPILATION_LATENCY,
 		MONITOR_MAX
 	};
 
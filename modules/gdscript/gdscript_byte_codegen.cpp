@@ -612,6 +612,21 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		// Common int and float operators get their own opcodes, so the VM doesn't have to call the evaluator.
+		GDScriptFunction::Opcode specialized_opcode = get_specialized_operator_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		if (specialized_opcode != GDScriptFunction::OPCODE_OPERATOR_VALIDATED) {
+			if (Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type) == Variant::BOOL) {
+				last_comparison_pos = opcodes.size();
+				last_comparison_target = p_target;
+			}
+			append_opcode(specialized_opcode);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			append(p_operator);
+			return;
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
@@ -640,6 +655,55 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 	}
 }
 
+GDScriptFunction::Opcode GDScriptByteCodeGenerator::get_specialized_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) const {
+	if (p_left_type != p_right_type || (p_left_type != Variant::INT && p_left_type != Variant::FLOAT)) {
+		return GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+	}
+
+	switch (p_operator) {
+		case Variant::OP_ADD:
+		case Variant::OP_SUBTRACT:
+		case Variant::OP_MULTIPLY:
+		case Variant::OP_EQUAL:
+		case Variant::OP_NOT_EQUAL:
+		case Variant::OP_LESS:
+		case Variant::OP_LESS_EQUAL:
+		case Variant::OP_GREATER:
+		case Variant::OP_GREATER_EQUAL:
+			return p_left_type == Variant::INT ? GDScriptFunction::OPCODE_OPERATOR_INT : GDScriptFunction::OPCODE_OPERATOR_FLOAT;
+		default:
+			return GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+	}
+}
+
+void GDScriptByteCodeGenerator::append_conditional_jump(GDScriptFunction::Opcode p_jump_opcode, const Address &p_condition) {
+	int jump_pos = opcodes.size();
+	append_opcode(p_jump_opcode);
+	append(p_condition);
+
+	// Quicken "compare, then jump on the result" into a single dispatch. The comparison's opcode is
+	// rewritten in place and the jump is kept as is right after it, so no address changes and any
+	// other jump landing on the conditional jump still finds it there.
+	if (last_comparison_pos != -1 && last_comparison_pos + 5 == jump_pos && last_comparison_target.mode == p_condition.mode && last_comparison_target.address == p_condition.address) {
+		if (opcodes[last_comparison_pos] == GDScriptFunction::OPCODE_OPERATOR_INT) {
+			opcodes.write[last_comparison_pos] = GDScriptFunction::OPCODE_COMPARE_JUMP_INT;
+		} else if (opcodes[last_comparison_pos] == GDScriptFunction::OPCODE_OPERATOR_FLOAT) {
+			opcodes.write[last_comparison_pos] = GDScriptFunction::OPCODE_COMPARE_JUMP_FLOAT;
+		}
+	}
+	last_comparison_pos = -1;
+}
+
+void GDScriptByteCodeGenerator::append_loop_jump(int p_continue_addr) {
+	// Integer loops run their iterate step in the jump back to it, saving a dispatch per iteration.
+	if (opcodes[p_continue_addr] == GDScriptFunction::OPCODE_ITERATE_INT) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_ITERATE_INT);
+	} else {
+		append_opcode(GDScriptFunction::OPCODE_JUMP);
+	}
+	append(p_continue_addr);
+}
+
 void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const Address &p_source, const GDScriptDataType &p_type) {
 	switch (p_type.kind) {
 		case GDScriptDataType::BUILTIN: {
@@ -693,15 +757,13 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 }
 
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_left_operand);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_right_operand);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -723,15 +785,13 @@ void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_or_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
-	append(p_left_operand);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF, p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_or_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
-	append(p_right_operand);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF, p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -757,8 +817,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_condition);
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -1028,6 +1087,7 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
 	append_opcode(GDScriptFunction::OPCODE_STORE_GLOBAL);
 	append(p_dst);
+	global_index_positions.push_back(opcodes.size());
 	append(p_global_index);
 }
 
@@ -1512,8 +1572,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_condition);
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1695,8 +1754,7 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 
 void GDScriptByteCodeGenerator::write_endfor() {
 	// Jump back to loop check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP);
-	append(continue_addrs.back()->get());
+	append_loop_jump(continue_addrs.back()->get());
 	continue_addrs.pop_back();
 
 	// Patch end jumps (two of them).
@@ -1723,8 +1781,7 @@ void GDScriptByteCodeGenerator::start_while_condition() {
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_condition);
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -1753,8 +1810,7 @@ void GDScriptByteCodeGenerator::write_break() {
 }
 
 void GDScriptByteCodeGenerator::write_continue() {
-	append_opcode(GDScriptFunction::OPCODE_JUMP);
-	append(continue_addrs.back()->get());
+	append_loop_jump(continue_addrs.back()->get());
 }
 
 void GDScriptByteCodeGenerator::write_breakpoint() {
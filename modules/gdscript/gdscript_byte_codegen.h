@@ -98,6 +98,13 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int current_line = 0;
 	int instr_args_max = 0;
 
+	// Last int/float comparison emitted, so a conditional jump right after it on its result can be fused into it.
+	int last_comparison_pos = -1;
+	Address last_comparison_target;
+
+	// Positions of indices into the language global array, which the bytecode cache stores by name.
+	Vector<int> global_index_positions;
+
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
 #endif
@@ -446,6 +453,10 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(get_lambda_function_pos(p_lambda_function));
 	}
 
+	GDScriptFunction::Opcode get_specialized_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) const;
+	void append_conditional_jump(GDScriptFunction::Opcode p_jump_opcode, const Address &p_condition);
+	void append_loop_jump(int p_continue_addr);
+
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
 	}
@@ -476,6 +487,8 @@ public:
 #endif
 	virtual void set_initial_line(int p_line) override;
 
+	const Vector<int> &get_global_index_positions() const { return global_index_positions; }
+
 	virtual void write_type_adjust(const Address &p_target, Variant::Type p_new_type) override;
 	virtual void write_unary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand) override;
 	virtual void write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) override;
@@ -0,0 +1,1410 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript.h"
+#include "gdscript_cache.h"
+#include "gdscript_parser.h"
+
+#include "core/config/project_settings.h"
+#include "core/crypto/crypto_core.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/object/class_db.h"
+#include "core/os/mutex.h"
+#include "core/templates/rb_map.h"
+#include "core/version.h"
+
+// Increase when the layout of the cache files or the meaning of the stored data changes.
+#define BYTECODE_CACHE_FORMAT_VERSION 3
+
+static const uint8_t bytecode_cache_magic[4] = { 'G', 'D', 'B', 'C' };
+
+enum CachedConstantKind {
+	CACHED_CONSTANT_VARIANT,
+	CACHED_CONSTANT_NULL_OBJECT,
+	CACHED_CONSTANT_GLOBAL,
+};
+
+// Names of the engine bindings, looked up from the pointers stored in compiled functions.
+// Built once, the first time a function is stored in the cache.
+struct GDScriptBytecodeBindings {
+	struct Member {
+		Variant::Type type = Variant::NIL;
+		StringName name;
+	};
+
+	RBMap<Variant::ValidatedOperatorEvaluator, uint32_t> operators;
+	RBMap<Variant::ValidatedSetter, Member> setters;
+	RBMap<Variant::ValidatedGetter, Member> getters;
+	RBMap<Variant::ValidatedKeyedSetter, Variant::Type> keyed_setters;
+	RBMap<Variant::ValidatedKeyedGetter, Variant::Type> keyed_getters;
+	RBMap<Variant::ValidatedIndexedSetter, Variant::Type> indexed_setters;
+	RBMap<Variant::ValidatedIndexedGetter, Variant::Type> indexed_getters;
+	RBMap<Variant::ValidatedBuiltInMethod, Member> builtin_methods;
+	RBMap<Variant::ValidatedConstructor, Pair<Variant::Type, int>> constructors;
+	RBMap<Variant::ValidatedUtilityFunction, StringName> utilities;
+	RBMap<GDScriptUtilityFunctions::FunctionPtr, StringName> gds_utilities;
+
+	GDScriptBytecodeBindings() {
+		for (int i = 0; i < Variant::OP_MAX; i++) {
+			for (int a = 0; a < Variant::VARIANT_MAX; a++) {
+				for (int b = 0; b < Variant::VARIANT_MAX; b++) {
+					Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator((Variant::Operator)i, (Variant::Type)a, (Variant::Type)b);
+					if (op_func && !operators.has(op_func)) {
+						operators.insert(op_func, i | (a << 8) | (b << 16));
+					}
+				}
+			}
+		}
+
+		for (int i = 0; i < Variant::VARIANT_MAX; i++) {
+			Variant::Type type = (Variant::Type)i;
+
+			List<StringName> members;
+			Variant::get_member_list(type, &members);
+			for (const StringName &E : members) {
+				Variant::ValidatedSetter setter = Variant::get_member_validated_setter(type, E);
+				if (setter && !setters.has(setter)) {
+					setters.insert(setter, { type, E });
+				}
+				Variant::ValidatedGetter getter = Variant::get_member_validated_getter(type, E);
+				if (getter && !getters.has(getter)) {
+					getters.insert(getter, { type, E });
+				}
+			}
+
+			Variant::ValidatedKeyedSetter keyed_setter = Variant::get_member_validated_keyed_setter(type);
+			if (keyed_setter && !keyed_setters.has(keyed_setter)) {
+				keyed_setters.insert(keyed_setter, type);
+			}
+			Variant::ValidatedKeyedGetter keyed_getter = Variant::get_member_validated_keyed_getter(type);
+			if (keyed_getter && !keyed_getters.has(keyed_getter)) {
+				keyed_getters.insert(keyed_getter, type);
+			}
+			Variant::ValidatedIndexedSetter indexed_setter = Variant::get_member_validated_indexed_setter(type);
+			if (indexed_setter && !indexed_setters.has(indexed_setter)) {
+				indexed_setters.insert(indexed_setter, type);
+			}
+			Variant::ValidatedIndexedGetter indexed_getter = Variant::get_member_validated_indexed_getter(type);
+			if (indexed_getter && !indexed_getters.has(indexed_getter)) {
+				indexed_getters.insert(indexed_getter, type);
+			}
+
+			List<StringName> methods;
+			Variant::get_builtin_method_list(type, &methods);
+			for (const StringName &E : methods) {
+				Variant::ValidatedBuiltInMethod method = Variant::get_validated_builtin_method(type, E);
+				if (method && !builtin_methods.has(method)) {
+					builtin_methods.insert(method, { type, E });
+				}
+			}
+
+			for (int j = 0; j < Variant::get_constructor_count(type); j++) {
+				Variant::ValidatedConstructor constructor = Variant::get_validated_constructor(type, j);
+				if (constructor && !constructors.has(constructor)) {
+					constructors.insert(constructor, Pair<Variant::Type, int>(type, j));
+				}
+			}
+		}
+
+		List<StringName> utility_functions;
+		Variant::get_utility_function_list(&utility_functions);
+		for (const StringName &E : utility_functions) {
+			Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(E);
+			if (utility && !utilities.has(utility)) {
+				utilities.insert(utility, E);
+			}
+		}
+
+		List<StringName> gds_utility_functions;
+		GDScriptUtilityFunctions::get_function_list(&gds_utility_functions);
+		for (const StringName &E : gds_utility_functions) {
+			GDScriptUtilityFunctions::FunctionPtr gds_utility = GDScriptUtilityFunctions::get_function(E);
+			if (gds_utility && !gds_utilities.has(gds_utility)) {
+				gds_utilities.insert(gds_utility, E);
+			}
+		}
+	}
+};
+
+static BinaryMutex bindings_mutex;
+static GDScriptBytecodeBindings *bindings = nullptr;
+
+static const GDScriptBytecodeBindings *_get_bindings() {
+	MutexLock lock(bindings_mutex);
+	if (bindings == nullptr) {
+		bindings = memnew(GDScriptBytecodeBindings);
+	}
+	return bindings;
+}
+
+static String _get_engine_fingerprint() {
+	String fingerprint = String(GODOT_VERSION_FULL_BUILD) + "." + String(GODOT_VERSION_HASH) + "." + itos(sizeof(void *));
+#ifdef DEBUG_ENABLED
+	fingerprint += ".debug";
+#endif
+#ifdef TOOLS_ENABLED
+	fingerprint += ".tools";
+#endif
+	return fingerprint;
+}
+
+static bool _find_global_name_for_value(const Variant &p_value, StringName &r_name) {
+	const Variant *global_array = GDScriptLanguage::get_singleton()->get_global_array();
+	for (const KeyValue<StringName, int> &E : GDScriptLanguage::get_singleton()->get_global_map()) {
+		if (global_array[E.value].get_type() == p_value.get_type() && global_array[E.value] == p_value) {
+			r_name = E.key;
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool _find_global_name_for_index(int p_index, StringName &r_name) {
+	for (const KeyValue<StringName, int> &E : GDScriptLanguage::get_singleton()->get_global_map()) {
+		if (E.value == p_index) {
+			r_name = E.key;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Reads an element count, rejecting values that cannot fit in what is left of the file.
+static bool _read_count(Ref<FileAccess> p_file, uint32_t &r_count) {
+	r_count = p_file->get_32();
+	return !p_file->eof_reached() && r_count <= p_file->get_length() - p_file->get_position();
+}
+
+static bool _read_type(Ref<FileAccess> p_file, Variant::Type &r_type) {
+	uint32_t type = p_file->get_32();
+	r_type = (Variant::Type)type;
+	return type < Variant::VARIANT_MAX;
+}
+
+String GDScriptBytecodeCache::_get_cache_file(const String &p_script_path) {
+	return String("user://gdscript_cache").path_join(p_script_path.md5_text() + ".gdbc");
+}
+
+bool GDScriptBytecodeCache::_is_constant_cacheable(const Variant &p_constant, bool p_nested) {
+	switch (p_constant.get_type()) {
+		case Variant::OBJECT:
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+		case Variant::RID:
+			// Only meaningful in the running process. Objects at the top level are handled by the caller.
+			return false;
+		case Variant::ARRAY: {
+			const Array array = p_constant;
+			// The read-only flag is only restored for top-level constants.
+			if ((p_nested && array.is_read_only()) || array.get_typed_script() != Variant()) {
+				return false;
+			}
+			for (const Variant &E : array) {
+				if (!_is_constant_cacheable(E, true)) {
+					return false;
+				}
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_constant;
+			if ((p_nested && dictionary.is_read_only()) || dictionary.get_typed_key_script() != Variant() || dictionary.get_typed_value_script() != Variant()) {
+				return false;
+			}
+			for (const KeyValue<Variant, Variant> &E : dictionary) {
+				if (!_is_constant_cacheable(E.key, true) || !_is_constant_cacheable(E.value, true)) {
+					return false;
+				}
+			}
+		} break;
+		default:
+			break;
+	}
+	return true;
+}
+
+bool GDScriptBytecodeCache::is_enabled() {
+	return GLOBAL_GET("debug/gdscript/bytecode_cache/enabled");
+}
+
+static void _sha256_update_string(CryptoCore::SHA256Context &p_ctx, const String &p_string) {
+	const CharString utf8 = p_string.utf8();
+	// Terminated, so consecutive strings can't run into each other.
+	p_ctx.update((const uint8_t *)utf8.get_data(), utf8.length() + 1);
+}
+
+GDScriptBytecodeCache::ScriptKey GDScriptBytecodeCache::get_script_key(const GDScript *p_script, const GDScriptParser *p_parser) {
+	CryptoCore::SHA256Context ctx;
+	ctx.start();
+	_sha256_update_string(ctx, _get_engine_fingerprint());
+
+	uint8_t source_sha256[32];
+	if (!p_script->binary_tokens.is_empty()) {
+		CryptoCore::sha256(p_script->binary_tokens.ptr(), p_script->binary_tokens.size(), source_sha256);
+	} else {
+		const CharString source = p_script->source.utf8();
+		CryptoCore::sha256((const uint8_t *)source.get_data(), source.length(), source_sha256);
+	}
+	ctx.update(source_sha256, sizeof(source_sha256));
+
+	// Scripts depended on indirectly matter too, e.g. the base class of the base class decides member indices.
+	HashMap<String, const uint8_t *> dependencies;
+	List<const GDScriptParser *> pending;
+	pending.push_back(p_parser);
+	while (!pending.is_empty()) {
+		const GDScriptParser *dependency = pending.front()->get();
+		pending.pop_front();
+		for (const KeyValue<String, Ref<GDScriptParserRef>> &E : dependency->get_depended_parsers()) {
+			if (dependencies.has(E.key)) {
+				continue;
+			}
+			dependencies.insert(E.key, E.value->get_source_sha256());
+			if (E.value->get_status() != GDScriptParserRef::EMPTY) {
+				pending.push_back(E.value->get_parser());
+			}
+		}
+	}
+
+	Vector<String> paths;
+	for (const KeyValue<String, const uint8_t *> &E : dependencies) {
+		paths.push_back(E.key);
+	}
+	paths.sort();
+	for (const String &path : paths) {
+		_sha256_update_string(ctx, path);
+		ctx.update(dependencies[path], 32);
+	}
+
+	// Globals are resolved by name when loading, but which identifiers are globals changes the generated code.
+	// Sorted so the order in which they were registered does not matter.
+	Vector<String> globals;
+	for (const KeyValue<StringName, int> &E : GDScriptLanguage::get_singleton()->get_global_map()) {
+		globals.push_back(E.key);
+	}
+	globals.sort();
+	for (const String &global : globals) {
+		_sha256_update_string(ctx, global);
+	}
+
+	ScriptKey key;
+	ctx.finish(key.sha256);
+	return key;
+}
+
+uint32_t GDScriptBytecodeCache::get_layout_hash(const GDScript *p_script) {
+	uint32_t hash = hash_murmur3_one_32(p_script->member_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->member_indices) {
+		hash = hash_murmur3_one_32(E.key.hash(), hash);
+		hash = hash_murmur3_one_32(E.value.index, hash);
+	}
+	hash = hash_murmur3_one_32(p_script->static_variables_indices.size(), hash);
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->static_variables_indices) {
+		hash = hash_murmur3_one_32(E.key.hash(), hash);
+		hash = hash_murmur3_one_32(E.value.index, hash);
+	}
+	return hash_fmix32(hash);
+}
+
+String GDScriptBytecodeCache::get_function_key(const GDScript *p_script, const StringName &p_function_name) {
+	return p_script->fully_qualified_name + "::" + String(p_function_name);
+}
+
+bool GDScriptBytecodeCache::make_function_data(const GDScriptFunction *p_function, const Vector<int> &p_global_index_positions, FunctionData &r_data) {
+	if (!p_function->lambdas.is_empty()) {
+		// Lambdas are compiled along with the function that creates them.
+		return false;
+	}
+
+	const GDScriptBytecodeBindings *names = _get_bindings();
+
+	for (int i = 0; i < p_function->constants.size(); i++) {
+		const Variant &constant = p_function->constants[i];
+		if (constant.get_type() == Variant::OBJECT) {
+			StringName global_name;
+			if (constant.get_validated_object() == nullptr) {
+				continue;
+			} else if (_find_global_name_for_value(constant, global_name)) {
+				r_data.global_constants.push_back(Pair<int, StringName>(i, global_name));
+				continue;
+			}
+			return false;
+		}
+		if (!_is_constant_cacheable(constant, false)) {
+			return false;
+		}
+	}
+
+	for (int position : p_global_index_positions) {
+		StringName global_name;
+		if (!_find_global_name_for_index(p_function->code[position], global_name)) {
+			return false;
+		}
+		r_data.global_relocations.push_back(Pair<int, StringName>(position, global_name));
+	}
+
+	for (const Variant::ValidatedOperatorEvaluator &E : p_function->operator_funcs) {
+		if (!names->operators.has(E)) {
+			return false;
+		}
+	}
+	for (const Variant::ValidatedSetter &E : p_function->setters) {
+		if (!names->setters.has(E)) {
+			return false;
+		}
+	}
+	for (const Variant::ValidatedGetter &E : p_function->getters) {
+		if (!names->getters.has(E)) {
+			return false;
+		}
+	}
+	for (const Variant::ValidatedKeyedSetter &E : p_function->keyed_setters) {
+		if (!names->keyed_setters.has(E)) {
+			return false;
+		}
+	}
+	for (const Variant::ValidatedKeyedGetter &E : p_function->keyed_getters) {
+		if (!names->keyed_getters.has(E)) {
+			return false;
+		}
+	}
+	for (const Variant::ValidatedIndexedSetter &E : p_function->indexed_setters) {
+		if (!names->indexed_setters.has(E)) {
+			return false;
+		}
+	}
+	for (const Variant::ValidatedIndexedGetter &E : p_function->indexed_getters) {
+		if (!names->indexed_getters.has(E)) {
+			return false;
+		}
+	}
+	for (const Variant::ValidatedBuiltInMethod &E : p_function->builtin_methods) {
+		if (!names->builtin_methods.has(E)) {
+			return false;
+		}
+	}
+	for (const Variant::ValidatedConstructor &E : p_function->constructors) {
+		if (!names->constructors.has(E)) {
+			return false;
+		}
+	}
+	for (const Variant::ValidatedUtilityFunction &E : p_function->utilities) {
+		if (!names->utilities.has(E)) {
+			return false;
+		}
+	}
+	for (const GDScriptUtilityFunctions::FunctionPtr &E : p_function->gds_utilities) {
+		if (!names->gds_utilities.has(E)) {
+			return false;
+		}
+	}
+	for (const MethodBind *E : p_function->methods) {
+		// Extension methods may change without the engine version changing.
+		ClassDB::APIType api = ClassDB::get_api_type(E->get_instance_class());
+		if (api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION) {
+			return false;
+		}
+	}
+
+	r_data.stack_size = p_function->_stack_size;
+	r_data.instruction_args_size = p_function->_instruction_args_size;
+	r_data.code = p_function->code;
+	r_data.default_arguments = p_function->default_arguments;
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		r_data.temporary_slots.push_back(Pair<int, Variant::Type>(E.key, E.value));
+	}
+	r_data.constants = p_function->constants;
+	r_data.global_names = p_function->global_names;
+	r_data.operator_funcs = p_function->operator_funcs;
+	r_data.setters = p_function->setters;
+	r_data.getters = p_function->getters;
+	r_data.keyed_setters = p_function->keyed_setters;
+	r_data.keyed_getters = p_function->keyed_getters;
+	r_data.indexed_setters = p_function->indexed_setters;
+	r_data.indexed_getters = p_function->indexed_getters;
+	r_data.builtin_methods = p_function->builtin_methods;
+	r_data.constructors = p_function->constructors;
+	r_data.utilities = p_function->utilities;
+	r_data.gds_utilities = p_function->gds_utilities;
+	r_data.methods = p_function->methods;
+
+#ifdef DEBUG_ENABLED
+	r_data.operator_names = p_function->operator_names;
+	r_data.setter_names = p_function->setter_names;
+	r_data.getter_names = p_function->getter_names;
+	r_data.builtin_methods_names = p_function->builtin_methods_names;
+	r_data.constructors_names = p_function->constructors_names;
+	r_data.utilities_names = p_function->utilities_names;
+	r_data.gds_utilities_names = p_function->gds_utilities_names;
+#endif
+
+	return true;
+}
+
+// Walks cached bytecode the way the VM reads it. Release builds of the VM trust the code completely,
+// so every position it indexes with must be checked here.
+struct GDScriptBytecodeValidator {
+	const GDScriptBytecodeCache::FunctionData &data;
+	const int *code = nullptr;
+	int code_size = 0;
+	int address_limits[GDScriptFunction::ADDR_TYPE_MAX] = {};
+
+	bool address(int p_pos) const {
+		const int address_type = (code[p_pos] & GDScriptFunction::ADDR_TYPE_MASK) >> GDScriptFunction::ADDR_BITS;
+		return address_type >= 0 && address_type < GDScriptFunction::ADDR_TYPE_MAX && (code[p_pos] & GDScriptFunction::ADDR_MASK) < address_limits[address_type];
+	}
+	bool addresses(int p_from, int p_count) const {
+		for (int i = 0; i < p_count; i++) {
+			if (!address(p_from + i)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	bool index(int p_pos, int p_size) const {
+		return code[p_pos] >= 0 && code[p_pos] < p_size;
+	}
+	bool type(int p_pos) const {
+		return index(p_pos, Variant::VARIANT_MAX);
+	}
+	bool name(int p_pos) const {
+		return index(p_pos, data.global_names.size());
+	}
+	// Validated calls read as many arguments as the callee declares, not as many as the call site passes.
+	bool validated_call(int p_pos, const Vector<int> &p_argument_counts, int p_argc, bool p_allow_fewer = false) const {
+		if (!index(p_pos, p_argument_counts.size())) {
+			return false;
+		}
+		const int expected = p_argument_counts[code[p_pos]];
+		return expected < 0 || p_argc == expected || (p_allow_fewer && p_argc < expected);
+	}
+
+	explicit GDScriptBytecodeValidator(const GDScriptBytecodeCache::FunctionData &p_data) :
+			data(p_data) {
+		code = p_data.code.ptr();
+		code_size = p_data.code.size();
+	}
+};
+
+bool GDScriptBytecodeCache::validate_function_data(const FunctionData &p_data, const GDScript *p_script, int p_argument_count, int p_optional_argument_count) {
+	typedef GDScriptFunction GF;
+
+	const int code_size = p_data.code.size();
+	if (code_size == 0 || p_data.code[code_size - 1] != GF::OPCODE_END) {
+		return false;
+	}
+	// Every local and temporary slot is used by some instruction, so the stack cannot be larger than the code.
+	// This bounds the alloca() made on each call.
+	const int min_stack_size = GF::FIXED_ADDRESSES_MAX + p_argument_count;
+	if (p_data.stack_size < min_stack_size || p_data.stack_size > min_stack_size + code_size) {
+		return false;
+	}
+	if (p_data.instruction_args_size < 0 || p_data.instruction_args_size > code_size) {
+		return false;
+	}
+	if (p_data.default_arguments.size() != (p_optional_argument_count > 0 ? p_optional_argument_count + 1 : 0)) {
+		return false;
+	}
+	if (p_data.builtin_methods_argument_counts.size() != p_data.builtin_methods.size() || p_data.constructors_argument_counts.size() != p_data.constructors.size() ||
+			p_data.utilities_argument_counts.size() != p_data.utilities.size() || p_data.gds_utilities_argument_counts.size() != p_data.gds_utilities.size()) {
+		return false;
+	}
+
+	GDScriptBytecodeValidator v(p_data);
+	v.address_limits[GF::ADDR_TYPE_STACK] = p_data.stack_size;
+	v.address_limits[GF::ADDR_TYPE_CONSTANT] = p_data.constants.size();
+	v.address_limits[GF::ADDR_TYPE_MEMBER] = p_script->member_indices.size();
+	const int *code = v.code;
+	const int static_variable_count = p_script->static_variables_indices.size();
+	const int global_count = GDScriptLanguage::get_singleton()->get_global_array_size();
+
+	LocalVector<bool> instruction_starts;
+	instruction_starts.resize(code_size);
+	for (uint32_t i = 0; i < instruction_starts.size(); i++) {
+		instruction_starts[i] = false;
+	}
+	LocalVector<int> jump_positions;
+	LocalVector<int> iterate_jump_positions; // Also run the instruction they land on, which must be an OPCODE_ITERATE_INT.
+
+	int ip = 0;
+	while (ip < code_size) {
+		instruction_starts[ip] = true;
+		const int opcode = code[ip];
+		int size = 0;
+		bool valid = true;
+
+		if (opcode >= GF::OPCODE_ITERATE_BEGIN && opcode <= GF::OPCODE_ITERATE_OBJECT) {
+			size = 5;
+			valid = ip + size <= code_size && v.addresses(ip + 1, 3);
+			jump_positions.push_back(ip + 4);
+		} else if (opcode >= GF::OPCODE_TYPE_ADJUST_BOOL && opcode <= GF::OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY) {
+			size = 2;
+			valid = ip + size <= code_size && v.address(ip + 1);
+		} else {
+			switch (opcode) {
+				case GF::OPCODE_OPERATOR: {
+					// The signature, return type and evaluator are cached in the code at runtime, and must be empty.
+					size = 7 + sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*code);
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3) && v.index(ip + 4, Variant::OP_MAX);
+					for (int i = 5; valid && i < size; i++) {
+						valid = code[ip + i] == 0;
+					}
+				} break;
+				case GF::OPCODE_OPERATOR_VALIDATED: {
+					size = 5;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3) && v.index(ip + 4, p_data.operator_funcs.size());
+				} break;
+				case GF::OPCODE_OPERATOR_INT:
+				case GF::OPCODE_OPERATOR_FLOAT: {
+					size = 5;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3) && v.index(ip + 4, Variant::OP_MAX);
+				} break;
+				case GF::OPCODE_COMPARE_JUMP_INT:
+				case GF::OPCODE_COMPARE_JUMP_FLOAT: {
+					// Reads the target of the conditional jump which must follow, the jump itself is checked next.
+					size = 5;
+					valid = ip + size + 3 <= code_size && v.addresses(ip + 1, 3) && v.index(ip + 4, Variant::OP_MAX) &&
+							(code[ip + 5] == GF::OPCODE_JUMP_IF || code[ip + 5] == GF::OPCODE_JUMP_IF_NOT);
+				} break;
+				case GF::OPCODE_TYPE_TEST_BUILTIN:
+				case GF::OPCODE_ASSIGN_TYPED_BUILTIN:
+				case GF::OPCODE_CAST_TO_BUILTIN: {
+					size = 4;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 2) && v.type(ip + 3);
+				} break;
+				case GF::OPCODE_TYPE_TEST_ARRAY:
+				case GF::OPCODE_ASSIGN_TYPED_ARRAY: {
+					size = 6;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3) && v.type(ip + 4) && v.name(ip + 5);
+				} break;
+				case GF::OPCODE_TYPE_TEST_DICTIONARY:
+				case GF::OPCODE_ASSIGN_TYPED_DICTIONARY: {
+					size = 9;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 4) && v.type(ip + 5) && v.name(ip + 6) && v.type(ip + 7) && v.name(ip + 8);
+				} break;
+				case GF::OPCODE_TYPE_TEST_NATIVE:
+				case GF::OPCODE_SET_NAMED:
+				case GF::OPCODE_GET_NAMED: {
+					size = 4;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 2) && v.name(ip + 3);
+				} break;
+				case GF::OPCODE_TYPE_TEST_SCRIPT:
+				case GF::OPCODE_SET_KEYED:
+				case GF::OPCODE_GET_KEYED:
+				case GF::OPCODE_ASSIGN_TYPED_NATIVE:
+				case GF::OPCODE_ASSIGN_TYPED_SCRIPT:
+				case GF::OPCODE_CAST_TO_NATIVE:
+				case GF::OPCODE_CAST_TO_SCRIPT: {
+					size = 4;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3);
+				} break;
+				case GF::OPCODE_SET_KEYED_VALIDATED: {
+					size = 5;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3) && v.index(ip + 4, p_data.keyed_setters.size());
+				} break;
+				case GF::OPCODE_SET_INDEXED_VALIDATED: {
+					size = 5;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3) && v.index(ip + 4, p_data.indexed_setters.size());
+				} break;
+				case GF::OPCODE_GET_KEYED_VALIDATED: {
+					size = 5;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3) && v.index(ip + 4, p_data.keyed_getters.size());
+				} break;
+				case GF::OPCODE_GET_INDEXED_VALIDATED: {
+					size = 5;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3) && v.index(ip + 4, p_data.indexed_getters.size());
+				} break;
+				case GF::OPCODE_SET_NAMED_VALIDATED: {
+					size = 4;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 2) && v.index(ip + 3, p_data.setters.size());
+				} break;
+				case GF::OPCODE_GET_NAMED_VALIDATED: {
+					size = 4;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 2) && v.index(ip + 3, p_data.getters.size());
+				} break;
+				case GF::OPCODE_SET_MEMBER:
+				case GF::OPCODE_GET_MEMBER:
+				case GF::OPCODE_STORE_NAMED_GLOBAL: {
+					size = 3;
+					valid = ip + size <= code_size && v.address(ip + 1) && v.name(ip + 2);
+				} break;
+				case GF::OPCODE_SET_STATIC_VARIABLE:
+				case GF::OPCODE_GET_STATIC_VARIABLE: {
+					// Static variables of other classes need a script constant, which is never cached.
+					size = 4;
+					valid = ip + size <= code_size && v.address(ip + 1) && code[ip + 2] == GF::ADDR_CLASS && v.index(ip + 3, static_variable_count);
+				} break;
+				case GF::OPCODE_ASSIGN:
+				case GF::OPCODE_RETURN_TYPED_NATIVE:
+				case GF::OPCODE_RETURN_TYPED_SCRIPT: {
+					size = 3;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 2);
+				} break;
+				case GF::OPCODE_ASSIGN_NULL:
+				case GF::OPCODE_ASSIGN_TRUE:
+				case GF::OPCODE_ASSIGN_FALSE:
+				case GF::OPCODE_AWAIT_RESUME:
+				case GF::OPCODE_RETURN: {
+					size = 2;
+					valid = ip + size <= code_size && v.address(ip + 1);
+				} break;
+				case GF::OPCODE_AWAIT: {
+					// Reads the result address of the OPCODE_AWAIT_RESUME which must follow.
+					size = 2;
+					valid = ip + size + 2 <= code_size && v.address(ip + 1) && code[ip + 2] == GF::OPCODE_AWAIT_RESUME;
+				} break;
+				case GF::OPCODE_JUMP: {
+					size = 2;
+					valid = ip + size <= code_size;
+					jump_positions.push_back(ip + 1);
+				} break;
+				case GF::OPCODE_JUMP_ITERATE_INT: {
+					size = 2;
+					valid = ip + size <= code_size;
+					jump_positions.push_back(ip + 1);
+					iterate_jump_positions.push_back(ip + 1);
+				} break;
+				case GF::OPCODE_JUMP_IF:
+				case GF::OPCODE_JUMP_IF_NOT:
+				case GF::OPCODE_JUMP_IF_SHARED: {
+					size = 3;
+					valid = ip + size <= code_size && v.address(ip + 1);
+					jump_positions.push_back(ip + 2);
+				} break;
+				case GF::OPCODE_RETURN_TYPED_BUILTIN: {
+					size = 3;
+					valid = ip + size <= code_size && v.address(ip + 1) && v.type(ip + 2);
+				} break;
+				case GF::OPCODE_RETURN_TYPED_ARRAY: {
+					size = 5;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 2) && v.type(ip + 3) && v.name(ip + 4);
+				} break;
+				case GF::OPCODE_RETURN_TYPED_DICTIONARY: {
+					size = 8;
+					valid = ip + size <= code_size && v.addresses(ip + 1, 3) && v.type(ip + 4) && v.name(ip + 5) && v.type(ip + 6) && v.name(ip + 7);
+				} break;
+				case GF::OPCODE_STORE_GLOBAL: {
+					size = 3;
+					valid = ip + size <= code_size && v.address(ip + 1) && v.index(ip + 2, global_count);
+				} break;
+				case GF::OPCODE_ASSERT: {
+					// The message address is optional.
+					size = 3;
+					valid = ip + size <= code_size && v.address(ip + 1) && (code[ip + 2] == 0 || v.address(ip + 2));
+				} break;
+				case GF::OPCODE_LINE: {
+					size = 2;
+					valid = ip + size <= code_size;
+				} break;
+				case GF::OPCODE_JUMP_TO_DEF_ARGUMENT:
+				case GF::OPCODE_BREAKPOINT:
+				case GF::OPCODE_END: {
+					size = 1;
+				} break;
+				case GF::OPCODE_CONSTRUCT:
+				case GF::OPCODE_CONSTRUCT_VALIDATED:
+				case GF::OPCODE_CONSTRUCT_ARRAY:
+				case GF::OPCODE_CONSTRUCT_TYPED_ARRAY:
+				case GF::OPCODE_CONSTRUCT_DICTIONARY:
+				case GF::OPCODE_CONSTRUCT_TYPED_DICTIONARY:
+				case GF::OPCODE_CALL:
+				case GF::OPCODE_CALL_RETURN:
+				case GF::OPCODE_CALL_ASYNC:
+				case GF::OPCODE_CALL_UTILITY:
+				case GF::OPCODE_CALL_UTILITY_VALIDATED:
+				case GF::OPCODE_CALL_GDSCRIPT_UTILITY:
+				case GF::OPCODE_CALL_BUILTIN_TYPE_VALIDATED:
+				case GF::OPCODE_CALL_SELF_BASE:
+				case GF::OPCODE_CALL_METHOD_BIND:
+				case GF::OPCODE_CALL_METHOD_BIND_RET:
+				case GF::OPCODE_CALL_BUILTIN_STATIC:
+				case GF::OPCODE_CALL_NATIVE_STATIC:
+				case GF::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN:
+				case GF::OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN:
+				case GF::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+				case GF::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+					// Opcode, instruction argument count, instruction argument addresses, then the opcode operands.
+					if (ip + 2 > code_size) {
+						valid = false;
+						break;
+					}
+					const int instr_arg_count = code[ip + 1];
+					if (instr_arg_count < 0 || instr_arg_count > p_data.instruction_args_size || ip + 2 + instr_arg_count > code_size) {
+						valid = false;
+						break;
+					}
+					const int ops = ip + 2 + instr_arg_count;
+					int operand_count = 2;
+					int argc_pos = ops;
+					int min_instr_args = 1; // Arguments plus the result, base and type addresses used by the opcode.
+					switch (opcode) {
+						case GF::OPCODE_CONSTRUCT_ARRAY:
+						case GF::OPCODE_CONSTRUCT_DICTIONARY:
+							operand_count = 1;
+							break;
+						case GF::OPCODE_CONSTRUCT_TYPED_ARRAY:
+							operand_count = 3;
+							min_instr_args = 2;
+							break;
+						case GF::OPCODE_CONSTRUCT_TYPED_DICTIONARY:
+							operand_count = 5;
+							min_instr_args = 3;
+							break;
+						case GF::OPCODE_CALL_BUILTIN_STATIC:
+							operand_count = 3;
+							argc_pos = ops + 2;
+							break;
+						case GF::OPCODE_CALL_NATIVE_STATIC:
+							argc_pos = ops + 1;
+							break;
+						case GF::OPCODE_CALL:
+						case GF::OPCODE_CALL_RETURN:
+						case GF::OPCODE_CALL_ASYNC:
+						case GF::OPCODE_CALL_METHOD_BIND:
+						case GF::OPCODE_CALL_METHOD_BIND_RET:
+						case GF::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+						case GF::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN:
+						case GF::OPCODE_CALL_BUILTIN_TYPE_VALIDATED:
+							min_instr_args = 2;
+							break;
+						default:
+							break;
+					}
+					size = 2 + instr_arg_count + operand_count;
+					if (ip + size > code_size || !v.addresses(ip + 2, instr_arg_count)) {
+						valid = false;
+						break;
+					}
+					const int argc = code[argc_pos];
+					const int used_instr_args = opcode == GF::OPCODE_CONSTRUCT_DICTIONARY || opcode == GF::OPCODE_CONSTRUCT_TYPED_DICTIONARY ? argc * 2 : argc;
+					if (argc < 0 || argc > instr_arg_count || used_instr_args + min_instr_args > instr_arg_count) {
+						valid = false;
+						break;
+					}
+					switch (opcode) {
+						case GF::OPCODE_CONSTRUCT: {
+							valid = v.type(ops + 1);
+						} break;
+						case GF::OPCODE_CONSTRUCT_VALIDATED: {
+							valid = v.validated_call(ops + 1, p_data.constructors_argument_counts, argc);
+						} break;
+						case GF::OPCODE_CONSTRUCT_TYPED_ARRAY: {
+							valid = v.type(ops + 1) && v.name(ops + 2);
+						} break;
+						case GF::OPCODE_CONSTRUCT_TYPED_DICTIONARY: {
+							valid = v.type(ops + 1) && v.name(ops + 2) && v.type(ops + 3) && v.name(ops + 4);
+						} break;
+						case GF::OPCODE_CALL:
+						case GF::OPCODE_CALL_RETURN:
+						case GF::OPCODE_CALL_ASYNC:
+						case GF::OPCODE_CALL_UTILITY:
+						case GF::OPCODE_CALL_SELF_BASE: {
+							valid = v.name(ops + 1);
+						} break;
+						case GF::OPCODE_CALL_UTILITY_VALIDATED: {
+							valid = v.validated_call(ops + 1, p_data.utilities_argument_counts, argc);
+						} break;
+						case GF::OPCODE_CALL_GDSCRIPT_UTILITY: {
+							valid = v.validated_call(ops + 1, p_data.gds_utilities_argument_counts, argc, true);
+						} break;
+						case GF::OPCODE_CALL_BUILTIN_TYPE_VALIDATED: {
+							valid = v.validated_call(ops + 1, p_data.builtin_methods_argument_counts, argc);
+						} break;
+						case GF::OPCODE_CALL_BUILTIN_STATIC: {
+							valid = v.type(ops) && v.name(ops + 1);
+						} break;
+						case GF::OPCODE_CALL_METHOD_BIND:
+						case GF::OPCODE_CALL_METHOD_BIND_RET: {
+							valid = v.index(ops + 1, p_data.methods.size());
+						} break;
+						case GF::OPCODE_CALL_NATIVE_STATIC: {
+							valid = v.index(ops, p_data.methods.size());
+						} break;
+						case GF::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN:
+						case GF::OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN:
+						case GF::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+						case GF::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+							if (!v.index(ops + 1, p_data.methods.size())) {
+								valid = false;
+								break;
+							}
+							const MethodBind *method = p_data.methods[code[ops + 1]];
+							const bool has_return = opcode == GF::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN || opcode == GF::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN;
+							valid = !method->is_vararg() && method->get_argument_count() == argc && method->has_return() == has_return;
+						} break;
+						default:
+							break;
+					}
+				} break;
+				default: {
+					// Unknown opcodes, and lambdas which are never cached.
+					valid = false;
+				} break;
+			}
+		}
+
+		if (!valid || size <= 0) {
+			return false;
+		}
+		ip += size;
+	}
+
+	// Jumps and default argument entry points must land on the start of an instruction.
+	for (int position : jump_positions) {
+		const int target = code[position];
+		if (target < 0 || target >= code_size || !instruction_starts[target]) {
+			return false;
+		}
+	}
+	for (int position : iterate_jump_positions) {
+		if (code[code[position]] != GF::OPCODE_ITERATE_INT) {
+			return false;
+		}
+	}
+	for (int target : p_data.default_arguments) {
+		if (target < 0 || target >= code_size || !instruction_starts[target]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void GDScriptBytecodeCache::apply_function_data(const FunctionData &p_data, GDScriptFunction *p_function) {
+	p_function->code = p_data.code;
+	p_function->_code_ptr = p_function->code.is_empty() ? nullptr : &p_function->code.write[0];
+	p_function->_code_size = p_function->code.size();
+
+	p_function->default_arguments = p_data.default_arguments;
+	if (p_function->default_arguments.size()) {
+		p_function->_default_arg_count = p_function->default_arguments.size() - 1;
+		p_function->_default_arg_ptr = &p_function->default_arguments[0];
+	} else {
+		p_function->_default_arg_count = 0;
+		p_function->_default_arg_ptr = nullptr;
+	}
+
+	p_function->temporary_slots.clear();
+	for (const Pair<int, Variant::Type> &E : p_data.temporary_slots) {
+		p_function->temporary_slots[E.first] = E.second;
+	}
+
+	p_function->constants = p_data.constants;
+	p_function->_constant_count = p_function->constants.size();
+	p_function->_constants_ptr = p_function->constants.is_empty() ? nullptr : p_function->constants.ptrw();
+
+	p_function->global_names = p_data.global_names;
+	p_function->_global_names_count = p_function->global_names.size();
+	p_function->_global_names_ptr = p_function->global_names.is_empty() ? nullptr : p_function->global_names.ptr();
+
+#define APPLY_TABLE(m_table)                                                                             \
+	p_function->m_table = p_data.m_table;                                                                \
+	p_function->_##m_table##_count = p_function->m_table.size();                                         \
+	p_function->_##m_table##_ptr = p_function->m_table.is_empty() ? nullptr : p_function->m_table.ptr();
+
+	APPLY_TABLE(operator_funcs);
+	APPLY_TABLE(setters);
+	APPLY_TABLE(getters);
+	APPLY_TABLE(keyed_setters);
+	APPLY_TABLE(keyed_getters);
+	APPLY_TABLE(indexed_setters);
+	APPLY_TABLE(indexed_getters);
+	APPLY_TABLE(builtin_methods);
+	APPLY_TABLE(constructors);
+	APPLY_TABLE(utilities);
+	APPLY_TABLE(gds_utilities);
+
+#undef APPLY_TABLE
+
+	p_function->methods = p_data.methods;
+	p_function->_methods_count = p_function->methods.size();
+	p_function->_methods_ptr = p_function->methods.is_empty() ? nullptr : p_function->methods.ptrw();
+
+	p_function->_stack_size = p_data.stack_size;
+	p_function->_instruction_args_size = p_data.instruction_args_size;
+
+#ifdef DEBUG_ENABLED
+	p_function->operator_names = p_data.operator_names;
+	p_function->setter_names = p_data.setter_names;
+	p_function->getter_names = p_data.getter_names;
+	p_function->builtin_methods_names = p_data.builtin_methods_names;
+	p_function->constructors_names = p_data.constructors_names;
+	p_function->utilities_names = p_data.utilities_names;
+	p_function->gds_utilities_names = p_data.gds_utilities_names;
+#endif
+}
+
+void GDScriptBytecodeCache::_write_function(Ref<FileAccess> p_file, const FunctionData &p_data) {
+	const GDScriptBytecodeBindings *names = _get_bindings();
+
+	p_file->store_32(p_data.layout_hash);
+	p_file->store_32(p_data.stack_size);
+	p_file->store_32(p_data.instruction_args_size);
+
+	p_file->store_32(p_data.code.size());
+	for (int E : p_data.code) {
+		p_file->store_32(E);
+	}
+	p_file->store_32(p_data.default_arguments.size());
+	for (int E : p_data.default_arguments) {
+		p_file->store_32(E);
+	}
+	p_file->store_32(p_data.temporary_slots.size());
+	for (const Pair<int, Variant::Type> &E : p_data.temporary_slots) {
+		p_file->store_32(E.first);
+		p_file->store_32(E.second);
+	}
+
+	p_file->store_32(p_data.constants.size());
+	for (int i = 0; i < p_data.constants.size(); i++) {
+		const Variant &constant = p_data.constants[i];
+		StringName global_name;
+		for (const Pair<int, StringName> &E : p_data.global_constants) {
+			if (E.first == i) {
+				global_name = E.second;
+				break;
+			}
+		}
+
+		if (global_name != StringName()) {
+			p_file->store_8(CACHED_CONSTANT_GLOBAL);
+			p_file->store_pascal_string(global_name);
+		} else if (constant.get_type() == Variant::OBJECT) {
+			p_file->store_8(CACHED_CONSTANT_NULL_OBJECT);
+		} else {
+			bool read_only = false;
+			if (constant.get_type() == Variant::ARRAY) {
+				read_only = Array(constant).is_read_only();
+			} else if (constant.get_type() == Variant::DICTIONARY) {
+				read_only = Dictionary(constant).is_read_only();
+			}
+			p_file->store_8(CACHED_CONSTANT_VARIANT);
+			p_file->store_8(read_only);
+			p_file->store_var(constant);
+		}
+	}
+
+	p_file->store_32(p_data.global_names.size());
+	for (const StringName &E : p_data.global_names) {
+		p_file->store_pascal_string(E);
+	}
+	p_file->store_32(p_data.global_relocations.size());
+	for (const Pair<int, StringName> &E : p_data.global_relocations) {
+		p_file->store_32(E.first);
+		p_file->store_pascal_string(E.second);
+	}
+
+	p_file->store_32(p_data.operator_funcs.size());
+	for (const Variant::ValidatedOperatorEvaluator &E : p_data.operator_funcs) {
+		p_file->store_32(names->operators[E]);
+	}
+	p_file->store_32(p_data.setters.size());
+	for (const Variant::ValidatedSetter &E : p_data.setters) {
+		p_file->store_32(names->setters[E].type);
+		p_file->store_pascal_string(names->setters[E].name);
+	}
+	p_file->store_32(p_data.getters.size());
+	for (const Variant::ValidatedGetter &E : p_data.getters) {
+		p_file->store_32(names->getters[E].type);
+		p_file->store_pascal_string(names->getters[E].name);
+	}
+	p_file->store_32(p_data.keyed_setters.size());
+	for (const Variant::ValidatedKeyedSetter &E : p_data.keyed_setters) {
+		p_file->store_32(names->keyed_setters[E]);
+	}
+	p_file->store_32(p_data.keyed_getters.size());
+	for (const Variant::ValidatedKeyedGetter &E : p_data.keyed_getters) {
+		p_file->store_32(names->keyed_getters[E]);
+	}
+	p_file->store_32(p_data.indexed_setters.size());
+	for (const Variant::ValidatedIndexedSetter &E : p_data.indexed_setters) {
+		p_file->store_32(names->indexed_setters[E]);
+	}
+	p_file->store_32(p_data.indexed_getters.size());
+	for (const Variant::ValidatedIndexedGetter &E : p_data.indexed_getters) {
+		p_file->store_32(names->indexed_getters[E]);
+	}
+	p_file->store_32(p_data.builtin_methods.size());
+	for (const Variant::ValidatedBuiltInMethod &E : p_data.builtin_methods) {
+		p_file->store_32(names->builtin_methods[E].type);
+		p_file->store_pascal_string(names->builtin_methods[E].name);
+	}
+	p_file->store_32(p_data.constructors.size());
+	for (const Variant::ValidatedConstructor &E : p_data.constructors) {
+		p_file->store_32(names->constructors[E].first);
+		p_file->store_32(names->constructors[E].second);
+	}
+	p_file->store_32(p_data.utilities.size());
+	for (const Variant::ValidatedUtilityFunction &E : p_data.utilities) {
+		p_file->store_pascal_string(names->utilities[E]);
+	}
+	p_file->store_32(p_data.gds_utilities.size());
+	for (const GDScriptUtilityFunctions::FunctionPtr &E : p_data.gds_utilities) {
+		p_file->store_pascal_string(names->gds_utilities[E]);
+	}
+	p_file->store_32(p_data.methods.size());
+	for (const MethodBind *E : p_data.methods) {
+		p_file->store_pascal_string(E->get_instance_class());
+		p_file->store_pascal_string(E->get_name());
+	}
+}
+
+bool GDScriptBytecodeCache::_read_function(Ref<FileAccess> p_file, FunctionData &r_data) {
+	const HashMap<StringName, int> &global_map = GDScriptLanguage::get_singleton()->get_global_map();
+	const Variant *global_array = GDScriptLanguage::get_singleton()->get_global_array();
+	uint32_t count = 0;
+
+	r_data.layout_hash = p_file->get_32();
+	r_data.stack_size = p_file->get_32();
+	r_data.instruction_args_size = p_file->get_32();
+
+	if (!_read_count(p_file, count) || count == 0) {
+		return false;
+	}
+	r_data.code.resize(count);
+#ifdef BIG_ENDIAN_ENABLED
+	for (uint32_t i = 0; i < count; i++) {
+		r_data.code.write[i] = p_file->get_32();
+	}
+#else
+	// Stored little endian, so it's a straight copy (out of the mapping when the file is mapped).
+	if (p_file->get_buffer((uint8_t *)r_data.code.ptrw(), count * sizeof(int)) != count * sizeof(int)) {
+		return false;
+	}
+#endif
+	if (r_data.code[count - 1] != GDScriptFunction::OPCODE_END) {
+		return false;
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		int position = p_file->get_32();
+		if (position < 0 || position >= r_data.code.size()) {
+			return false;
+		}
+		r_data.default_arguments.push_back(position);
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		int slot = p_file->get_32();
+		Variant::Type type;
+		if (slot < 0 || slot >= r_data.stack_size || !_read_type(p_file, type)) {
+			return false;
+		}
+		r_data.temporary_slots.push_back(Pair<int, Variant::Type>(slot, type));
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		switch (p_file->get_8()) {
+			case CACHED_CONSTANT_VARIANT: {
+				bool read_only = p_file->get_8();
+				Variant constant = p_file->get_var();
+				if (read_only) {
+					if (constant.get_type() == Variant::ARRAY) {
+						Array(constant).make_read_only();
+					} else if (constant.get_type() == Variant::DICTIONARY) {
+						Dictionary(constant).make_read_only();
+					}
+				}
+				r_data.constants.push_back(constant);
+			} break;
+			case CACHED_CONSTANT_NULL_OBJECT: {
+				r_data.constants.push_back(Variant((Object *)nullptr));
+			} break;
+			case CACHED_CONSTANT_GLOBAL: {
+				StringName global_name = p_file->get_pascal_string();
+				const int *index = global_map.getptr(global_name);
+				if (index == nullptr || global_array[*index].get_type() != Variant::OBJECT) {
+					return false;
+				}
+				r_data.global_constants.push_back(Pair<int, StringName>(i, global_name));
+				r_data.constants.push_back(global_array[*index]);
+			} break;
+			default:
+				return false;
+		}
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		r_data.global_names.push_back(p_file->get_pascal_string());
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		int position = p_file->get_32();
+		StringName global_name = p_file->get_pascal_string();
+		const int *index = global_map.getptr(global_name);
+		if (position < 0 || position >= r_data.code.size() || index == nullptr) {
+			return false;
+		}
+		r_data.code.write[position] = *index;
+		r_data.global_relocations.push_back(Pair<int, StringName>(position, global_name));
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t key = p_file->get_32();
+		Variant::Operator op = (Variant::Operator)(key & 0xFF);
+		Variant::Type type_a = (Variant::Type)((key >> 8) & 0xFF);
+		Variant::Type type_b = (Variant::Type)((key >> 16) & 0xFF);
+		if (op >= Variant::OP_MAX || type_a >= Variant::VARIANT_MAX || type_b >= Variant::VARIANT_MAX) {
+			return false;
+		}
+		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(op, type_a, type_b);
+		if (op_func == nullptr) {
+			return false;
+		}
+		r_data.operator_funcs.push_back(op_func);
+#ifdef DEBUG_ENABLED
+		r_data.operator_names.push_back(Variant::get_operator_name(op));
+#endif
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		Variant::Type type;
+		bool valid_type = _read_type(p_file, type);
+		StringName name = p_file->get_pascal_string();
+		Variant::ValidatedSetter setter = valid_type ? Variant::get_member_validated_setter(type, name) : nullptr;
+		if (setter == nullptr) {
+			return false;
+		}
+		r_data.setters.push_back(setter);
+#ifdef DEBUG_ENABLED
+		r_data.setter_names.push_back(name);
+#endif
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		Variant::Type type;
+		bool valid_type = _read_type(p_file, type);
+		StringName name = p_file->get_pascal_string();
+		Variant::ValidatedGetter getter = valid_type ? Variant::get_member_validated_getter(type, name) : nullptr;
+		if (getter == nullptr) {
+			return false;
+		}
+		r_data.getters.push_back(getter);
+#ifdef DEBUG_ENABLED
+		r_data.getter_names.push_back(name);
+#endif
+	}
+
+#define READ_TYPED_TABLE(m_table, m_getter)                          \
+	if (!_read_count(p_file, count)) {                               \
+		return false;                                                \
+	}                                                                \
+	for (uint32_t i = 0; i < count; i++) {                           \
+		Variant::Type type;                                          \
+		if (!_read_type(p_file, type) || !Variant::m_getter(type)) { \
+			return false;                                            \
+		}                                                            \
+		r_data.m_table.push_back(Variant::m_getter(type));           \
+	}
+
+	READ_TYPED_TABLE(keyed_setters, get_member_validated_keyed_setter);
+	READ_TYPED_TABLE(keyed_getters, get_member_validated_keyed_getter);
+	READ_TYPED_TABLE(indexed_setters, get_member_validated_indexed_setter);
+	READ_TYPED_TABLE(indexed_getters, get_member_validated_indexed_getter);
+
+#undef READ_TYPED_TABLE
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		Variant::Type type;
+		bool valid_type = _read_type(p_file, type);
+		StringName name = p_file->get_pascal_string();
+		if (!valid_type || !Variant::has_builtin_method(type, name)) {
+			return false;
+		}
+		r_data.builtin_methods.push_back(Variant::get_validated_builtin_method(type, name));
+		r_data.builtin_methods_argument_counts.push_back(Variant::is_builtin_method_vararg(type, name) ? -1 : Variant::get_builtin_method_argument_count(type, name));
+#ifdef DEBUG_ENABLED
+		r_data.builtin_methods_names.push_back(name);
+#endif
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		Variant::Type type;
+		bool valid_type = _read_type(p_file, type);
+		int index = p_file->get_32();
+		if (!valid_type || index < 0 || index >= Variant::get_constructor_count(type)) {
+			return false;
+		}
+		r_data.constructors.push_back(Variant::get_validated_constructor(type, index));
+		r_data.constructors_argument_counts.push_back(Variant::get_constructor_argument_count(type, index));
+#ifdef DEBUG_ENABLED
+		r_data.constructors_names.push_back(Variant::get_type_name(type));
+#endif
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		StringName name = p_file->get_pascal_string();
+		Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(name);
+		if (utility == nullptr) {
+			return false;
+		}
+		r_data.utilities.push_back(utility);
+		r_data.utilities_argument_counts.push_back(Variant::is_utility_function_vararg(name) ? -1 : Variant::get_utility_function_argument_count(name));
+#ifdef DEBUG_ENABLED
+		r_data.utilities_names.push_back(name);
+#endif
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		StringName name = p_file->get_pascal_string();
+		if (!GDScriptUtilityFunctions::function_exists(name)) {
+			return false;
+		}
+		r_data.gds_utilities.push_back(GDScriptUtilityFunctions::get_function(name));
+		r_data.gds_utilities_argument_counts.push_back(GDScriptUtilityFunctions::is_function_vararg(name) ? -1 : GDScriptUtilityFunctions::get_function_argument_count(name));
+#ifdef DEBUG_ENABLED
+		r_data.gds_utilities_names.push_back(name);
+#endif
+	}
+
+	if (!_read_count(p_file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		StringName class_name = p_file->get_pascal_string();
+		StringName method_name = p_file->get_pascal_string();
+		MethodBind *method = ClassDB::get_method(class_name, method_name);
+		if (method == nullptr) {
+			return false;
+		}
+		r_data.methods.push_back(method);
+	}
+
+	return !p_file->eof_reached() && p_file->get_error() == OK;
+}
+
+bool GDScriptBytecodeCache::load(const String &p_script_path, const ScriptKey &p_script_key, ScriptData &r_data) {
+	String cache_file = _get_cache_file(p_script_path);
+	if (!FileAccess::exists(cache_file)) {
+		return false;
+	}
+	Ref<FileAccess> file = FileAccess::open(cache_file, FileAccess::READ);
+	if (file.is_null()) {
+		return false;
+	}
+	// Optional, reads fall back to regular file access if the file can't be mapped.
+	file->map_to_memory();
+
+	uint8_t magic[4] = {};
+	file->get_buffer(magic, 4);
+	if (memcmp(magic, bytecode_cache_magic, 4) != 0 || file->get_32() != BYTECODE_CACHE_FORMAT_VERSION) {
+		return false;
+	}
+	if (file->get_pascal_string() != _get_engine_fingerprint()) {
+		return false;
+	}
+	ScriptKey key;
+	if (file->get_buffer(key.sha256, sizeof(key.sha256)) != sizeof(key.sha256) || key != p_script_key) {
+		return false;
+	}
+
+	uint32_t count = 0;
+	if (!_read_count(file, count)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		String key = file->get_pascal_string();
+		FunctionData data;
+		if (!_read_function(file, data)) {
+			r_data.functions.clear();
+			return false;
+		}
+		r_data.functions.insert(key, data);
+	}
+	return true;
+}
+
+Error GDScriptBytecodeCache::save(const String &p_script_path, const ScriptKey &p_script_key, const ScriptData &p_data) {
+	String cache_file = _get_cache_file(p_script_path);
+	if (!DirAccess::dir_exists_absolute(cache_file.get_base_dir())) {
+		Error err = DirAccess::make_dir_recursive_absolute(cache_file.get_base_dir());
+		ERR_FAIL_COND_V_MSG(err != OK, err, vformat(R"(Cannot create the GDScript bytecode cache directory "%s".)", cache_file.get_base_dir()));
+	}
+
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(cache_file, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(file.is_null(), err, vformat(R"(Cannot write the GDScript bytecode cache file "%s".)", cache_file));
+
+	file->store_buffer(bytecode_cache_magic, 4);
+	file->store_32(BYTECODE_CACHE_FORMAT_VERSION);
+	file->store_pascal_string(_get_engine_fingerprint());
+	file->store_buffer(p_script_key.sha256, sizeof(p_script_key.sha256));
+
+	file->store_32(p_data.functions.size());
+	for (const KeyValue<String, FunctionData> &E : p_data.functions) {
+		file->store_pascal_string(E.key);
+		_write_function(file, E.value);
+	}
+	return file->get_error();
+}
+
+void GDScriptBytecodeCache::clear() {
+	MutexLock lock(bindings_mutex);
+	if (bindings) {
+		memdelete(bindings);
+		bindings = nullptr;
+	}
+}
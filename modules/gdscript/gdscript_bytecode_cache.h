@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "gdscript_function.h"
+
+#include "core/io/file_access.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/pair.h"
+
+class GDScript;
+class GDScriptParser;
+
+// On-disk cache of compiled function bytecode, so scripts whose source and
+// dependencies did not change can skip code generation on the next run.
+// Pointers to engine bindings (validated operators, setters, method binds, ...)
+// are stored by name and resolved again when loading, so cache files stay
+// valid across runs of the same engine build.
+class GDScriptBytecodeCache {
+public:
+	struct FunctionData {
+		uint32_t layout_hash = 0;
+		int stack_size = 0;
+		int instruction_args_size = 0;
+
+		Vector<int> code;
+		Vector<int> default_arguments;
+		Vector<Pair<int, Variant::Type>> temporary_slots;
+		Vector<Variant> constants;
+		Vector<StringName> global_names;
+		// Code positions holding an index into the language global array, which is not stable across runs.
+		Vector<Pair<int, StringName>> global_relocations;
+		// Object constants which are language globals (singletons, native classes), stored by name.
+		Vector<Pair<int, StringName>> global_constants;
+
+		Vector<Variant::ValidatedOperatorEvaluator> operator_funcs;
+		Vector<Variant::ValidatedSetter> setters;
+		Vector<Variant::ValidatedGetter> getters;
+		Vector<Variant::ValidatedKeyedSetter> keyed_setters;
+		Vector<Variant::ValidatedKeyedGetter> keyed_getters;
+		Vector<Variant::ValidatedIndexedSetter> indexed_setters;
+		Vector<Variant::ValidatedIndexedGetter> indexed_getters;
+		Vector<Variant::ValidatedBuiltInMethod> builtin_methods;
+		Vector<Variant::ValidatedConstructor> constructors;
+		Vector<Variant::ValidatedUtilityFunction> utilities;
+		Vector<GDScriptUtilityFunctions::FunctionPtr> gds_utilities;
+		Vector<MethodBind *> methods;
+
+		// Argument counts expected by the validated calls in each table (-1 for vararg). Only filled when loading.
+		Vector<int> builtin_methods_argument_counts;
+		Vector<int> constructors_argument_counts;
+		Vector<int> utilities_argument_counts;
+		Vector<int> gds_utilities_argument_counts;
+
+#ifdef DEBUG_ENABLED
+		Vector<String> operator_names;
+		Vector<String> setter_names;
+		Vector<String> getter_names;
+		Vector<String> builtin_methods_names;
+		Vector<String> constructors_names;
+		Vector<String> utilities_names;
+		Vector<String> gds_utilities_names;
+#endif
+	};
+
+	struct ScriptData {
+		HashMap<String, FunctionData> functions;
+	};
+
+	// SHA-256 of everything the compiled code of a script depends on. Stored in full in the cache file and compared
+	// byte by byte when loading, so a changed script can't pick up stale bytecode through a hash collision.
+	struct ScriptKey {
+		uint8_t sha256[32] = {};
+
+		bool operator==(const ScriptKey &p_other) const { return memcmp(sha256, p_other.sha256, sizeof(sha256)) == 0; }
+		bool operator!=(const ScriptKey &p_other) const { return !(*this == p_other); }
+	};
+
+private:
+	static String _get_cache_file(const String &p_script_path);
+	static bool _is_constant_cacheable(const Variant &p_constant, bool p_nested);
+	static bool _read_function(Ref<FileAccess> p_file, FunctionData &r_data);
+	static void _write_function(Ref<FileAccess> p_file, const FunctionData &p_data);
+
+public:
+	static bool is_enabled();
+
+	// Hashes the engine fingerprint, the source of the script, the sources of all the scripts it depends on
+	// and the names of the language globals, since compiled code embeds information from all of them.
+	static ScriptKey get_script_key(const GDScript *p_script, const GDScriptParser *p_parser);
+	// Member and static variable indices of a class, which also depend on its base classes.
+	static uint32_t get_layout_hash(const GDScript *p_script);
+	static String get_function_key(const GDScript *p_script, const StringName &p_function_name);
+
+	static bool load(const String &p_script_path, const ScriptKey &p_script_key, ScriptData &r_data);
+	static Error save(const String &p_script_path, const ScriptKey &p_script_key, const ScriptData &p_data);
+
+	// Returns `false` if the function holds data that cannot be stored (lambdas, object constants, extension methods, ...).
+	static bool make_function_data(const GDScriptFunction *p_function, const Vector<int> &p_global_index_positions, FunctionData &r_data);
+	// Checks loaded bytecode before it is used, so a corrupted or tampered file cannot make the VM read or jump
+	// out of bounds: instructions must be complete, addresses, table indices and jump targets in range.
+	static bool validate_function_data(const FunctionData &p_data, const GDScript *p_script, int p_argument_count, int p_optional_argument_count);
+	// Replaces the code of a function emitted without a body with the cached one.
+	static void apply_function_data(const FunctionData &p_data, GDScriptFunction *p_function);
+
+	static void clear();
+};
@@ -35,6 +35,7 @@
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 
+#include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
 #include "core/templates/vector.h"
 
@@ -50,6 +51,10 @@ uint32_t GDScriptParserRef::get_source_hash() const {
 	return source_hash;
 }
 
+const uint8_t *GDScriptParserRef::get_source_sha256() const {
+	return source_sha256;
+}
+
 GDScriptParser *GDScriptParserRef::get_parser() {
 	if (parser == nullptr) {
 		parser = memnew(GDScriptParser);
@@ -79,10 +84,13 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				if (remapped_path.get_extension().to_lower() == "gdc") {
 					Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
 					source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+					CryptoCore::sha256(tokens.ptr(), tokens.size(), source_sha256);
 					result = get_parser()->parse_binary(tokens, path);
 				} else {
 					String source = GDScriptCache::get_source_code(remapped_path);
 					source_hash = source.hash();
+					const CharString source_utf8 = source.utf8();
+					CryptoCore::sha256((const uint8_t *)source_utf8.get_data(), source_utf8.length(), source_sha256);
 					result = get_parser()->parse(source, path, false);
 				}
 			} break;
@@ -121,6 +129,7 @@ void GDScriptParserRef::clear() {
 	status = EMPTY;
 	result = OK;
 	source_hash = 0;
+	memset(source_sha256, 0, sizeof(source_sha256));
 
 	clearing = false;
 
@@ -57,6 +57,7 @@ private:
 	Error result = OK;
 	String path;
 	uint32_t source_hash = 0;
+	uint8_t source_sha256[32] = {}; // Keys the bytecode cache of the scripts depending on this one.
 	bool clearing = false;
 	bool abandoned = false;
 
@@ -67,6 +68,7 @@ public:
 	Status get_status() const;
 	String get_path() const;
 	uint32_t get_source_hash() const;
+	const uint8_t *get_source_sha256() const;
 	GDScriptParser *get_parser();
 	GDScriptAnalyzer *get_analyzer();
 	Error raise_status(Status p_new_status);
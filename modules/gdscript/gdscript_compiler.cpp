@@ -2293,6 +2293,19 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 	}
 	codegen.generator->write_start(p_script, func_name, is_static, rpc_config, return_type);
 
+	// Lambdas are not cached, they are compiled along with the function creating them.
+	String cache_key;
+	uint32_t cache_layout_hash = 0;
+	const GDScriptBytecodeCache::FunctionData *cached_function = nullptr;
+	if (bytecode_cache_enabled && !p_for_lambda) {
+		cache_key = GDScriptBytecodeCache::get_function_key(p_script, func_name);
+		cache_layout_hash = GDScriptBytecodeCache::get_layout_hash(p_script);
+		cached_function = bytecode_cache_loaded.functions.getptr(cache_key);
+		if (cached_function && cached_function->layout_hash != cache_layout_hash) {
+			cached_function = nullptr;
+		}
+	}
+
 	int optional_parameters = 0;
 
 	if (p_func) {
@@ -2312,12 +2325,17 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 		method_info.default_arguments.append_array(p_func->default_arg_values);
 	}
 
+	// A cache file which doesn't hold up is ignored, the function is compiled and the cache rewritten.
+	if (cached_function && !GDScriptBytecodeCache::validate_function_data(*cached_function, p_script, p_func ? p_func->parameters.size() : 0, optional_parameters)) {
+		cached_function = nullptr;
+	}
+
 	// Parse initializer if applies.
 	bool is_implicit_initializer = !p_for_ready && !p_func && !p_for_lambda;
 	bool is_initializer = p_func && !p_for_lambda && p_func->identifier->name == GDScriptLanguage::get_singleton()->strings._init;
 	bool is_implicit_ready = !p_func && p_for_ready;
 
-	if (!p_for_lambda && is_implicit_initializer) {
+	if (!p_for_lambda && is_implicit_initializer && !cached_function) {
 		// Initialize the default values for typed variables before anything.
 		// This avoids crashes if they are accessed with validated calls before being properly initialized.
 		// It may happen with out-of-order access or with `@onready` variables.
@@ -2350,7 +2368,7 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 		}
 	}
 
-	if (!p_for_lambda && (is_implicit_initializer || is_implicit_ready)) {
+	if (!p_for_lambda && (is_implicit_initializer || is_implicit_ready) && !cached_function) {
 		// Initialize class fields.
 		for (int i = 0; i < p_class->members.size(); i++) {
 			if (p_class->members[i].type != GDScriptParser::ClassNode::Member::VARIABLE) {
@@ -2392,7 +2410,7 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 	}
 
 	// Parse default argument code if applies.
-	if (p_func) {
+	if (p_func && !cached_function) {
 		if (optional_parameters > 0) {
 			codegen.generator->start_parameters();
 			for (int i = p_func->parameters.size() - optional_parameters; i < p_func->parameters.size(); i++) {
@@ -2457,6 +2475,19 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 
 	GDScriptFunction *gd_function = codegen.generator->write_end();
 
+	if (cached_function) {
+		GDScriptBytecodeCache::apply_function_data(*cached_function, gd_function);
+		bytecode_cache_stored.functions[cache_key] = *cached_function;
+	} else if (!cache_key.is_empty()) {
+		GDScriptBytecodeCache::FunctionData function_data;
+		const GDScriptByteCodeGenerator *bytecode_generator = static_cast<GDScriptByteCodeGenerator *>(codegen.generator);
+		if (GDScriptBytecodeCache::make_function_data(gd_function, bytecode_generator->get_global_index_positions(), function_data)) {
+			function_data.layout_hash = cache_layout_hash;
+			bytecode_cache_stored.functions[cache_key] = function_data;
+			bytecode_cache_outdated = true;
+		}
+	}
+
 	if (is_initializer) {
 		p_script->initializer = gd_function;
 	} else if (is_implicit_initializer) {
@@ -3273,11 +3304,24 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 		return err;
 	}
 
+	// Member indices are known at this point, so the cached bytecode can be checked against them.
+	// The debugger needs the local variable information which is not cached.
+	bytecode_cache_enabled = GDScriptBytecodeCache::is_enabled() && main_script->path.is_resource_file() && !EngineDebugger::is_active();
+	GDScriptBytecodeCache::ScriptKey bytecode_cache_key;
+	if (bytecode_cache_enabled) {
+		bytecode_cache_key = GDScriptBytecodeCache::get_script_key(main_script, parser);
+		GDScriptBytecodeCache::load(main_script->path, bytecode_cache_key, bytecode_cache_loaded);
+	}
+
 	err = _compile_class(main_script, root, p_keep_state);
 	if (err) {
 		return err;
 	}
 
+	if (bytecode_cache_outdated) {
+		GDScriptBytecodeCache::save(main_script->path, bytecode_cache_key, bytecode_cache_stored);
+	}
+
 	ScriptLambdaInfo new_lambda_info = _get_script_lambda_replacement_info(p_script);
 
 	HashMap<GDScriptFunction *, GDScriptFunction *> func_ptr_replacements;
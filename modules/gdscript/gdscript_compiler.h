@@ -31,6 +31,7 @@
 #pragma once
 
 #include "gdscript.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_codegen.h"
 #include "gdscript_function.h"
 #include "gdscript_parser.h"
@@ -43,6 +44,12 @@ class GDScriptCompiler {
 	HashSet<GDScript *> parsing_classes;
 	GDScript *main_script = nullptr;
 
+	// Functions reused from and to be written to the bytecode cache.
+	bool bytecode_cache_enabled = false;
+	bool bytecode_cache_outdated = false;
+	GDScriptBytecodeCache::ScriptData bytecode_cache_loaded;
+	GDScriptBytecodeCache::ScriptData bytecode_cache_stored;
+
 	struct FunctionLambdaInfo {
 		GDScriptFunction *function = nullptr;
 		GDScriptFunction *parent = nullptr;
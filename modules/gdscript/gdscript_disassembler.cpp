@@ -141,6 +141,35 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_OPERATOR_INT:
+			case OPCODE_OPERATOR_FLOAT: {
+				text += opcode == OPCODE_OPERATOR_INT ? "int operator " : "float operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += Variant::get_operator_name(Variant::Operator(_code_ptr[ip + 4]));
+				text += " ";
+				text += DADDR(2);
+
+				incr += 5;
+			} break;
+			case OPCODE_COMPARE_JUMP_INT:
+			case OPCODE_COMPARE_JUMP_FLOAT: {
+				text += opcode == OPCODE_COMPARE_JUMP_INT ? "int compare-jump " : "float compare-jump ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += Variant::get_operator_name(Variant::Operator(_code_ptr[ip + 4]));
+				text += " ";
+				text += DADDR(2);
+
+				// The fused conditional jump follows, and is listed on its own.
+				incr += 5;
+			} break;
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -1042,6 +1071,12 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr = 2;
 			} break;
+			case OPCODE_JUMP_ITERATE_INT: {
+				text += "jump-iterate int ";
+				text += itos(_code_ptr[ip + 1]);
+
+				incr = 2;
+			} break;
 			case OPCODE_JUMP_IF: {
 				text += "jump-if ";
 				text += DADDR(1);
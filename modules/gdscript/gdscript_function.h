@@ -256,6 +256,10 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_INT, // Validated operator on two ints, with the operator inlined.
+		OPCODE_OPERATOR_FLOAT, // Validated operator on two floats, with the operator inlined.
+		OPCODE_COMPARE_JUMP_INT, // OPCODE_OPERATOR_INT comparison fused with the conditional jump after it.
+		OPCODE_COMPARE_JUMP_FLOAT, // OPCODE_OPERATOR_FLOAT comparison fused with the conditional jump after it.
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -318,6 +322,7 @@ public:
 		OPCODE_JUMP_IF_NOT,
 		OPCODE_JUMP_TO_DEF_ARGUMENT,
 		OPCODE_JUMP_IF_SHARED,
+		OPCODE_JUMP_ITERATE_INT, // Jump back to an OPCODE_ITERATE_INT, running it in the same dispatch.
 		OPCODE_RETURN,
 		OPCODE_RETURN_TYPED_BUILTIN,
 		OPCODE_RETURN_TYPED_ARRAY,
@@ -441,6 +446,7 @@ public:
 
 private:
 	friend class GDScript;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
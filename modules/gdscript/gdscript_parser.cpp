@@ -786,7 +786,7 @@ Ref<GDScriptParserRef> GDScriptParser::get_depended_parser_for(const String &p_p
 	return ref;
 }
 
-const HashMap<String, Ref<GDScriptParserRef>> &GDScriptParser::get_depended_parsers() {
+const HashMap<String, Ref<GDScriptParserRef>> &GDScriptParser::get_depended_parsers() const {
 	return depended_parsers;
 }
 
@@ -1580,7 +1580,7 @@ public:
 	ClassNode *get_tree() const { return head; }
 	bool is_tool() const { return _is_tool; }
 	Ref<GDScriptParserRef> get_depended_parser_for(const String &p_path);
-	const HashMap<String, Ref<GDScriptParserRef>> &get_depended_parsers();
+	const HashMap<String, Ref<GDScriptParserRef>> &get_depended_parsers() const;
 	ClassNode *find_class(const String &p_qualified_name) const;
 	bool has_class(const GDScriptParser::ClassNode *p_class) const;
 	static Variant::Type get_builtin_type(const StringName &p_type); // Excluding `Variant::NIL` and `Variant::OBJECT`.
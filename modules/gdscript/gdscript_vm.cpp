@@ -227,11 +227,57 @@ void (*type_init_function_table[])(Variant *) = {
 	&VariantInitializer<PackedVector4Array>::init, // PACKED_VECTOR4_ARRAY.
 };
 
+// Inlined versions of the validated arithmetic and comparison operators for ints and floats,
+// used by the specialized opcodes. They must give the same results as the evaluators in variant_op.h.
+// Only the operators the bytecode generator specializes are handled.
+
+template <typename T>
+static _FORCE_INLINE_ bool _compare_values(Variant::Operator p_operator, T p_left, T p_right) {
+	switch (p_operator) {
+		case Variant::OP_EQUAL:
+			return p_left == p_right;
+		case Variant::OP_NOT_EQUAL:
+			return p_left != p_right;
+		case Variant::OP_LESS:
+			return p_left < p_right;
+		case Variant::OP_LESS_EQUAL:
+			return p_left <= p_right;
+		case Variant::OP_GREATER:
+			return p_left > p_right;
+		case Variant::OP_GREATER_EQUAL:
+			return p_left >= p_right;
+		default:
+			return false;
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _evaluate_operator(Variant::Operator p_operator, T p_left, T p_right, T *r_value, bool *r_bool) {
+	switch (p_operator) {
+		case Variant::OP_ADD:
+			*r_value = p_left + p_right;
+			break;
+		case Variant::OP_SUBTRACT:
+			*r_value = p_left - p_right;
+			break;
+		case Variant::OP_MULTIPLY:
+			*r_value = p_left * p_right;
+			break;
+		default:
+			*r_bool = _compare_values<T>(p_operator, p_left, p_right);
+			break;
+	}
+}
+
 #if defined(__GNUC__) || defined(__clang__)
 #define OPCODES_TABLE                                    \
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_INT,                           \
+		&&OPCODE_OPERATOR_FLOAT,                         \
+		&&OPCODE_COMPARE_JUMP_INT,                       \
+		&&OPCODE_COMPARE_JUMP_FLOAT,                     \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
@@ -294,6 +340,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_JUMP_IF_NOT,                            \
 		&&OPCODE_JUMP_TO_DEF_ARGUMENT,                   \
 		&&OPCODE_JUMP_IF_SHARED,                         \
+		&&OPCODE_JUMP_ITERATE_INT,                       \
 		&&OPCODE_RETURN,                                 \
 		&&OPCODE_RETURN_TYPED_BUILTIN,                   \
 		&&OPCODE_RETURN_TYPED_ARRAY,                     \
@@ -816,6 +863,77 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_INT) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				// The result is either an int or a bool; both live in the same place, which was type-adjusted beforehand.
+				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				_evaluate_operator<int64_t>(op, *VariantInternal::get_int(a), *VariantInternal::get_int(b), VariantInternal::get_int(dst), VariantInternal::get_bool(dst));
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				Variant::Operator op = (Variant::Operator)_code_ptr[ip + 4];
+				_evaluate_operator<double>(op, *VariantInternal::get_float(a), *VariantInternal::get_float(b), VariantInternal::get_float(dst), VariantInternal::get_bool(dst));
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_COMPARE_JUMP_INT) {
+				// The original OPCODE_JUMP_IF(_NOT) is kept at ip + 5, so it's still there for jumps landing on it.
+				CHECK_SPACE(8);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				bool result = _compare_values<int64_t>((Variant::Operator)_code_ptr[ip + 4], *VariantInternal::get_int(a), *VariantInternal::get_int(b));
+				*VariantInternal::get_bool(dst) = result;
+
+				if (result == (_code_ptr[ip + 5] == OPCODE_JUMP_IF)) {
+					int to = _code_ptr[ip + 7];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 8;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_COMPARE_JUMP_FLOAT) {
+				// The original OPCODE_JUMP_IF(_NOT) is kept at ip + 5, so it's still there for jumps landing on it.
+				CHECK_SPACE(8);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				bool result = _compare_values<double>((Variant::Operator)_code_ptr[ip + 4], *VariantInternal::get_float(a), *VariantInternal::get_float(b));
+				*VariantInternal::get_bool(dst) = result;
+
+				if (result == (_code_ptr[ip + 5] == OPCODE_JUMP_IF)) {
+					int to = _code_ptr[ip + 7];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 8;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -2719,6 +2837,35 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_JUMP_ITERATE_INT) {
+				// Loop ends and `continue` land here instead of on a plain jump to the OPCODE_ITERATE_INT at the loop head.
+				CHECK_SPACE(2);
+				int to = _code_ptr[ip + 1];
+				GD_ERR_BREAK(to < 0 || to + 5 > _code_size);
+				GD_ERR_BREAK(_code_ptr[to] != OPCODE_ITERATE_INT);
+				ip = to;
+
+				GET_VARIANT_PTR(counter, 0);
+				GET_VARIANT_PTR(container, 1);
+
+				int64_t size = *VariantInternal::get_int(container);
+				int64_t *count = VariantInternal::get_int(counter);
+
+				(*count)++;
+
+				if (*count >= size) {
+					int jumpto = _code_ptr[ip + 4];
+					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
+					ip = jumpto;
+				} else {
+					GET_VARIANT_PTR(iterator, 2);
+					*VariantInternal::get_int(iterator) = *count;
+
+					ip += 5; // Loop again.
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_RETURN) {
 				CHECK_SPACE(2);
 				GET_VARIANT_PTR(r, 0);
@@ -0,0 +1,39 @@
+# Typed int and float operators use specialized opcodes, and comparisons
+# followed by a conditional jump are fused with it.
+
+func test():
+	var a := 3
+	var b := 5
+	print(a + b, " ", a - b, " ", a * b)
+	print(a == b, " ", a != b, " ", a < b, " ", a <= b, " ", a > b, " ", a >= b)
+
+	var x := 1.5
+	var y := -0.25
+	print(x + y, " ", x - y, " ", x * y)
+	print(x == y, " ", x != y, " ", x < y, " ", x <= y, " ", x > y, " ", x >= y)
+
+	if a < b:
+		print("if int")
+	if not (x < y):
+		print("if not float")
+	if a >= b:
+		print("unreachable")
+	elif x > y:
+		print("elif float")
+
+	var count := 0
+	while count < 4:
+		count += 1
+	print(count)
+
+	var f := 0.0
+	while f <= 1.0:
+		f += 0.5
+	print(f)
+
+	print(a < b and x > y, " ", a > b and x > y)
+	print(a > b or x < y, " ", a > b or x > y)
+	print("ternary int" if a != b else "wrong", " ", "wrong" if x == y else "ternary float")
+
+	var comparison := a < b
+	print(comparison)
@@ -0,0 +1,40 @@
+# Loops over a typed int run their iterate step in the jump back to the loop
+# head, both at the end of the body and on `continue`.
+
+func test():
+	var n := 5
+	var total := 0
+	for i in n:
+		total += i
+	print(total)
+
+	var odds: Array[int] = []
+	for i in n:
+		if i % 2 == 0:
+			continue
+		odds.push_back(i)
+	print(odds)
+
+	var last := -1
+	for i in n:
+		if i == 3:
+			break
+		last = i
+	print(last)
+
+	var pairs := 0
+	for _i in 3:
+		for _j in 4:
+			pairs += 1
+	print(pairs)
+
+	var empty := 0
+	var runs := 0
+	for _i in empty:
+		runs += 1
+	print(runs)
+
+	var floats: Array[float] = []
+	for i: float in 3:
+		floats.push_back(i / 2)
+	print(floats)
@@ -0,0 +1,190 @@
+/**************************************************************************/
+/*  test_gdscript_bytecode_cache.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../gdscript.h"
+#include "../gdscript_bytecode_cache.h"
+
+#include "core/config/project_settings.h"
+#include "core/io/file_access.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+TEST_CASE("[Modules][GDScript] Bytecode cache validation") {
+	typedef GDScriptFunction GF;
+
+	Ref<GDScript> gdscript = memnew(GDScript);
+
+	// return nil, reached through a jump.
+	GDScriptBytecodeCache::FunctionData data;
+	data.stack_size = GF::FIXED_ADDRESSES_MAX;
+	data.code = { GF::OPCODE_JUMP, 2, GF::OPCODE_RETURN, GF::ADDR_NIL, GF::OPCODE_END };
+	CHECK_MESSAGE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0), "Well-formed bytecode should be accepted.");
+
+	SUBCASE("Jump into the middle of an instruction") {
+		data.code.write[1] = 3;
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0));
+	}
+	SUBCASE("Jump out of the code") {
+		data.code.write[1] = 100;
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0));
+	}
+	SUBCASE("Invalid address mode") {
+		data.code.write[3] = GF::ADDR_TYPE_MAX << GF::ADDR_BITS;
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0));
+	}
+	SUBCASE("Constant index out of range") {
+		data.code.write[3] = GF::ADDR_TYPE_CONSTANT << GF::ADDR_BITS;
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0));
+		data.constants.push_back(Variant());
+		CHECK(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0));
+	}
+	SUBCASE("Stack too small") {
+		data.code.write[3] = GF::FIXED_ADDRESSES_MAX;
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0));
+		CHECK_FALSE_MESSAGE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 1, 0), "The stack must hold the arguments.");
+		data.stack_size++;
+		CHECK(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 1, 0));
+	}
+	SUBCASE("Truncated instruction") {
+		data.code = { GF::OPCODE_JUMP, 2, GF::OPCODE_RETURN, GF::OPCODE_END };
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0));
+	}
+	SUBCASE("Iterating jump not landing on an integer iterate") {
+		data.code.write[0] = GF::OPCODE_JUMP_ITERATE_INT;
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0));
+	}
+	SUBCASE("Unknown opcode") {
+		data.code.write[2] = GF::OPCODE_END + 1;
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 0, 0));
+	}
+	SUBCASE("Default arguments not matching the parameters") {
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 1, 1));
+		data.stack_size++;
+		data.default_arguments = { 0, 2 };
+		CHECK(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 1, 1));
+		data.default_arguments = { 0, 1 };
+		CHECK_FALSE(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 1, 1));
+	}
+}
+
+// TODO: Handle some cases failing on release builds. See: https://github.com/godotengine/godot/pull/88452
+#ifdef TOOLS_ENABLED
+static Ref<GDScript> _load_cached_script(const String &p_path, const String &p_source) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_path(p_path, true);
+	gdscript->set_source_code(p_source);
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	return error == OK ? gdscript : Ref<GDScript>();
+}
+
+static int _call_cached_script(const Ref<GDScript> &p_script) {
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(p_script);
+	return ref_counted->call("run", 3);
+}
+
+TEST_CASE("[Modules][GDScript] Bytecode cache round trip") {
+	const String source = R"(
+extends RefCounted
+
+var offset := 10
+
+func run(p_value: int, p_step := 2) -> int:
+	var total := offset
+	for i in p_value:
+		total += i * p_step
+	if total > 100:
+		return -1
+	return total
+)";
+	const String path = "res://bytecode_cache_test.gd";
+	const String cache_file = String("user://gdscript_cache").path_join(path.md5_text() + ".gdbc");
+	const bool was_enabled = GLOBAL_GET("debug/gdscript/bytecode_cache/enabled");
+	ProjectSettings::get_singleton()->set_setting("debug/gdscript/bytecode_cache/enabled", true);
+
+	{
+		Ref<GDScript> gdscript = _load_cached_script(path, source);
+		REQUIRE(gdscript.is_valid());
+
+		// The compiler output must pass the checks made on cached code.
+		const GDScriptFunction *function = gdscript->get_member_functions()["run"];
+		GDScriptBytecodeCache::FunctionData data;
+		REQUIRE(GDScriptBytecodeCache::make_function_data(function, Vector<int>(), data));
+		CHECK(GDScriptBytecodeCache::validate_function_data(data, gdscript.ptr(), 2, 1));
+
+		CHECK(_call_cached_script(gdscript) == 16);
+	}
+	REQUIRE_MESSAGE(FileAccess::exists(cache_file), "Compiling the script should write its bytecode cache.");
+
+	SUBCASE("Cached code runs") {
+		Ref<GDScript> gdscript = _load_cached_script(path, source);
+		REQUIRE(gdscript.is_valid());
+		CHECK(_call_cached_script(gdscript) == 16);
+	}
+	SUBCASE("Cache file of a different source is ignored") {
+		Ref<GDScript> gdscript = _load_cached_script(path, source.replace("total += i * p_step", "total += i * p_step + 1"));
+		REQUIRE(gdscript.is_valid());
+		CHECK_MESSAGE(_call_cached_script(gdscript) == 19, "Changing the source should not reuse the cached bytecode.");
+	}
+	SUBCASE("Garbage cache file is ignored") {
+		Vector<uint8_t> buffer = FileAccess::get_file_as_bytes(cache_file);
+		for (int i = 0; i < buffer.size(); i++) {
+			buffer.write[i] = (i * 131) & 0xFF;
+		}
+		Ref<FileAccess> file = FileAccess::open(cache_file, FileAccess::WRITE);
+		file->store_buffer(buffer);
+		file.unref();
+
+		Ref<GDScript> gdscript = _load_cached_script(path, source);
+		REQUIRE(gdscript.is_valid());
+		CHECK(_call_cached_script(gdscript) == 16);
+	}
+	SUBCASE("Truncated cache file is ignored") {
+		Vector<uint8_t> buffer = FileAccess::get_file_as_bytes(cache_file);
+		Ref<FileAccess> file = FileAccess::open(cache_file, FileAccess::WRITE);
+		file->store_buffer(buffer.ptr(), buffer.size() / 2);
+		file.unref();
+
+		Ref<GDScript> gdscript = _load_cached_script(path, source);
+		REQUIRE(gdscript.is_valid());
+		CHECK(_call_cached_script(gdscript) == 16);
+	}
+
+	ProjectSettings::get_singleton()->set_setting("debug/gdscript/bytecode_cache/enabled", was_enabled);
+}
+#endif // TOOLS_ENABLED
+
+} // namespace GDScriptTests
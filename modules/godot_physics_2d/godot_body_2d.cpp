@@ -419,7 +419,7 @@ void GodotBody2D::_update_transform_dependent() {
 	center_of_mass = get_transform().basis_xform(center_of_mass_local);
 }
 
-void GodotBody2D::integrate_forces(real_t p_step) {
+void GodotBody2D::integrate_forces(real_t p_step, bool p_defer_space_updates) {
 	if (mode == PhysicsServer2D::BODY_MODE_STATIC) {
 		return;
 	}
@@ -606,13 +606,18 @@ void GodotBody2D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector2();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		if (p_defer_space_updates) {
+			deferred_space_updates |= DEFERRED_UPDATE_SHAPES_WITH_MOTION;
+			deferred_motion = motion;
+		} else {
+			_update_shapes_with_motion(motion);
+		}
 	}
 
 	contact_count = 0;
 }
 
-void GodotBody2D::integrate_velocities(real_t p_step) {
+void GodotBody2D::integrate_velocities(real_t p_step, bool p_defer_space_updates) {
 	if (mode == PhysicsServer2D::BODY_MODE_STATIC) {
 		return;
 	}
@@ -620,14 +625,23 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 	ERR_FAIL_NULL(get_space());
 
 	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		if (p_defer_space_updates) {
+			deferred_space_updates |= DEFERRED_ADD_TO_STATE_QUERY_LIST;
+		} else {
+			get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		}
 	}
 
 	if (mode == PhysicsServer2D::BODY_MODE_KINEMATIC) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector2() && angular_velocity == 0) {
-			set_active(false); //stopped moving, deactivate
+			//stopped moving, deactivate
+			if (p_defer_space_updates) {
+				deferred_space_updates |= DEFERRED_DEACTIVATE;
+			} else {
+				set_active(false);
+			}
 		}
 		return;
 	}
@@ -644,8 +658,12 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 		pos += center_of_mass - center_of_mass.rotated(angle_delta);
 	}
 
-	_set_transform(Transform2D(angle, pos), continuous_cd_mode == PhysicsServer2D::CCD_MODE_DISABLED);
+	bool update_shapes = continuous_cd_mode == PhysicsServer2D::CCD_MODE_DISABLED;
+	_set_transform(Transform2D(angle, pos), update_shapes && !p_defer_space_updates);
 	_set_inv_transform(get_transform().inverse());
+	if (update_shapes && p_defer_space_updates) {
+		deferred_space_updates |= DEFERRED_UPDATE_SHAPES;
+	}
 
 	if (continuous_cd_mode != PhysicsServer2D::CCD_MODE_DISABLED) {
 		new_transform = get_transform();
@@ -654,6 +672,22 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 	_update_transform_dependent();
 }
 
+void GodotBody2D::apply_deferred_space_updates() {
+	if (deferred_space_updates & DEFERRED_UPDATE_SHAPES_WITH_MOTION) {
+		_update_shapes_with_motion(deferred_motion);
+	}
+	if (deferred_space_updates & DEFERRED_ADD_TO_STATE_QUERY_LIST) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+	if (deferred_space_updates & DEFERRED_UPDATE_SHAPES) {
+		_set_transform(get_transform());
+	}
+	if (deferred_space_updates & DEFERRED_DEACTIVATE) {
+		set_active(false);
+	}
+	deferred_space_updates = 0;
+}
+
 void GodotBody2D::wakeup_neighbours() {
 	for (const Pair<GodotConstraint2D *, int> &E : constraint_list) {
 		const GodotConstraint2D *c = E.first;
@@ -101,6 +101,17 @@ class GodotBody2D : public GodotCollisionObject2D {
 	bool active = true;
 	bool can_sleep = true;
 	bool first_time_kinematic = false;
+
+	// Changes to the space left by the integration when it runs in parallel with other bodies.
+	enum DeferredSpaceUpdate {
+		DEFERRED_UPDATE_SHAPES = 1 << 0,
+		DEFERRED_UPDATE_SHAPES_WITH_MOTION = 1 << 1,
+		DEFERRED_ADD_TO_STATE_QUERY_LIST = 1 << 2,
+		DEFERRED_DEACTIVATE = 1 << 3,
+	};
+	uint32_t deferred_space_updates = 0;
+	Vector2 deferred_motion;
+
 	void _mass_properties_changed();
 	virtual void _shapes_changed() override;
 	Transform2D new_transform;
@@ -314,8 +325,11 @@ public:
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
 
-	void integrate_forces(real_t p_step);
-	void integrate_velocities(real_t p_step);
+	// With `p_defer_space_updates`, the broadphase and the space lists are left untouched so bodies can be
+	// integrated in parallel. The changes must then be applied from one thread with `apply_deferred_space_updates()`.
+	void integrate_forces(real_t p_step, bool p_defer_space_updates = false);
+	void integrate_velocities(real_t p_step, bool p_defer_space_updates = false);
+	void apply_deferred_space_updates();
 
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
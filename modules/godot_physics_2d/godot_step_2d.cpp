@@ -30,6 +30,7 @@
 
 #include "godot_step_2d.h"
 
+#include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "godot_constraint_2d.h"
@@ -39,6 +40,24 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+// Below this amount of elements, dispatching to the worker threads costs more than it saves.
+#define PARALLEL_RANGE_MIN_COUNT 64
+
+void GodotStep2D::_run_ranges(void (GodotStep2D::*p_method)(uint32_t, uint32_t, void *), uint32_t p_count, const StringName &p_description) {
+	if (!parallel_integration || p_count < PARALLEL_RANGE_MIN_COUNT) {
+		(this->*p_method)(0, p_count, nullptr);
+		return;
+	}
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_range_task(this, p_method, nullptr, p_count, -1, -1, true, p_description);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void GodotStep2D::_fill_active_bodies(const SelfList<GodotBody2D>::List *p_body_list) {
+	active_bodies.clear();
+	for (const SelfList<GodotBody2D> *b = p_body_list->first(); b; b = b->next()) {
+		active_bodies.push_back(b->self());
+	}
+}
 
 void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -73,9 +92,10 @@ void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D
 	}
 }
 
-void GodotStep2D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
-	GodotConstraint2D *constraint = all_constraints[p_constraint_index];
-	constraint->setup(delta);
+void GodotStep2D::_setup_constraints(uint32_t p_begin, uint32_t p_end, void *p_userdata) {
+	for (uint32_t constraint_index = p_begin; constraint_index < p_end; ++constraint_index) {
+		all_constraints[constraint_index]->setup(delta);
+	}
 }
 
 void GodotStep2D::_pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const {
@@ -102,26 +122,44 @@ void GodotStep2D::_solve_island(uint32_t p_island_index, void *p_userdata) const
 	}
 }
 
-void GodotStep2D::_check_suspend(LocalVector<GodotBody2D *> &p_body_island) const {
-	bool can_sleep = true;
+void GodotStep2D::_integrate_forces(uint32_t p_begin, uint32_t p_end, void *p_userdata) {
+	for (uint32_t body_index = p_begin; body_index < p_end; ++body_index) {
+		active_bodies[body_index]->integrate_forces(delta, true);
+	}
+}
 
-	uint32_t body_count = p_body_island.size();
-	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
-		GodotBody2D *body = p_body_island[body_index];
+void GodotStep2D::_integrate_velocities(uint32_t p_begin, uint32_t p_end, void *p_userdata) {
+	for (uint32_t body_index = p_begin; body_index < p_end; ++body_index) {
+		active_bodies[body_index]->integrate_velocities(delta, true);
+	}
+}
+
+void GodotStep2D::_sleep_test_islands(uint32_t p_begin, uint32_t p_end, void *p_userdata) {
+	for (uint32_t island_index = p_begin; island_index < p_end; ++island_index) {
+		const LocalVector<GodotBody2D *> &body_island = body_islands[island_index];
 
-		if (!body->sleep_test(delta)) {
-			can_sleep = false;
+		bool can_sleep = true;
+		uint32_t body_count = body_island.size();
+		for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
+			// Every body is tested, as the test also updates how long it has been still.
+			if (!body_island[body_index]->sleep_test(delta)) {
+				can_sleep = false;
+			}
 		}
+		body_islands_can_sleep[island_index] = can_sleep;
 	}
+}
 
+void GodotStep2D::_check_suspend(LocalVector<GodotBody2D *> &p_body_island, bool p_can_sleep) const {
 	// Put all to sleep or wake up everyone.
+	uint32_t body_count = p_body_island.size();
 	for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
 		GodotBody2D *body = p_body_island[body_index];
 
 		bool active = body->is_active();
 
-		if (active == can_sleep) {
-			body->set_active(!can_sleep);
+		if (active == p_can_sleep) {
+			body->set_active(!p_can_sleep);
 		}
 	}
 }
@@ -143,16 +181,15 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
-
-	const SelfList<GodotBody2D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	// Bodies are integrated in parallel, but their changes to the broadphase and the space lists
+	// are applied in the order of the active list, so results don't depend on the thread scheduling.
+	_fill_active_bodies(body_list);
+	_run_ranges(&GodotStep2D::_integrate_forces, active_bodies.size(), SNAME("Physics2DIntegrateForces"));
+	for (GodotBody2D *body : active_bodies) {
+		body->apply_deferred_space_updates();
 	}
 
-	p_space->set_active_objects(active_count);
+	p_space->set_active_objects(active_bodies.size());
 
 	// Update the broadphase to register collision pairs.
 	p_space->update();
@@ -193,7 +230,8 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	// Islands are flood-filled from the step marks of shared constraints and bodies, which must run serially.
+	const SelfList<GodotBody2D> *b = body_list->first();
 
 	uint32_t body_island_count = 0;
 
@@ -241,7 +279,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_range_task(this, &GodotStep2D::_setup_constraints, nullptr, total_constraint_count, -1, -1, true, SNAME("Physics2DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -272,17 +310,21 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<GodotBody2D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n; // in case it shuts itself down
+	// The active list may have changed while solving, as constraints wake up bodies.
+	_fill_active_bodies(body_list);
+	_run_ranges(&GodotStep2D::_integrate_velocities, active_bodies.size(), SNAME("Physics2DIntegrateVelocities"));
+	for (GodotBody2D *body : active_bodies) {
+		body->apply_deferred_space_updates();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
 
+	if (body_islands_can_sleep.size() < body_island_count) {
+		body_islands_can_sleep.resize(body_island_count);
+	}
+	_run_ranges(&GodotStep2D::_sleep_test_islands, body_island_count, SNAME("Physics2DSleepTestIslands"));
 	for (uint32_t island_index = 0; island_index < body_island_count; ++island_index) {
-		_check_suspend(body_islands[island_index]);
+		_check_suspend(body_islands[island_index], body_islands_can_sleep[island_index]);
 	}
 
 	{ //profile
@@ -298,6 +340,8 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 }
 
 GodotStep2D::GodotStep2D() {
+	parallel_integration = GLOBAL_GET("physics/2d/solver/parallel_integration");
+
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
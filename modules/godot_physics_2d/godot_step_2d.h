@@ -40,15 +40,25 @@ class GodotStep2D {
 	int iterations = 0;
 	real_t delta = 0.0;
 
+	bool parallel_integration = true;
+
 	LocalVector<LocalVector<GodotBody2D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint2D *>> constraint_islands;
 	LocalVector<GodotConstraint2D *> all_constraints;
+	LocalVector<GodotBody2D *> active_bodies;
+	LocalVector<uint8_t> body_islands_can_sleep;
+
+	void _run_ranges(void (GodotStep2D::*p_method)(uint32_t, uint32_t, void *), uint32_t p_count, const StringName &p_description);
+	void _fill_active_bodies(const SelfList<GodotBody2D>::List *p_body_list);
 
 	void _populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island);
-	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _setup_constraints(uint32_t p_begin, uint32_t p_end, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr) const;
-	void _check_suspend(LocalVector<GodotBody2D *> &p_body_island) const;
+	void _integrate_forces(uint32_t p_begin, uint32_t p_end, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_begin, uint32_t p_end, void *p_userdata = nullptr);
+	void _sleep_test_islands(uint32_t p_begin, uint32_t p_end, void *p_userdata = nullptr);
+	void _check_suspend(LocalVector<GodotBody2D *> &p_body_island, bool p_can_sleep) const;
 
 public:
 	void step(GodotSpace2D *p_space, real_t p_delta);
@@ -474,7 +474,7 @@ bool GodotBody3D::is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const {
 	return locked_axis & p_axis;
 }
 
-void GodotBody3D::integrate_forces(real_t p_step) {
+void GodotBody3D::integrate_forces(real_t p_step, bool p_defer_space_updates) {
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
 	}
@@ -665,13 +665,18 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector3();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		if (p_defer_space_updates) {
+			deferred_space_updates |= DEFERRED_UPDATE_SHAPES_WITH_MOTION;
+			deferred_motion = motion;
+		} else {
+			_update_shapes_with_motion(motion);
+		}
 	}
 
 	contact_count = 0;
 }
 
-void GodotBody3D::integrate_velocities(real_t p_step) {
+void GodotBody3D::integrate_velocities(real_t p_step, bool p_defer_space_updates) {
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
 	}
@@ -679,7 +684,11 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 	ERR_FAIL_NULL(get_space());
 
 	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		if (p_defer_space_updates) {
+			deferred_space_updates |= DEFERRED_ADD_TO_STATE_QUERY_LIST;
+		} else {
+			get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		}
 	}
 
 	//apply axis lock linear
@@ -702,7 +711,12 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
+			//stopped moving, deactivate
+			if (p_defer_space_updates) {
+				deferred_space_updates |= DEFERRED_DEACTIVATE;
+			} else {
+				set_active(false);
+			}
 		}
 
 		return;
@@ -731,12 +745,31 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	transform_new.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform_new);
+	_set_transform(transform_new, !p_defer_space_updates);
 	_set_inv_transform(get_transform().inverse());
+	if (p_defer_space_updates) {
+		deferred_space_updates |= DEFERRED_UPDATE_SHAPES;
+	}
 
 	_update_transform_dependent();
 }
 
+void GodotBody3D::apply_deferred_space_updates() {
+	if (deferred_space_updates & DEFERRED_UPDATE_SHAPES_WITH_MOTION) {
+		_update_shapes_with_motion(deferred_motion);
+	}
+	if (deferred_space_updates & DEFERRED_ADD_TO_STATE_QUERY_LIST) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+	if (deferred_space_updates & DEFERRED_UPDATE_SHAPES) {
+		_set_transform(get_transform());
+	}
+	if (deferred_space_updates & DEFERRED_DEACTIVATE) {
+		set_active(false);
+	}
+	deferred_space_updates = 0;
+}
+
 void GodotBody3D::wakeup_neighbours() {
 	for (const KeyValue<GodotConstraint3D *, int> &E : constraint_map) {
 		const GodotConstraint3D *c = E.key;
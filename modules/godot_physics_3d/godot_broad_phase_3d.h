@@ -60,6 +60,12 @@ public:
 	virtual int cull_segment(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) = 0;
 	virtual int cull_aabb(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) = 0;
 
+	// Culls several segments at once, each one getting p_max_results entries in the results.
+	// It can run on several threads at once, between lock_culling() and unlock_culling().
+	virtual int cull_segments(const Vector3 *p_from, const Vector3 *p_to, int p_count, GodotCollisionObject3D **p_results, int p_max_results, int *r_result_counts, int *p_result_indices = nullptr) const = 0;
+	virtual void lock_culling() = 0;
+	virtual void unlock_culling() = 0;
+
 	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata) = 0;
 	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) = 0;
 
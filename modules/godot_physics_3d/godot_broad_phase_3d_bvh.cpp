@@ -86,6 +86,18 @@ int GodotBroadPhase3DBVH::cull_aabb(const AABB &p_aabb, GodotCollisionObject3D *
 	return bvh.cull_aabb(p_aabb, p_results, p_max_results, nullptr, 0xFFFFFFFF, p_result_indices);
 }
 
+int GodotBroadPhase3DBVH::cull_segments(const Vector3 *p_from, const Vector3 *p_to, int p_count, GodotCollisionObject3D **p_results, int p_max_results, int *r_result_counts, int *p_result_indices) const {
+	return bvh.cull_segments(p_from, p_to, p_count, p_results, p_max_results, r_result_counts, nullptr, 0xFFFFFFFF, p_result_indices);
+}
+
+void GodotBroadPhase3DBVH::lock_culling() {
+	bvh.lock_culling();
+}
+
+void GodotBroadPhase3DBVH::unlock_culling() {
+	bvh.unlock_culling();
+}
+
 void *GodotBroadPhase3DBVH::_pair_callback(void *self, uint32_t p_A, GodotCollisionObject3D *p_object_A, int subindex_A, uint32_t p_B, GodotCollisionObject3D *p_object_B, int subindex_B) {
 	GodotBroadPhase3DBVH *bpo = static_cast<GodotBroadPhase3DBVH *>(self);
 	if (!bpo->pair_callback) {
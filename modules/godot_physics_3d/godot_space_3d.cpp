@@ -34,11 +34,14 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "godot_area_pair_3d.h"
 #include "godot_body_pair_3d.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
+// Rays per worker task in intersect_ray_batch(), and below this amount the batch runs on the calling thread.
+#define RAY_BATCH_MIN_CHUNK 256
 
 _FORCE_INLINE_ static bool _can_collide_with(GodotCollisionObject3D *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (!(p_object->get_collision_layer() & p_collision_mask)) {
@@ -110,14 +113,18 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
 	ERR_FAIL_COND_V(space->locked, false);
 
+	int amount = space->broadphase->cull_segment(p_parameters.from, p_parameters.to, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+
+	return _intersect_ray_culled(p_parameters, p_parameters.from, p_parameters.to, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_result);
+}
+
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray_culled(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, RayResult &r_result) const {
 	Vector3 begin, end;
 	Vector3 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
-
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
 	bool collided = false;
@@ -127,22 +134,22 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	const GodotCollisionObject3D *res_obj = nullptr;
 	real_t min_d = 1e10;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_amount; i++) {
+		if (!_can_collide_with(p_objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(p_objects[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = p_objects[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_subindices[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -207,6 +214,61 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
+int GodotPhysicsDirectSpaceState3D::intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_collided) {
+	ERR_FAIL_COND_V(space->locked, 0);
+	ERR_FAIL_COND_V(p_count < 0, 0);
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.results = r_results;
+	batch.collided = r_collided;
+
+	// The broadphase stays locked for the whole batch, so the rays can be culled from several threads.
+	space->broadphase->lock_culling();
+
+	if (p_count < RAY_BATCH_MIN_CHUNK * 2) {
+		_intersect_ray_batch_range(0, p_count, &batch);
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_range_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_ray_batch_range, &batch, p_count, -1, RAY_BATCH_MIN_CHUNK, true, SNAME("Physics3DIntersectRayBatch"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	space->broadphase->unlock_culling();
+
+	int collided_count = 0;
+	for (int i = 0; i < p_count; i++) {
+		if (r_collided[i]) {
+			collided_count++;
+		}
+	}
+
+	return collided_count;
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_ray_batch_range(uint32_t p_begin, uint32_t p_end, RayBatch *p_batch) {
+	const int packet_size = RAY_BATCH_PACKET_SIZE;
+
+	// The space query buffers are shared, so each range culls into its own.
+	LocalVector<GodotCollisionObject3D *> objects;
+	LocalVector<int> subindices;
+	objects.resize(packet_size * GodotSpace3D::INTERSECTION_QUERY_MAX);
+	subindices.resize(packet_size * GodotSpace3D::INTERSECTION_QUERY_MAX);
+	int amounts[packet_size];
+
+	for (uint32_t first = p_begin; first < p_end; first += packet_size) {
+		int count = MIN(p_end - first, (uint32_t)packet_size);
+
+		space->broadphase->cull_segments(p_batch->from + first, p_batch->to + first, count, objects.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, amounts, subindices.ptr());
+
+		for (int i = 0; i < count; i++) {
+			int offset = i * GodotSpace3D::INTERSECTION_QUERY_MAX;
+			p_batch->collided[first + i] = _intersect_ray_culled(*p_batch->parameters, p_batch->from[first + i], p_batch->to[first + i], objects.ptr() + offset, subindices.ptr() + offset, amounts[i], p_batch->results[first + i]);
+		}
+	}
+}
+
 int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -31,8 +31,13 @@
 #include "multiplayer_synchronizer.h"
 
 #include "core/config/engine.h"
+#include "scene/2d/node_2d.h"
 #include "scene/main/multiplayer_api.h"
 
+#ifndef _3D_DISABLED
+#include "scene/3d/node_3d.h"
+#endif // _3D_DISABLED
+
 Object *MultiplayerSynchronizer::_get_prop_target(Object *p_obj, const NodePath &p_path) {
 	if (p_path.get_name_count() == 0) {
 		return p_obj;
@@ -110,6 +115,7 @@ void MultiplayerSynchronizer::reset() {
 	last_watch_usec = 0;
 	sync_started = false;
 	watchers.clear();
+	interest_peers.clear();
 }
 
 uint32_t MultiplayerSynchronizer::get_net_id() const {
@@ -191,6 +197,9 @@ void MultiplayerSynchronizer::set_visibility_public(bool p_visible) {
 }
 
 bool MultiplayerSynchronizer::is_visible_to(int p_peer) {
+	if (use_interest_management && !interest_peers.has(p_peer)) {
+		return false; // Never public, only visible to peers interested in it.
+	}
 	if (visibility_filters.size()) {
 		Variant arg = p_peer;
 		const Variant *argv[1] = { &arg };
@@ -242,6 +251,44 @@ MultiplayerSynchronizer::VisibilityUpdateMode MultiplayerSynchronizer::get_visib
 	return visibility_update_mode;
 }
 
+void MultiplayerSynchronizer::set_use_interest_management(bool p_enable) {
+	if (use_interest_management == p_enable) {
+		return;
+	}
+	use_interest_management = p_enable;
+	interest_peers.clear();
+	update_visibility(0);
+}
+
+bool MultiplayerSynchronizer::is_using_interest_management() const {
+	return use_interest_management;
+}
+
+void MultiplayerSynchronizer::set_interest_for(int p_peer, bool p_relevant) {
+	if (p_relevant) {
+		interest_peers.insert(p_peer);
+	} else {
+		interest_peers.erase(p_peer);
+	}
+}
+
+Vector3 MultiplayerSynchronizer::get_interest_position() {
+	Node *node = get_root_node();
+	if (!node) {
+		return Vector3();
+	}
+#ifndef _3D_DISABLED
+	if (Node3D *node_3d = Object::cast_to<Node3D>(node)) {
+		return node_3d->get_global_position();
+	}
+#endif // _3D_DISABLED
+	if (Node2D *node_2d = Object::cast_to<Node2D>(node)) {
+		const Vector2 pos = node_2d->get_global_position();
+		return Vector3(pos.x, pos.y, 0);
+	}
+	return Vector3();
+}
+
 void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &MultiplayerSynchronizer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &MultiplayerSynchronizer::get_root_path);
@@ -267,12 +314,16 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_visibility_for", "peer", "visible"), &MultiplayerSynchronizer::set_visibility_for);
 	ClassDB::bind_method(D_METHOD("get_visibility_for", "peer"), &MultiplayerSynchronizer::get_visibility_for);
 
+	ClassDB::bind_method(D_METHOD("set_use_interest_management", "enable"), &MultiplayerSynchronizer::set_use_interest_management);
+	ClassDB::bind_method(D_METHOD("is_using_interest_management"), &MultiplayerSynchronizer::is_using_interest_management);
+
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "replication_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_replication_interval", "get_replication_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "delta_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_delta_interval", "get_delta_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, "SceneReplicationConfig", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_EDITOR_INSTANTIATE_OBJECT), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_interest_management"), "set_use_interest_management", "is_using_interest_management");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
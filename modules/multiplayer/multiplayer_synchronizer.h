@@ -58,6 +58,8 @@ private:
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	bool use_interest_management = false;
+	HashSet<int> interest_peers; // Maintained by the replication interface.
 	Vector<Watcher> watchers;
 	uint64_t last_watch_usec = 0;
 
@@ -116,6 +118,11 @@ public:
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
 
+	void set_use_interest_management(bool p_enable);
+	bool is_using_interest_management() const;
+	void set_interest_for(int p_peer, bool p_relevant);
+	Vector3 get_interest_position();
+
 	List<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
 	List<NodePath> get_delta_properties(uint64_t p_indexes);
 	SceneReplicationConfig *get_replication_config_ptr() const;
@@ -0,0 +1,252 @@
+/**************************************************************************/
+/*  scene_interest_grid.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_interest_grid.h"
+
+bool SceneInterestGrid::_is_cell_in_sphere(const Vector3i &p_cell, const Vector3 &p_origin, real_t p_radius) const {
+	const Vector3 cell_from = Vector3(p_cell) * cell_size;
+	const Vector3 closest = p_origin.clamp(cell_from, cell_from + Vector3(cell_size, cell_size, cell_size));
+	return closest.distance_squared_to(p_origin) <= p_radius * p_radius;
+}
+
+void SceneInterestGrid::_get_peer_cells(const Vector3 &p_origin, real_t p_radius, HashSet<Vector3i> &r_cells) const {
+	// Visit whichever is smaller, the cells in use or the cells covered by the sphere. Compared as floats,
+	// since converting the bounds of a huge sphere to cell coordinates could overflow.
+	const real_t cells_per_axis = Math::floor(2 * p_radius / cell_size) + 2;
+	if (!(cells_per_axis * cells_per_axis * cells_per_axis <= cells.size())) {
+		for (const KeyValue<Vector3i, Cell> &E : cells) {
+			if (_is_cell_in_sphere(E.key, p_origin, p_radius)) {
+				r_cells.insert(E.key);
+			}
+		}
+		return;
+	}
+
+	const Vector3i from = _get_cell(p_origin - Vector3(p_radius, p_radius, p_radius));
+	const Vector3i to = _get_cell(p_origin + Vector3(p_radius, p_radius, p_radius));
+	for (int x = from.x; x <= to.x; x++) {
+		for (int y = from.y; y <= to.y; y++) {
+			for (int z = from.z; z <= to.z; z++) {
+				const Vector3i c = Vector3i(x, y, z);
+				// Only keep cells in use actually overlapping the sphere.
+				if (cells.has(c) && _is_cell_in_sphere(c, p_origin, p_radius)) {
+					r_cells.insert(c);
+				}
+			}
+		}
+	}
+}
+
+SceneInterestGrid::Cell &SceneInterestGrid::_get_or_create_cell(const Vector3i &p_cell) {
+	HashMap<Vector3i, Cell>::Iterator E = cells.find(p_cell);
+	if (E) {
+		return E->value;
+	}
+	Cell &cell = cells.insert(p_cell, Cell())->value;
+	// Peers only subscribe to cells in use, so they are added when an entity first enters the cell.
+	for (KeyValue<int, Peer> &P : peers) {
+		if (_is_cell_in_sphere(p_cell, P.value.origin, P.value.radius)) {
+			cell.subscribers.insert(P.key);
+			P.value.cells.insert(p_cell);
+		}
+	}
+	return cell;
+}
+
+void SceneInterestGrid::_erase_cell_if_empty(const Vector3i &p_cell) {
+	HashMap<Vector3i, Cell>::Iterator E = cells.find(p_cell);
+	if (!E || !E->value.entities.is_empty()) {
+		return;
+	}
+	for (int peer : E->value.subscribers) {
+		peers[peer].cells.erase(p_cell);
+	}
+	cells.remove(E);
+}
+
+void SceneInterestGrid::_subscribe(int p_peer, Peer &p_info, const Vector3 &p_origin, real_t p_radius, LocalVector<Change> &r_changes) {
+	HashSet<Vector3i> new_cells;
+	_get_peer_cells(p_origin, p_radius, new_cells);
+	p_info.origin = p_origin;
+	p_info.radius = p_radius;
+
+	for (const Vector3i &c : p_info.cells) {
+		if (new_cells.has(c)) {
+			continue;
+		}
+		Cell &cell = cells[c];
+		cell.subscribers.erase(p_peer);
+		for (const ObjectID &id : cell.entities) {
+			r_changes.push_back({ id, p_peer, false });
+		}
+	}
+	for (const Vector3i &c : new_cells) {
+		if (p_info.cells.has(c)) {
+			continue;
+		}
+		Cell &cell = cells[c];
+		cell.subscribers.insert(p_peer);
+		for (const ObjectID &id : cell.entities) {
+			r_changes.push_back({ id, p_peer, true });
+		}
+	}
+	p_info.cells = new_cells;
+}
+
+void SceneInterestGrid::update_entity(const ObjectID &p_id, const Vector3 &p_position, LocalVector<Change> &r_changes) {
+	const Vector3i to = _get_cell(p_position);
+	HashMap<ObjectID, Entity>::Iterator E = entities.find(p_id);
+	if (!E) {
+		E = entities.insert(p_id, { to, p_position });
+		Cell &cell = _get_or_create_cell(to);
+		cell.entities.insert(p_id);
+		for (int peer : cell.subscribers) {
+			r_changes.push_back({ p_id, peer, true });
+		}
+		return;
+	}
+	E->value.position = p_position;
+	const Vector3i from = E->value.cell;
+	if (from == to) {
+		return; // Most common case, nothing changes.
+	}
+	E->value.cell = to;
+	Cell &old_cell = cells[from];
+	Cell &new_cell = _get_or_create_cell(to);
+	old_cell.entities.erase(p_id);
+	new_cell.entities.insert(p_id);
+	for (int peer : old_cell.subscribers) {
+		if (!new_cell.subscribers.has(peer)) {
+			r_changes.push_back({ p_id, peer, false });
+		}
+	}
+	for (int peer : new_cell.subscribers) {
+		if (!old_cell.subscribers.has(peer)) {
+			r_changes.push_back({ p_id, peer, true });
+		}
+	}
+	_erase_cell_if_empty(from);
+}
+
+void SceneInterestGrid::remove_entity(const ObjectID &p_id, LocalVector<Change> &r_changes) {
+	HashMap<ObjectID, Entity>::Iterator E = entities.find(p_id);
+	if (!E) {
+		return;
+	}
+	const Vector3i c = E->value.cell;
+	entities.remove(E);
+	Cell &cell = cells[c];
+	cell.entities.erase(p_id);
+	for (int peer : cell.subscribers) {
+		r_changes.push_back({ p_id, peer, false });
+	}
+	_erase_cell_if_empty(c);
+}
+
+void SceneInterestGrid::set_peer(int p_peer, const Vector3 &p_origin, real_t p_radius, LocalVector<Change> &r_changes) {
+	ERR_FAIL_COND_MSG(p_radius < 0, "The interest radius can't be negative.");
+	Peer &info = peers[p_peer];
+	_subscribe(p_peer, info, p_origin, p_radius, r_changes);
+}
+
+void SceneInterestGrid::remove_peer(int p_peer, LocalVector<Change> &r_changes) {
+	HashMap<int, Peer>::Iterator E = peers.find(p_peer);
+	if (!E) {
+		return;
+	}
+	for (const Vector3i &c : E->value.cells) {
+		Cell &cell = cells[c];
+		cell.subscribers.erase(p_peer);
+		for (const ObjectID &id : cell.entities) {
+			r_changes.push_back({ id, p_peer, false });
+		}
+	}
+	peers.remove(E);
+}
+
+void SceneInterestGrid::clear_peers(LocalVector<Change> &r_changes) {
+	while (peers.size()) {
+		remove_peer(peers.begin()->key, r_changes);
+	}
+}
+
+bool SceneInterestGrid::is_relevant(const ObjectID &p_id, int p_peer) const {
+	HashMap<ObjectID, Entity>::ConstIterator E = entities.find(p_id);
+	if (!E) {
+		return false;
+	}
+	HashMap<Vector3i, Cell>::ConstIterator C = cells.find(E->value.cell);
+	return C && C->value.subscribers.has(p_peer);
+}
+
+void SceneInterestGrid::set_cell_size(real_t p_size, LocalVector<Change> &r_changes) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "The interest cell size must be greater than 0.");
+	if (p_size == cell_size) {
+		return;
+	}
+	// Remember which pairs were relevant, to only report actual changes once rebuilt.
+	HashMap<ObjectID, HashSet<int>> relevant;
+	for (const KeyValue<ObjectID, Entity> &E : entities) {
+		const Cell &cell = cells[E.value.cell];
+		if (!cell.subscribers.is_empty()) {
+			relevant.insert(E.key, cell.subscribers);
+		}
+	}
+	HashMap<ObjectID, Entity> old_entities = entities;
+	HashMap<int, Peer> old_peers = peers;
+	cells.clear();
+	entities.clear();
+	peers.clear();
+	cell_size = p_size;
+	LocalVector<Change> ignored;
+	for (const KeyValue<ObjectID, Entity> &E : old_entities) {
+		update_entity(E.key, E.value.position, ignored);
+	}
+	for (const KeyValue<int, Peer> &P : old_peers) {
+		set_peer(P.key, P.value.origin, P.value.radius, ignored);
+	}
+	for (const KeyValue<ObjectID, Entity> &E : entities) {
+		const HashSet<int> &now = cells[E.value.cell].subscribers;
+		const HashSet<int> *before = relevant.getptr(E.key);
+		for (int peer : now) {
+			if (!before || !before->has(peer)) {
+				r_changes.push_back({ E.key, peer, true });
+			}
+		}
+		if (!before) {
+			continue;
+		}
+		for (int peer : *before) {
+			if (!now.has(peer)) {
+				r_changes.push_back({ E.key, peer, false });
+			}
+		}
+	}
+}
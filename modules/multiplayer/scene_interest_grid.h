@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  scene_interest_grid.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/vector3.h"
+#include "core/math/vector3i.h"
+#include "core/object/object_id.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+
+// Uniform grid used for spatial interest management.
+// Only cells holding entities exist. Peers subscribe to the ones overlapping their view sphere,
+// and an entity is relevant to every peer subscribed to the cell it's in. Only the (entity, peer) pairs whose relevancy
+// changed are reported, so the cost depends on movement across cells, not on the number of pairs.
+class SceneInterestGrid {
+public:
+	struct Change {
+		ObjectID id;
+		int peer = 0;
+		bool relevant = false;
+	};
+
+private:
+	struct Cell {
+		HashSet<ObjectID> entities;
+		HashSet<int> subscribers;
+	};
+
+	struct Entity {
+		Vector3i cell;
+		Vector3 position;
+	};
+
+	struct Peer {
+		Vector3 origin;
+		real_t radius = 0;
+		HashSet<Vector3i> cells;
+	};
+
+	real_t cell_size = 64;
+	HashMap<Vector3i, Cell> cells;
+	HashMap<ObjectID, Entity> entities;
+	HashMap<int, Peer> peers;
+
+	_FORCE_INLINE_ Vector3i _get_cell(const Vector3 &p_position) const {
+		return Vector3i((p_position / cell_size).floor());
+	}
+	bool _is_cell_in_sphere(const Vector3i &p_cell, const Vector3 &p_origin, real_t p_radius) const;
+	void _get_peer_cells(const Vector3 &p_origin, real_t p_radius, HashSet<Vector3i> &r_cells) const;
+	Cell &_get_or_create_cell(const Vector3i &p_cell);
+	void _erase_cell_if_empty(const Vector3i &p_cell);
+	void _subscribe(int p_peer, Peer &p_info, const Vector3 &p_origin, real_t p_radius, LocalVector<Change> &r_changes);
+
+public:
+	void update_entity(const ObjectID &p_id, const Vector3 &p_position, LocalVector<Change> &r_changes);
+	void remove_entity(const ObjectID &p_id, LocalVector<Change> &r_changes);
+	bool has_entity(const ObjectID &p_id) const { return entities.has(p_id); }
+
+	void set_peer(int p_peer, const Vector3 &p_origin, real_t p_radius, LocalVector<Change> &r_changes);
+	void remove_peer(int p_peer, LocalVector<Change> &r_changes);
+	void clear_peers(LocalVector<Change> &r_changes);
+	bool has_peer(int p_peer) const { return peers.has(p_peer); }
+
+	bool is_relevant(const ObjectID &p_id, int p_peer) const;
+
+	void set_cell_size(real_t p_size, LocalVector<Change> &r_changes);
+	real_t get_cell_size() const { return cell_size; }
+};
@@ -200,6 +200,13 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void remove_peer_interest(int p_peer);
+	bool has_peer_interest(int p_peer) const;
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
 	SceneMultiplayer();
 	~SceneMultiplayer();
 };
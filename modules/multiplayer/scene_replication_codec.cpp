@@ -0,0 +1,633 @@
+/**************************************************************************/
+/*  scene_replication_codec.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_replication_codec.h"
+
+#include "core/math/math_funcs.h"
+#include "scene/main/multiplayer_api.h"
+
+#define VARIANT_TYPE_BITS 6
+#define QUANTIZED_FIXED_MAX_BITS 32
+#define GENERIC_VALUE_MAX_BYTES (1 << 24) // Fallback variants larger than this are rejected.
+
+static_assert(Variant::VARIANT_MAX <= (1 << VARIANT_TYPE_BITS), "Variant types no longer fit the replication codec type field.");
+
+void SceneReplicationCodec::BitWriter::write(uint64_t p_value, int p_bits) {
+	DEV_ASSERT(p_bits >= 0 && p_bits <= 64);
+	while (p_bits > 0) {
+		const uint32_t byte = bits >> 3;
+		const int bit_ofs = bits & 7;
+		if (bit_ofs == 0) {
+			data.push_back(0);
+		}
+		const int take = MIN(8 - bit_ofs, p_bits);
+		data[byte] |= uint8_t((p_value & ((1u << take) - 1)) << bit_ofs);
+		p_value >>= take;
+		p_bits -= take;
+		bits += take;
+	}
+}
+
+void SceneReplicationCodec::BitWriter::write_varint(uint64_t p_value) {
+	// Groups of 4 bits followed by a continuation bit, small deltas are the common case.
+	do {
+		write(p_value & 0xF, 4);
+		p_value >>= 4;
+		write_bit(p_value != 0);
+	} while (p_value);
+}
+
+void SceneReplicationCodec::BitWriter::write_signed(int64_t p_value) {
+	write_varint((uint64_t(p_value) << 1) ^ uint64_t(p_value >> 63));
+}
+
+void SceneReplicationCodec::BitWriter::clear() {
+	data.clear();
+	bits = 0;
+}
+
+uint64_t SceneReplicationCodec::BitReader::read(int p_bits) {
+	DEV_ASSERT(p_bits >= 0 && p_bits <= 64);
+	if (error || pos + p_bits > size_bits) {
+		error = true;
+		return 0;
+	}
+	uint64_t value = 0;
+	int shift = 0;
+	while (p_bits > 0) {
+		const int bit_ofs = pos & 7;
+		const int take = MIN(8 - bit_ofs, p_bits);
+		value |= uint64_t((data[pos >> 3] >> bit_ofs) & ((1u << take) - 1)) << shift;
+		shift += take;
+		p_bits -= take;
+		pos += take;
+	}
+	return value;
+}
+
+uint64_t SceneReplicationCodec::BitReader::read_varint() {
+	uint64_t value = 0;
+	for (int shift = 0; shift < 64; shift += 4) {
+		value |= read(4) << shift;
+		if (!read_bit()) {
+			return value;
+		}
+	}
+	error = true; // Malformed.
+	return 0;
+}
+
+int64_t SceneReplicationCodec::BitReader::read_signed() {
+	const uint64_t value = read_varint();
+	return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
+
+// Numeric components.
+
+static int _get_float_components(const Variant &p_value, double *r_components, int &r_bits) {
+	switch (p_value.get_type()) {
+		case Variant::FLOAT: {
+			r_bits = 64;
+			r_components[0] = p_value.operator double();
+			return 1;
+		}
+		case Variant::VECTOR2: {
+			const Vector2 v = p_value;
+			r_bits = sizeof(real_t) * 8;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			return 2;
+		}
+		case Variant::VECTOR3: {
+			const Vector3 v = p_value;
+			r_bits = sizeof(real_t) * 8;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			r_components[2] = v.z;
+			return 3;
+		}
+		case Variant::VECTOR4: {
+			const Vector4 v = p_value;
+			r_bits = sizeof(real_t) * 8;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			r_components[2] = v.z;
+			r_components[3] = v.w;
+			return 4;
+		}
+		case Variant::QUATERNION: {
+			const Quaternion v = p_value;
+			r_bits = sizeof(real_t) * 8;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			r_components[2] = v.z;
+			r_components[3] = v.w;
+			return 4;
+		}
+		case Variant::COLOR: {
+			const Color v = p_value;
+			r_bits = 32;
+			r_components[0] = v.r;
+			r_components[1] = v.g;
+			r_components[2] = v.b;
+			r_components[3] = v.a;
+			return 4;
+		}
+		default:
+			return 0;
+	}
+}
+
+static Variant _make_float_variant(Variant::Type p_type, const double *p_components) {
+	switch (p_type) {
+		case Variant::FLOAT:
+			return p_components[0];
+		case Variant::VECTOR2:
+			return Vector2(p_components[0], p_components[1]);
+		case Variant::VECTOR3:
+			return Vector3(p_components[0], p_components[1], p_components[2]);
+		case Variant::VECTOR4:
+			return Vector4(p_components[0], p_components[1], p_components[2], p_components[3]);
+		case Variant::QUATERNION:
+			return Quaternion(p_components[0], p_components[1], p_components[2], p_components[3]);
+		case Variant::COLOR:
+			return Color(p_components[0], p_components[1], p_components[2], p_components[3]);
+		default:
+			ERR_FAIL_V(Variant());
+	}
+}
+
+static int _get_int_components(const Variant &p_value, int64_t *r_components) {
+	switch (p_value.get_type()) {
+		case Variant::INT: {
+			r_components[0] = p_value.operator int64_t();
+			return 1;
+		}
+		case Variant::VECTOR2I: {
+			const Vector2i v = p_value;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			return 2;
+		}
+		case Variant::VECTOR3I: {
+			const Vector3i v = p_value;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			r_components[2] = v.z;
+			return 3;
+		}
+		case Variant::VECTOR4I: {
+			const Vector4i v = p_value;
+			r_components[0] = v.x;
+			r_components[1] = v.y;
+			r_components[2] = v.z;
+			r_components[3] = v.w;
+			return 4;
+		}
+		default:
+			return 0;
+	}
+}
+
+static Variant _make_int_variant(Variant::Type p_type, const int64_t *p_components) {
+	switch (p_type) {
+		case Variant::INT:
+			return p_components[0];
+		case Variant::VECTOR2I:
+			return Vector2i(p_components[0], p_components[1]);
+		case Variant::VECTOR3I:
+			return Vector3i(p_components[0], p_components[1], p_components[2]);
+		case Variant::VECTOR4I:
+			return Vector4i(p_components[0], p_components[1], p_components[2], p_components[3]);
+		default:
+			ERR_FAIL_V(Variant());
+	}
+}
+
+static int _get_component_count(Variant::Type p_type, bool &r_is_float) {
+	r_is_float = true;
+	switch (p_type) {
+		case Variant::FLOAT:
+			return 1;
+		case Variant::VECTOR2:
+			return 2;
+		case Variant::VECTOR3:
+			return 3;
+		case Variant::VECTOR4:
+		case Variant::QUATERNION:
+		case Variant::COLOR:
+			return 4;
+		default:
+			break;
+	}
+	r_is_float = false;
+	switch (p_type) {
+		case Variant::INT:
+			return 1;
+		case Variant::VECTOR2I:
+			return 2;
+		case Variant::VECTOR3I:
+			return 3;
+		case Variant::VECTOR4I:
+			return 4;
+		default:
+			return 0;
+	}
+}
+
+// Quantization.
+
+static int64_t _get_quantized_limit(const SceneReplicationCodec::Quantization &p_quantization) {
+	// Keep well within the exact integer range of doubles.
+	const double limit = p_quantization.range > 0.0 ? Math::round(p_quantization.range / p_quantization.step) : 0.0;
+	return int64_t(CLAMP(limit, 0.0, double(1LL << 52)));
+}
+
+static int64_t _quantize_component(double p_value, const SceneReplicationCodec::Quantization &p_quantization, int64_t p_limit) {
+	double scaled = Math::round(p_value / p_quantization.step);
+	if (Math::is_nan(scaled)) {
+		return 0;
+	}
+	const double limit = p_limit > 0 ? double(p_limit) : double(1LL << 52);
+	return int64_t(CLAMP(scaled, -limit, limit));
+}
+
+static int _get_fixed_bits(int64_t p_limit) {
+	// Values are sent offset by the limit, in [0, 2 * limit].
+	int bits = 1;
+	while (bits < 63 && (uint64_t(1) << bits) <= uint64_t(p_limit) * 2) {
+		bits++;
+	}
+	return bits;
+}
+
+Variant SceneReplicationCodec::quantize(const Variant &p_value, const Quantization &p_quantization) {
+	if (p_quantization.step <= 0.0) {
+		return p_value;
+	}
+	double components[4];
+	int bits = 0;
+	const int count = _get_float_components(p_value, components, bits);
+	if (!count) {
+		return p_value;
+	}
+	const int64_t limit = _get_quantized_limit(p_quantization);
+	for (int i = 0; i < count; i++) {
+		components[i] = _quantize_component(components[i], p_quantization, limit) * p_quantization.step;
+	}
+	return _make_float_variant(p_value.get_type(), components);
+}
+
+void SceneReplicationCodec::quantize_state(Vector<Variant> &r_state, const LocalVector<Quantization> &p_quantization) {
+	Variant *ptr = r_state.ptrw();
+	for (int i = 0; i < r_state.size() && i < (int)p_quantization.size(); i++) {
+		if (p_quantization[i].step > 0.0) {
+			ptr[i] = quantize(ptr[i], p_quantization[i]);
+		}
+	}
+}
+
+// Lossless floats, XOR-ed with the baseline so that unchanged high bits (sign, exponent) are skipped.
+
+static uint64_t _get_float_bits(double p_value, int p_bits) {
+	if (p_bits == 64) {
+		uint64_t out;
+		memcpy(&out, &p_value, sizeof(out));
+		return out;
+	}
+	const float value = p_value;
+	uint32_t out;
+	memcpy(&out, &value, sizeof(out));
+	return out;
+}
+
+static double _from_float_bits(uint64_t p_value, int p_bits) {
+	if (p_bits == 64) {
+		double out;
+		memcpy(&out, &p_value, sizeof(out));
+		return out;
+	}
+	const uint32_t value = p_value;
+	float out;
+	memcpy(&out, &value, sizeof(out));
+	return out;
+}
+
+static int _count_leading_zeros(uint64_t p_value, int p_bits) {
+	int count = 0;
+	for (int shift = p_bits - 1; shift >= 0 && !(p_value & (uint64_t(1) << shift)); shift--) {
+		count++;
+	}
+	return count;
+}
+
+static int _count_trailing_zeros(uint64_t p_value) {
+	int count = 0;
+	while (count < 64 && !(p_value & (uint64_t(1) << count))) {
+		count++;
+	}
+	return count;
+}
+
+static void _write_float_xor(SceneReplicationCodec::BitWriter &p_writer, double p_value, double p_baseline, int p_bits) {
+	const uint64_t diff = _get_float_bits(p_value, p_bits) ^ _get_float_bits(p_baseline, p_bits);
+	p_writer.write_bit(diff != 0);
+	if (!diff) {
+		return;
+	}
+	const int leading = _count_leading_zeros(diff, p_bits);
+	const int trailing = _count_trailing_zeros(diff);
+	const int length = p_bits - leading - trailing;
+	p_writer.write(leading, 6);
+	p_writer.write(length - 1, 6);
+	p_writer.write(diff >> trailing, length);
+}
+
+static double _read_float_xor(SceneReplicationCodec::BitReader &p_reader, double p_baseline, int p_bits) {
+	if (!p_reader.read_bit()) {
+		return p_baseline;
+	}
+	const int leading = p_reader.read(6);
+	const int length = p_reader.read(6) + 1;
+	const int trailing = p_bits - leading - length;
+	if (trailing < 0) {
+		p_reader.set_error();
+		return p_baseline;
+	}
+	const uint64_t diff = p_reader.read(length) << trailing;
+	return _from_float_bits(_get_float_bits(p_baseline, p_bits) ^ diff, p_bits);
+}
+
+// Values.
+
+Error SceneReplicationCodec::encode_value(BitWriter &p_writer, const Variant &p_value, const Variant &p_baseline, const Quantization &p_quantization) {
+	const Variant::Type type = p_value.get_type();
+	const bool has_baseline = p_baseline.get_type() == type;
+	p_writer.write_bit(has_baseline);
+	if (!has_baseline) {
+		p_writer.write(type, VARIANT_TYPE_BITS);
+	}
+
+	if (type == Variant::NIL) {
+		return OK;
+	}
+	if (type == Variant::BOOL) {
+		p_writer.write_bit(p_value.operator bool());
+		return OK;
+	}
+
+	int64_t ints[4];
+	int64_t base_ints[4] = {};
+	int count = _get_int_components(p_value, ints);
+	if (count) {
+		if (has_baseline) {
+			_get_int_components(p_baseline, base_ints);
+		}
+		for (int i = 0; i < count; i++) {
+			p_writer.write_signed(int64_t(uint64_t(ints[i]) - uint64_t(base_ints[i])));
+		}
+		return OK;
+	}
+
+	double floats[4];
+	double base_floats[4] = {};
+	int bits = 0;
+	count = _get_float_components(p_value, floats, bits);
+	if (count) {
+		if (has_baseline) {
+			_get_float_components(p_baseline, base_floats, bits);
+		}
+		if (p_quantization.step > 0.0) {
+			const int64_t limit = _get_quantized_limit(p_quantization);
+			const int fixed_bits = limit > 0 ? _get_fixed_bits(limit) : 0;
+			for (int i = 0; i < count; i++) {
+				const int64_t q = _quantize_component(floats[i], p_quantization, limit);
+				if (has_baseline) {
+					p_writer.write_signed(q - _quantize_component(base_floats[i], p_quantization, limit));
+				} else if (fixed_bits && fixed_bits <= QUANTIZED_FIXED_MAX_BITS) {
+					p_writer.write(uint64_t(q + limit), fixed_bits);
+				} else {
+					p_writer.write_signed(q);
+				}
+			}
+		} else {
+			for (int i = 0; i < count; i++) {
+				_write_float_xor(p_writer, floats[i], base_floats[i], bits);
+			}
+		}
+		return OK;
+	}
+
+	// Anything else is sent as a regular (compressed) variant.
+	int len = 0;
+	Error err = MultiplayerAPI::encode_and_compress_variant(p_value, nullptr, len, false);
+	ERR_FAIL_COND_V(err != OK, err);
+	ERR_FAIL_COND_V(len > GENERIC_VALUE_MAX_BYTES, ERR_OUT_OF_MEMORY);
+	LocalVector<uint8_t> buf;
+	buf.resize(len);
+	err = MultiplayerAPI::encode_and_compress_variant(p_value, buf.ptr(), len, false);
+	ERR_FAIL_COND_V(err != OK, err);
+	p_writer.write_varint(len);
+	for (int i = 0; i < len; i++) {
+		p_writer.write(buf[i], 8);
+	}
+	return OK;
+}
+
+Error SceneReplicationCodec::decode_value(BitReader &p_reader, Variant &r_value, const Variant &p_baseline, const Quantization &p_quantization) {
+	const bool has_baseline = p_reader.read_bit();
+	const Variant::Type type = has_baseline ? p_baseline.get_type() : Variant::Type(p_reader.read(VARIANT_TYPE_BITS));
+	ERR_FAIL_COND_V(p_reader.has_error() || type >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+
+	if (type == Variant::NIL) {
+		r_value = Variant();
+		return OK;
+	}
+	if (type == Variant::BOOL) {
+		r_value = p_reader.read_bit();
+		ERR_FAIL_COND_V(p_reader.has_error(), ERR_INVALID_DATA);
+		return OK;
+	}
+
+	bool is_float = false;
+	const int count = _get_component_count(type, is_float);
+	if (count && !is_float) {
+		int64_t ints[4] = {};
+		if (has_baseline) {
+			_get_int_components(p_baseline, ints);
+		}
+		for (int i = 0; i < count; i++) {
+			ints[i] = int64_t(uint64_t(ints[i]) + uint64_t(p_reader.read_signed()));
+		}
+		ERR_FAIL_COND_V(p_reader.has_error(), ERR_INVALID_DATA);
+		r_value = _make_int_variant(type, ints);
+		return OK;
+	}
+	if (count) {
+		double floats[4] = {};
+		int bits = 0;
+		if (has_baseline) {
+			_get_float_components(p_baseline, floats, bits);
+		} else {
+			bits = type == Variant::FLOAT ? 64 : (type == Variant::COLOR ? 32 : int(sizeof(real_t) * 8));
+		}
+		if (p_quantization.step > 0.0) {
+			const int64_t limit = _get_quantized_limit(p_quantization);
+			const int fixed_bits = limit > 0 ? _get_fixed_bits(limit) : 0;
+			for (int i = 0; i < count; i++) {
+				int64_t q;
+				if (has_baseline) {
+					q = _quantize_component(floats[i], p_quantization, limit) + p_reader.read_signed();
+				} else if (fixed_bits && fixed_bits <= QUANTIZED_FIXED_MAX_BITS) {
+					q = int64_t(p_reader.read(fixed_bits)) - limit;
+				} else {
+					q = p_reader.read_signed();
+				}
+				floats[i] = q * p_quantization.step;
+			}
+		} else {
+			for (int i = 0; i < count; i++) {
+				floats[i] = _read_float_xor(p_reader, floats[i], bits);
+			}
+		}
+		ERR_FAIL_COND_V(p_reader.has_error(), ERR_INVALID_DATA);
+		r_value = _make_float_variant(type, floats);
+		return OK;
+	}
+
+	const uint64_t len = p_reader.read_varint();
+	// Validate before allocating anything, len is untrusted (and len * 8 could overflow).
+	ERR_FAIL_COND_V(p_reader.has_error() || len > GENERIC_VALUE_MAX_BYTES || len > p_reader.get_remaining_bits() / 8, ERR_INVALID_DATA);
+	LocalVector<uint8_t> buf;
+	buf.resize(len);
+	for (uint64_t i = 0; i < len; i++) {
+		buf[i] = p_reader.read(8);
+	}
+	int consumed = 0;
+	Error err = MultiplayerAPI::decode_and_decompress_variant(r_value, buf.ptr(), len, &consumed, false);
+	ERR_FAIL_COND_V(err != OK, err);
+	ERR_FAIL_COND_V(uint64_t(consumed) != len, ERR_INVALID_DATA);
+	return OK;
+}
+
+// States.
+
+Error SceneReplicationCodec::encode_state(BitWriter &p_writer, Vector<Variant> &r_state, const Vector<Variant> *p_baseline, const LocalVector<Quantization> &p_quantization) {
+	ERR_FAIL_COND_V(p_baseline && p_baseline->size() != r_state.size(), ERR_INVALID_PARAMETER);
+	Variant *ptr = r_state.ptrw();
+	for (int i = 0; i < r_state.size(); i++) {
+		const Quantization quantization = i < (int)p_quantization.size() ? p_quantization[i] : Quantization();
+		if (!p_baseline) {
+			Error err = encode_value(p_writer, ptr[i], Variant(), quantization);
+			ERR_FAIL_COND_V(err != OK, err);
+			continue;
+		}
+		const Variant &base = (*p_baseline)[i];
+		const bool changed = !ptr[i].hash_compare(base);
+		p_writer.write_bit(changed);
+		if (changed) {
+			Error err = encode_value(p_writer, ptr[i], base, quantization);
+			ERR_FAIL_COND_V(err != OK, err);
+		} else {
+			ptr[i] = base; // What the receiver will see.
+		}
+	}
+	return OK;
+}
+
+Error SceneReplicationCodec::decode_state(BitReader &p_reader, Vector<Variant> &r_state, const Vector<Variant> *p_baseline, const LocalVector<Quantization> &p_quantization) {
+	ERR_FAIL_COND_V(p_baseline && p_baseline->size() != r_state.size(), ERR_INVALID_PARAMETER);
+	Variant *ptr = r_state.ptrw();
+	for (int i = 0; i < r_state.size(); i++) {
+		const Quantization quantization = i < (int)p_quantization.size() ? p_quantization[i] : Quantization();
+		if (!p_baseline) {
+			Error err = decode_value(p_reader, ptr[i], Variant(), quantization);
+			ERR_FAIL_COND_V(err != OK, err);
+			continue;
+		}
+		const Variant &base = (*p_baseline)[i];
+		if (p_reader.read_bit()) {
+			Error err = decode_value(p_reader, ptr[i], base, quantization);
+			ERR_FAIL_COND_V(err != OK, err);
+		} else {
+			ptr[i] = base;
+		}
+	}
+	ERR_FAIL_COND_V(p_reader.has_error(), ERR_INVALID_DATA);
+	return OK;
+}
+
+// Deltas.
+
+Error SceneReplicationCodec::encode_delta(BitWriter &p_writer, const List<Variant> &p_values, uint64_t p_indexes, LocalVector<Variant> &r_baseline, const LocalVector<Quantization> &p_quantization) {
+	// The receiver may still hold values from before the baseline was cleared (e.g. while the synchronizer was hidden).
+	p_writer.write_bit(r_baseline.is_empty());
+	int idx = 0;
+	for (const Variant &v : p_values) {
+		while (idx < 64 && !(p_indexes & (1ULL << idx))) {
+			idx++;
+		}
+		ERR_FAIL_COND_V(idx >= 64, ERR_INVALID_PARAMETER);
+		const Quantization quantization = idx < (int)p_quantization.size() ? p_quantization[idx] : Quantization();
+		if (idx >= (int)r_baseline.size()) {
+			r_baseline.resize(idx + 1);
+		}
+		const Variant value = quantize(v, quantization);
+		Error err = encode_value(p_writer, value, r_baseline[idx], quantization);
+		ERR_FAIL_COND_V(err != OK, err);
+		r_baseline[idx] = value;
+		idx++;
+	}
+	return OK;
+}
+
+Error SceneReplicationCodec::decode_delta(BitReader &p_reader, Vector<Variant> &r_values, uint64_t p_indexes, LocalVector<Variant> &r_baseline, const LocalVector<Quantization> &p_quantization) {
+	if (p_reader.read_bit()) {
+		r_baseline.clear();
+	}
+	ERR_FAIL_COND_V(p_reader.has_error(), ERR_INVALID_DATA);
+	Variant *ptr = r_values.ptrw();
+	int idx = 0;
+	for (int i = 0; i < r_values.size(); i++) {
+		while (idx < 64 && !(p_indexes & (1ULL << idx))) {
+			idx++;
+		}
+		ERR_FAIL_COND_V(idx >= 64, ERR_INVALID_DATA);
+		const Quantization quantization = idx < (int)p_quantization.size() ? p_quantization[idx] : Quantization();
+		if (idx >= (int)r_baseline.size()) {
+			r_baseline.resize(idx + 1);
+		}
+		Error err = decode_value(p_reader, ptr[i], r_baseline[idx], quantization);
+		ERR_FAIL_COND_V(err != OK, err);
+		r_baseline[idx] = ptr[i];
+		idx++;
+	}
+	return OK;
+}
@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*  scene_replication_codec.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene_replication_config.h"
+
+#include "core/templates/local_vector.h"
+#include "core/variant/variant.h"
+
+// Bit-packed encoding of replicated states against a baseline state known by both ends.
+// Values equal to the baseline cost a single bit, numeric values are sent as small deltas,
+// floats are either quantized (see SceneReplicationConfig) or XOR-ed with the baseline bits.
+class SceneReplicationCodec {
+public:
+	typedef SceneReplicationConfig::Quantization Quantization;
+
+	class BitWriter {
+		LocalVector<uint8_t> data;
+		uint64_t bits = 0;
+
+	public:
+		void write(uint64_t p_value, int p_bits);
+		void write_bit(bool p_bit) { write(p_bit ? 1 : 0, 1); }
+		void write_varint(uint64_t p_value);
+		void write_signed(int64_t p_value);
+
+		const uint8_t *get_data() const { return data.ptr(); }
+		int get_size() const { return data.size(); }
+		uint64_t get_bit_count() const { return bits; }
+		void clear();
+	};
+
+	class BitReader {
+		const uint8_t *data = nullptr;
+		uint64_t size_bits = 0;
+		uint64_t pos = 0;
+		bool error = false;
+
+	public:
+		uint64_t read(int p_bits);
+		bool read_bit() { return read(1) != 0; }
+		uint64_t read_varint();
+		int64_t read_signed();
+
+		uint64_t get_remaining_bits() const { return error ? 0 : size_bits - pos; }
+		// Set when reading past the end, or when malformed data was found.
+		bool has_error() const { return error; }
+		void set_error() { error = true; }
+
+		BitReader(const uint8_t *p_data, int p_size) {
+			data = p_data;
+			size_bits = uint64_t(p_size) * 8;
+		}
+	};
+
+	// Returns the value as it will be seen by the receiver.
+	static Variant quantize(const Variant &p_value, const Quantization &p_quantization);
+	static void quantize_state(Vector<Variant> &r_state, const LocalVector<Quantization> &p_quantization);
+
+	// A Variant of a different type (including NIL) as baseline is valid, the value is then sent in full.
+	static Error encode_value(BitWriter &p_writer, const Variant &p_value, const Variant &p_baseline, const Quantization &p_quantization);
+	static Error decode_value(BitReader &p_reader, Variant &r_value, const Variant &p_baseline, const Quantization &p_quantization);
+
+	// States must be quantized beforehand. Without a baseline all values are sent.
+	// Values matching the baseline are replaced with it, so the encoded state can be kept as the next baseline.
+	static Error encode_state(BitWriter &p_writer, Vector<Variant> &r_state, const Vector<Variant> *p_baseline, const LocalVector<Quantization> &p_quantization);
+	// The state must already be sized to the number of properties.
+	static Error decode_state(BitReader &p_reader, Vector<Variant> &r_state, const Vector<Variant> *p_baseline, const LocalVector<Quantization> &p_quantization);
+
+	// Deltas carry the properties set in the index mask, each against the last value sent for it, which is kept
+	// in the baseline (indexed by property). An empty sender baseline makes the receiver drop its own.
+	static Error encode_delta(BitWriter &p_writer, const List<Variant> &p_values, uint64_t p_indexes, LocalVector<Variant> &r_baseline, const LocalVector<Quantization> &p_quantization);
+	// The values must already be sized to the number of properties in the mask.
+	static Error decode_delta(BitReader &p_reader, Vector<Variant> &r_values, uint64_t p_indexes, LocalVector<Variant> &r_baseline, const LocalVector<Quantization> &p_quantization);
+};
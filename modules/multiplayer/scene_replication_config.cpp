@@ -52,6 +52,14 @@ bool SceneReplicationConfig::_set(const StringName &p_name, const Variant &p_val
 			ERR_FAIL_COND_V(mode < REPLICATION_MODE_NEVER || mode > REPLICATION_MODE_ON_CHANGE, false);
 			property_set_replication_mode(prop.name, mode);
 			return true;
+		} else if (what == "quantization_step") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::FLOAT && p_value.get_type() != Variant::INT, false);
+			property_set_quantization_step(prop.name, p_value);
+			return true;
+		} else if (what == "quantization_range") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::FLOAT && p_value.get_type() != Variant::INT, false);
+			property_set_quantization_range(prop.name, p_value);
+			return true;
 		}
 		ERR_FAIL_COND_V(p_value.get_type() != Variant::BOOL, false);
 		if (what == "spawn") {
@@ -87,16 +95,31 @@ bool SceneReplicationConfig::_get(const StringName &p_name, Variant &r_ret) cons
 		} else if (what == "replication_mode") {
 			r_ret = prop.mode;
 			return true;
+		} else if (what == "quantization_step") {
+			r_ret = prop.quantization.step;
+			return true;
+		} else if (what == "quantization_range") {
+			r_ret = prop.quantization.range;
+			return true;
 		}
 	}
 	return false;
 }
 
 void SceneReplicationConfig::_get_property_list(List<PropertyInfo> *p_list) const {
-	for (int i = 0; i < properties.size(); i++) {
+	int i = 0;
+	for (const ReplicationProperty &prop : properties) {
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/path", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/spawn", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/replication_mode", PROPERTY_HINT_ENUM, "Never,Always,On Change", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		// Only stored when set, so configurations without quantization are saved as before.
+		if (prop.quantization.step != 0.0) {
+			p_list->push_back(PropertyInfo(Variant::FLOAT, "properties/" + itos(i) + "/quantization_step", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		}
+		if (prop.quantization.range != 0.0) {
+			p_list->push_back(PropertyInfo(Variant::FLOAT, "properties/" + itos(i) + "/quantization_range", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		}
+		i++;
 	}
 }
 
@@ -106,6 +129,8 @@ void SceneReplicationConfig::reset_state() {
 	sync_props.clear();
 	spawn_props.clear();
 	watch_props.clear();
+	sync_quantization.clear();
+	watch_quantization.clear();
 }
 
 TypedArray<NodePath> SceneReplicationConfig::get_properties() const {
@@ -222,6 +247,40 @@ void SceneReplicationConfig::property_set_replication_mode(const NodePath &p_pat
 	dirty = true;
 }
 
+double SceneReplicationConfig::property_get_quantization_step(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, 0.0);
+	return E->get().quantization.step;
+}
+
+void SceneReplicationConfig::property_set_quantization_step(const NodePath &p_path, double p_step) {
+	ERR_FAIL_COND_MSG(p_step < 0.0, "The quantization step can't be negative.");
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	if (E->get().quantization.step == p_step) {
+		return;
+	}
+	E->get().quantization.step = p_step;
+	dirty = true;
+}
+
+double SceneReplicationConfig::property_get_quantization_range(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, 0.0);
+	return E->get().quantization.range;
+}
+
+void SceneReplicationConfig::property_set_quantization_range(const NodePath &p_path, double p_range) {
+	ERR_FAIL_COND_MSG(p_range < 0.0, "The quantization range can't be negative.");
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	if (E->get().quantization.range == p_range) {
+		return;
+	}
+	E->get().quantization.range = p_range;
+	dirty = true;
+}
+
 void SceneReplicationConfig::_update() {
 	if (!dirty) {
 		return;
@@ -230,6 +289,8 @@ void SceneReplicationConfig::_update() {
 	sync_props.clear();
 	spawn_props.clear();
 	watch_props.clear();
+	sync_quantization.clear();
+	watch_quantization.clear();
 	for (const ReplicationProperty &prop : properties) {
 		if (prop.spawn) {
 			spawn_props.push_back(prop.name);
@@ -237,9 +298,11 @@ void SceneReplicationConfig::_update() {
 		switch (prop.mode) {
 			case REPLICATION_MODE_ALWAYS:
 				sync_props.push_back(prop.name);
+				sync_quantization.push_back(prop.quantization);
 				break;
 			case REPLICATION_MODE_ON_CHANGE:
 				watch_props.push_back(prop.name);
+				watch_quantization.push_back(prop.quantization);
 				break;
 			default:
 				break;
@@ -268,6 +331,20 @@ const List<NodePath> &SceneReplicationConfig::get_watch_properties() {
 	return watch_props;
 }
 
+const LocalVector<SceneReplicationConfig::Quantization> &SceneReplicationConfig::get_sync_quantization() {
+	if (dirty) {
+		_update();
+	}
+	return sync_quantization;
+}
+
+const LocalVector<SceneReplicationConfig::Quantization> &SceneReplicationConfig::get_watch_quantization() {
+	if (dirty) {
+		_update();
+	}
+	return watch_quantization;
+}
+
 void SceneReplicationConfig::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_properties"), &SceneReplicationConfig::get_properties);
 	ClassDB::bind_method(D_METHOD("add_property", "path", "index"), &SceneReplicationConfig::add_property, DEFVAL(-1));
@@ -278,6 +355,10 @@ void SceneReplicationConfig::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("property_set_spawn", "path", "enabled"), &SceneReplicationConfig::property_set_spawn);
 	ClassDB::bind_method(D_METHOD("property_get_replication_mode", "path"), &SceneReplicationConfig::property_get_replication_mode);
 	ClassDB::bind_method(D_METHOD("property_set_replication_mode", "path", "mode"), &SceneReplicationConfig::property_set_replication_mode);
+	ClassDB::bind_method(D_METHOD("property_get_quantization_step", "path"), &SceneReplicationConfig::property_get_quantization_step);
+	ClassDB::bind_method(D_METHOD("property_set_quantization_step", "path", "step"), &SceneReplicationConfig::property_set_quantization_step);
+	ClassDB::bind_method(D_METHOD("property_get_quantization_range", "path"), &SceneReplicationConfig::property_get_quantization_range);
+	ClassDB::bind_method(D_METHOD("property_set_quantization_range", "path", "range"), &SceneReplicationConfig::property_set_quantization_range);
 
 	BIND_ENUM_CONSTANT(REPLICATION_MODE_NEVER);
 	BIND_ENUM_CONSTANT(REPLICATION_MODE_ALWAYS);
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
 
 class SceneReplicationConfig : public Resource {
@@ -45,11 +46,17 @@ public:
 		REPLICATION_MODE_ON_CHANGE,
 	};
 
+	struct Quantization {
+		double step = 0.0; // Zero sends floats losslessly.
+		double range = 0.0; // Zero means unbounded.
+	};
+
 private:
 	struct ReplicationProperty {
 		NodePath name;
 		bool spawn = true;
 		ReplicationMode mode = REPLICATION_MODE_ALWAYS;
+		Quantization quantization;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -66,6 +73,8 @@ private:
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
 	List<NodePath> watch_props;
+	LocalVector<Quantization> sync_quantization;
+	LocalVector<Quantization> watch_quantization;
 	bool dirty = false;
 
 	void _update();
@@ -99,9 +108,17 @@ public:
 	ReplicationMode property_get_replication_mode(const NodePath &p_path);
 	void property_set_replication_mode(const NodePath &p_path, ReplicationMode p_mode);
 
+	double property_get_quantization_step(const NodePath &p_path);
+	void property_set_quantization_step(const NodePath &p_path, double p_step);
+
+	double property_get_quantization_range(const NodePath &p_path);
+	void property_set_quantization_range(const NodePath &p_path, double p_range);
+
 	const List<NodePath> &get_spawn_properties();
 	const List<NodePath> &get_sync_properties();
 	const List<NodePath> &get_watch_properties();
+	const LocalVector<Quantization> &get_sync_quantization();
+	const LocalVector<Quantization> &get_watch_quantization();
 
 	SceneReplicationConfig() {}
 };
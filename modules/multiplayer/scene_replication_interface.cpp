@@ -102,6 +102,9 @@ void SceneReplicationInterface::on_peer_change(int p_id, bool p_connected) {
 		ERR_FAIL_COND(!peers_info.has(p_id));
 		_free_remotes(peers_info[p_id]);
 		peers_info.erase(p_id);
+		LocalVector<SceneInterestGrid::Change> changes;
+		interest_grid.remove_peer(p_id, changes);
+		_apply_interest_changes(changes);
 	}
 }
 
@@ -110,6 +113,9 @@ void SceneReplicationInterface::on_reset() {
 		_free_remotes(E.value);
 	}
 	peers_info.clear();
+	LocalVector<SceneInterestGrid::Change> changes;
+	interest_grid.clear_peers(changes);
+	_apply_interest_changes(changes);
 	// Tracked nodes are cleared on deletion, here we only reset the ids so they can be later re-assigned.
 	for (KeyValue<ObjectID, TrackedNode> &E : tracked_nodes) {
 		TrackedNode &tobj = E.value;
@@ -138,9 +144,13 @@ void SceneReplicationInterface::on_network_process() {
 		spawn_queue.clear();
 	}
 
+	_update_interest();
+
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		// Acknowledge received states, even when not sending any.
+		_send_sync_acks(E.key, E.value);
 		const HashSet<ObjectID> to_sync = E.value.sync_nodes;
 		if (to_sync.is_empty()) {
 			continue; // Nothing to sync
@@ -231,6 +241,14 @@ Error SceneReplicationInterface::on_replication_start(Object *p_obj, Variant p_c
 	tobj.synchronizers.insert(sid);
 	sync_nodes.insert(sid);
 
+	if (sync->is_using_interest_management() && _has_authority(sync)) {
+		LocalVector<SceneInterestGrid::Change> changes;
+		interest_grid.update_entity(sid, sync->get_interest_position(), changes);
+		for (const SceneInterestGrid::Change &change : changes) {
+			sync->set_interest_for(change.peer, change.relevant);
+		}
+	}
+
 	// Update visibility.
 	sync->connect(SceneStringName(visibility_changed), callable_mp(this, &SceneReplicationInterface::_visibility_changed).bind(sync->get_instance_id()));
 	_update_sync_visibility(0, sync);
@@ -277,11 +295,22 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	TrackedNode &tobj = _track(oid);
 	tobj.synchronizers.erase(sid);
 	sync_nodes.erase(sid);
+	if (interest_grid.has_entity(sid)) {
+		LocalVector<SceneInterestGrid::Change> changes;
+		interest_grid.remove_entity(sid, changes);
+		for (const SceneInterestGrid::Change &change : changes) {
+			sync->set_interest_for(change.peer, change.relevant);
+		}
+	}
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
 		E.value.last_watch_usecs.erase(sid);
+		E.value.clear_baselines(sid);
 		if (sync->get_net_id()) {
 			E.value.recv_sync_ids.erase(sync->get_net_id());
+			E.value.recv_syncs.erase(sync->get_net_id());
+			E.value.recv_watch_values.erase(sync->get_net_id());
+			E.value.pending_sync_acks.erase(sync->get_net_id());
 		}
 	}
 	return OK;
@@ -299,6 +328,32 @@ void SceneReplicationInterface::_visibility_changed(int p_peer, ObjectID p_sid)
 	_update_sync_visibility(p_peer, sync);
 }
 
+void SceneReplicationInterface::_update_interest() {
+	// Only entities moving across cells, and the peers subscribed to those cells, generate changes.
+	LocalVector<SceneInterestGrid::Change> changes;
+	for (const ObjectID &sid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		ERR_CONTINUE(!sync);
+		if (sync->is_using_interest_management() && _has_authority(sync)) {
+			interest_grid.update_entity(sid, sync->get_interest_position(), changes);
+		} else if (interest_grid.has_entity(sid)) {
+			interest_grid.remove_entity(sid, changes);
+		}
+	}
+	_apply_interest_changes(changes);
+}
+
+void SceneReplicationInterface::_apply_interest_changes(const LocalVector<SceneInterestGrid::Change> &p_changes) {
+	for (const SceneInterestGrid::Change &change : p_changes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(change.id);
+		ERR_CONTINUE(!sync);
+		sync->set_interest_for(change.peer, change.relevant);
+		if (sync->is_using_interest_management() && peers_info.has(change.peer)) {
+			_visibility_changed(change.peer, change.id);
+		}
+	}
+}
+
 bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer) const {
 	if (!tracked_nodes.has(p_oid)) {
 		return true; // Untracked nodes are always visible to RPCs.
@@ -358,6 +413,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 			} else {
 				E.value.sync_nodes.erase(sid);
 				E.value.last_watch_usecs.erase(sid);
+				E.value.clear_baselines(sid);
 			}
 		}
 		return OK;
@@ -371,6 +427,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 		} else {
 			peers_info[p_peer].sync_nodes.erase(sid);
 			peers_info[p_peer].last_watch_usecs.erase(sid);
+			peers_info[p_peer].clear_baselines(sid);
 		}
 		return OK;
 	}
@@ -706,10 +763,12 @@ MultiplayerSynchronizer *SceneReplicationInterface::_find_synchronizer(int p_pee
 }
 
 void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs) {
-	MAKE_ROOM(/* header */ 1 + /* element */ 4 + 8 + 4 + delta_mtu);
+	MAKE_ROOM(/* header */ SYNC_HEADER_SIZE + /* element */ 4 + 8 + 4 + delta_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
 	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT);
-	int ofs = 1;
+	ptr[1] = SYNC_PROTOCOL_VERSION;
+	int ofs = SYNC_HEADER_SIZE;
+	PeerInfo &info = peers_info[p_peer];
 	for (const ObjectID &oid : p_synchronizers) {
 		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
 		ERR_CONTINUE(!sync || !sync->get_replication_config_ptr() || !_has_authority(sync));
@@ -725,45 +784,42 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			continue; // Nothing to update.
 		}
 
-		Vector<const Variant *> varp;
-		varp.resize(delta.size());
-		const Variant **vptr = varp.ptrw();
-		int i = 0;
-		for (const Variant &v : delta) {
-			vptr[i] = &v;
-			i++;
-		}
-		int size;
-		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
+		// The delta channel is reliable and ordered, so the last values sent are known to the receiver.
+		const LocalVector<SceneReplicationCodec::Quantization> &quantization = sync->get_replication_config_ptr()->get_watch_quantization();
+		LocalVector<Variant> values = info.sent_watch_values.has(oid) ? info.sent_watch_values[oid] : LocalVector<Variant>();
+		codec_writer.clear();
+		Error err = SceneReplicationCodec::encode_delta(codec_writer, delta, indexes, values, quantization);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
+		const int size = codec_writer.get_size();
 
 		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
 
 		if (ofs + 4 + 8 + 4 + size > delta_mtu) {
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, true);
-			ofs = 1;
-		}
-		if (size) {
-			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
-			ofs += encode_uint64(indexes, &ptr[ofs]);
-			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
-			ofs += size;
+			ofs = SYNC_HEADER_SIZE;
 		}
+		ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
+		ofs += encode_uint64(indexes, &ptr[ofs]);
+		ofs += encode_uint32(size, &ptr[ofs]);
+		memcpy(&ptr[ofs], codec_writer.get_data(), size);
+		ofs += size;
 #ifdef DEBUG_ENABLED
 		_profile_node_data("delta_out", oid, size);
 #endif
-		peers_info[p_peer].last_watch_usecs[oid] = p_usec;
+		info.sent_watch_values[oid] = values;
+		info.last_watch_usecs[oid] = p_usec;
 	}
-	if (ofs > 1) {
+	if (ofs > SYNC_HEADER_SIZE) {
 		// Got some left over to send.
 		_send_raw(packet_cache.ptr(), ofs, p_peer, true);
 	}
 }
 
 Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
-	int ofs = 1;
+	PeerInfo *info = peers_info.getptr(p_from);
+	ERR_FAIL_NULL_V(info, ERR_INVALID_PARAMETER);
+	int ofs = SYNC_HEADER_SIZE;
 	while (ofs + 4 + 8 + 4 < p_buffer_len) {
 		uint32_t net_id = decode_uint32(&p_buffer[ofs]);
 		ofs += 4;
@@ -780,12 +836,13 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 		}
 		List<NodePath> props = sync->get_delta_properties(indexes);
 		ERR_FAIL_COND_V(props.is_empty(), ERR_INVALID_DATA);
+		const LocalVector<SceneReplicationCodec::Quantization> &quantization = sync->get_replication_config_ptr()->get_watch_quantization();
+		LocalVector<Variant> &values = info->recv_watch_values[net_id];
+		SceneReplicationCodec::BitReader reader(p_buffer + ofs, size);
 		Vector<Variant> vars;
 		vars.resize(props.size());
-		int consumed = 0;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, p_buffer + ofs, size, consumed);
+		Error err = SceneReplicationCodec::decode_delta(reader, vars, indexes, values, quantization);
 		ERR_FAIL_COND_V(err != OK, err);
-		ERR_FAIL_COND_V(uint32_t(consumed) != size, ERR_INVALID_DATA);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
 		ERR_FAIL_COND_V(err != OK, err);
 		ofs += size;
@@ -798,11 +855,13 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 }
 
 void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec) {
-	MAKE_ROOM(/* header */ 3 + /* element */ 4 + 4 + sync_mtu);
+	MAKE_ROOM(/* header */ SYNC_HEADER_SIZE + 2 + /* element */ 4 + 2 + sync_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
 	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC;
-	int ofs = 1;
-	ofs += encode_uint16(p_sync_net_time, &ptr[1]);
+	ptr[1] = SYNC_PROTOCOL_VERSION;
+	int ofs = SYNC_HEADER_SIZE;
+	ofs += encode_uint16(p_sync_net_time, &ptr[ofs]);
+	PeerInfo &info = peers_info[p_peer];
 	// Can only send updates for already notified nodes.
 	// This is a lazy implementation, we could optimize much more here with by grouping by replication config.
 	for (const ObjectID &oid : p_synchronizers) {
@@ -819,50 +878,71 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 			// The path based sync is not yet confirmed, skipping.
 			continue;
 		}
-		int size;
 		Vector<Variant> vars;
 		Vector<const Variant *> varp;
-		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
+		SceneReplicationConfig *config = sync->get_replication_config_ptr();
+		const List<NodePath> props = config->get_sync_properties();
 		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
 		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+		const LocalVector<SceneReplicationCodec::Quantization> &quantization = config->get_sync_quantization();
+		SceneReplicationCodec::quantize_state(vars, quantization);
+
+		// Encode against the last state acknowledged by the peer, if still in history, or send a full state.
+		SyncHistory &history = info.sent_syncs[oid];
+		const Vector<Variant> *baseline = history.acked ? history.get_state(history.acked_time, vars.size()) : nullptr;
+		codec_writer.clear();
+		codec_writer.write_bit(baseline != nullptr);
+		if (baseline) {
+			codec_writer.write(history.acked_time, 16);
+		}
+		err = SceneReplicationCodec::encode_state(codec_writer, vars, baseline, quantization);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+		const int size = codec_writer.get_size();
 		// TODO Handle single state above MTU.
-		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
-		if (ofs + 4 + 4 + size > sync_mtu) {
+		ERR_CONTINUE_MSG(size > sync_mtu || size > UINT16_MAX, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		if (ofs + 4 + 2 + size > sync_mtu) {
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
-			ofs = 3;
-		}
-		if (size) {
-			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
-			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
-			ofs += size;
+			ofs = SYNC_HEADER_SIZE + 2;
 		}
+		ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
+		ofs += encode_uint16(size, &ptr[ofs]);
+		memcpy(&ptr[ofs], codec_writer.get_data(), size);
+		ofs += size;
+		history.set_state(p_sync_net_time, vars);
+		info.sent_sync_ids[sync->get_net_id()] = oid;
 #ifdef DEBUG_ENABLED
 		_profile_node_data("sync_out", oid, size);
 #endif
 	}
-	if (ofs > 3) {
+	if (ofs > SYNC_HEADER_SIZE + 2) {
 		// Got some left over to send.
 		_send_raw(packet_cache.ptr(), ofs, p_peer, false);
 	}
 }
 
 Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
-	ERR_FAIL_COND_V_MSG(p_buffer_len < 11, ERR_INVALID_DATA, "Invalid sync packet received");
+	ERR_FAIL_COND_V_MSG(p_buffer_len < SYNC_HEADER_SIZE, ERR_INVALID_DATA, "Invalid sync packet received");
+	ERR_FAIL_COND_V_MSG(p_buffer[1] != SYNC_PROTOCOL_VERSION, ERR_INVALID_DATA, vformat("Ignoring sync packet with protocol version %d (expected %d).", p_buffer[1], SYNC_PROTOCOL_VERSION));
+	bool is_ack = (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT)) != 0;
+	if (is_ack) {
+		return _on_sync_ack_receive(p_from, p_buffer, p_buffer_len);
+	}
+	ERR_FAIL_COND_V_MSG(p_buffer_len < SYNC_HEADER_SIZE + 2 + 4 + 2 + 1, ERR_INVALID_DATA, "Invalid sync packet received");
 	bool is_delta = (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT)) != 0;
 	if (is_delta) {
 		return on_delta_receive(p_from, p_buffer, p_buffer_len);
 	}
-	uint16_t time = decode_uint16(&p_buffer[1]);
-	int ofs = 3;
-	while (ofs + 8 < p_buffer_len) {
+	PeerInfo *peer_info = peers_info.getptr(p_from);
+	ERR_FAIL_NULL_V(peer_info, ERR_INVALID_PARAMETER);
+	PeerInfo &info = *peer_info;
+	uint16_t time = decode_uint16(&p_buffer[SYNC_HEADER_SIZE]);
+	int ofs = SYNC_HEADER_SIZE + 2;
+	while (ofs + 6 < p_buffer_len) {
 		uint32_t net_id = decode_uint32(&p_buffer[ofs]);
 		ofs += 4;
-		uint32_t size = decode_uint32(&p_buffer[ofs]);
-		ofs += 4;
+		uint32_t size = decode_uint16(&p_buffer[ofs]);
+		ofs += 2;
 		ERR_FAIL_COND_V(size > uint32_t(p_buffer_len - ofs), ERR_INVALID_DATA);
 		MultiplayerSynchronizer *sync = _find_synchronizer(p_from, net_id);
 		if (!sync) {
@@ -876,17 +956,37 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 			ofs += size;
 			ERR_CONTINUE_MSG(true, "Ignoring sync data from non-authority or for missing node.");
 		}
+		SceneReplicationConfig *config = sync->get_replication_config_ptr();
+		const List<NodePath> props = config->get_sync_properties();
+		SyncHistory &history = info.recv_syncs[net_id];
+		SceneReplicationCodec::BitReader reader(&p_buffer[ofs], size);
+		const Vector<Variant> *baseline = nullptr;
+		if (reader.read_bit()) {
+			const uint16_t baseline_time = reader.read(16);
+			baseline = history.get_state(baseline_time, props.size());
+			if (!baseline) {
+				// Baseline no longer available, wait for a state based on a more recent acknowledgment.
+				ofs += size;
+				continue;
+			}
+		}
+		Vector<Variant> vars;
+		vars.resize(props.size());
+		Error err = SceneReplicationCodec::decode_state(reader, vars, baseline, config->get_sync_quantization());
+		ERR_FAIL_COND_V(err, err);
+		// Even states too old to be applied can be used as baseline.
+		history.set_state(time, vars);
+		HashMap<uint32_t, uint16_t>::Iterator A = info.pending_sync_acks.find(net_id);
+		if (!A) {
+			info.pending_sync_acks.insert(net_id, time);
+		} else if (int16_t(time - A->value) > 0) {
+			A->value = time;
+		}
 		if (!sync->update_inbound_sync_time(time)) {
 			// State is too old.
 			ofs += size;
 			continue;
 		}
-		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
-		Vector<Variant> vars;
-		vars.resize(props.size());
-		int consumed;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
-		ERR_FAIL_COND_V(err, err);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
 		ERR_FAIL_COND_V(err, err);
 		ofs += size;
@@ -898,6 +998,58 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 	return OK;
 }
 
+void SceneReplicationInterface::_send_sync_acks(int p_peer, PeerInfo &p_info) {
+	if (p_info.pending_sync_acks.is_empty()) {
+		return;
+	}
+	MAKE_ROOM(sync_mtu);
+	uint8_t *ptr = packet_cache.ptrw();
+	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT);
+	ptr[1] = SYNC_PROTOCOL_VERSION;
+	int ofs = SYNC_HEADER_SIZE;
+	for (const KeyValue<uint32_t, uint16_t> &E : p_info.pending_sync_acks) {
+		if (ofs + 4 + 2 > sync_mtu) {
+			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+			ofs = SYNC_HEADER_SIZE;
+		}
+		ofs += encode_uint32(E.key, &ptr[ofs]);
+		ofs += encode_uint16(E.value, &ptr[ofs]);
+	}
+	_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+	p_info.pending_sync_acks.clear();
+}
+
+Error SceneReplicationInterface::_on_sync_ack_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	PeerInfo *peer_info = peers_info.getptr(p_from);
+	ERR_FAIL_NULL_V(peer_info, ERR_INVALID_PARAMETER);
+	PeerInfo &info = *peer_info;
+	int ofs = SYNC_HEADER_SIZE;
+	while (ofs + 4 + 2 <= p_buffer_len) {
+		uint32_t net_id = decode_uint32(&p_buffer[ofs]);
+		ofs += 4;
+		uint16_t time = decode_uint16(&p_buffer[ofs]);
+		ofs += 2;
+		HashMap<uint32_t, ObjectID>::Iterator I = info.sent_sync_ids.find(net_id);
+		if (!I) {
+			continue;
+		}
+		HashMap<ObjectID, SyncHistory>::Iterator H = info.sent_syncs.find(I->value);
+		if (!H) {
+			continue; // Baselines were reset.
+		}
+		SyncHistory &history = H->value;
+		if (history.acked && int16_t(time - history.acked_time) <= 0) {
+			continue; // Out of order.
+		}
+		if (!history.has_state(time)) {
+			continue; // Too old.
+		}
+		history.acked_time = time;
+		history.acked = true;
+	}
+	return OK;
+}
+
 void SceneReplicationInterface::set_max_sync_packet_size(int p_size) {
 	ERR_FAIL_COND_MSG(p_size < 128, "Sync maximum packet size must be at least 128 bytes.");
 	sync_mtu = p_size;
@@ -915,3 +1067,32 @@ void SceneReplicationInterface::set_max_delta_packet_size(int p_size) {
 int SceneReplicationInterface::get_max_delta_packet_size() const {
 	return delta_mtu;
 }
+
+void SceneReplicationInterface::set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	ERR_FAIL_COND_MSG(p_peer <= 0, "Interest can only be set for a specific peer.");
+	ERR_FAIL_COND_MSG(p_radius < 0, "The interest radius can't be negative.");
+	LocalVector<SceneInterestGrid::Change> changes;
+	interest_grid.set_peer(p_peer, p_origin, p_radius, changes);
+	_apply_interest_changes(changes);
+}
+
+void SceneReplicationInterface::remove_peer_interest(int p_peer) {
+	LocalVector<SceneInterestGrid::Change> changes;
+	interest_grid.remove_peer(p_peer, changes);
+	_apply_interest_changes(changes);
+}
+
+bool SceneReplicationInterface::has_peer_interest(int p_peer) const {
+	return interest_grid.has_peer(p_peer);
+}
+
+void SceneReplicationInterface::set_interest_cell_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "The interest cell size must be greater than 0.");
+	LocalVector<SceneInterestGrid::Change> changes;
+	interest_grid.set_cell_size(p_size, changes);
+	_apply_interest_changes(changes);
+}
+
+real_t SceneReplicationInterface::get_interest_cell_size() const {
+	return interest_grid.get_cell_size();
+}
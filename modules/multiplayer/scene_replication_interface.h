@@ -32,6 +32,8 @@
 
 #include "multiplayer_spawner.h"
 #include "multiplayer_synchronizer.h"
+#include "scene_interest_grid.h"
+#include "scene_replication_codec.h"
 
 #include "core/object/ref_counted.h"
 
@@ -59,6 +61,39 @@ private:
 		}
 	};
 
+	enum {
+		SYNC_HISTORY_SIZE = 32, // Number of sync states kept as potential baselines (per peer, per synchronizer).
+		SYNC_PROTOCOL_VERSION = 3, // Sent with every sync, delta and ack packet. Bump when their layout changes.
+		SYNC_HEADER_SIZE = 2, // Command + protocol version.
+	};
+
+	// Sync states sent to (or received from) a peer, indexed by sync time.
+	struct SyncHistory {
+		struct Entry {
+			uint16_t time = 0;
+			bool valid = false;
+			Vector<Variant> state;
+		};
+		Entry entries[SYNC_HISTORY_SIZE];
+		uint16_t acked_time = 0;
+		bool acked = false;
+
+		const Vector<Variant> *get_state(uint16_t p_time, int p_size) const {
+			const Entry &e = entries[p_time % SYNC_HISTORY_SIZE];
+			return e.valid && e.time == p_time && e.state.size() == p_size ? &e.state : nullptr;
+		}
+		bool has_state(uint16_t p_time) const {
+			const Entry &e = entries[p_time % SYNC_HISTORY_SIZE];
+			return e.valid && e.time == p_time;
+		}
+		void set_state(uint16_t p_time, const Vector<Variant> &p_state) {
+			Entry &e = entries[p_time % SYNC_HISTORY_SIZE];
+			e.time = p_time;
+			e.valid = true;
+			e.state = p_state;
+		}
+	};
+
 	struct PeerInfo {
 		HashSet<ObjectID> sync_nodes;
 		HashSet<ObjectID> spawn_nodes;
@@ -66,6 +101,20 @@ private:
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
+
+		// Delta compression baselines.
+		HashMap<ObjectID, SyncHistory> sent_syncs;
+		HashMap<uint32_t, ObjectID> sent_sync_ids; // To match acks.
+		HashMap<uint32_t, SyncHistory> recv_syncs;
+		HashMap<uint32_t, uint16_t> pending_sync_acks;
+		HashMap<ObjectID, LocalVector<Variant>> sent_watch_values; // Delta channel is reliable, last sent values are the baseline.
+		HashMap<uint32_t, LocalVector<Variant>> recv_watch_values;
+
+		// The next delta sent without a baseline also makes the receiver drop its recv_watch_values.
+		void clear_baselines(const ObjectID &p_sid) {
+			sent_syncs.erase(p_sid);
+			sent_watch_values.erase(p_sid);
+		}
 	};
 
 	// Replication state.
@@ -75,6 +124,9 @@ private:
 	HashSet<ObjectID> spawned_nodes;
 	HashSet<ObjectID> sync_nodes;
 
+	// Spatial interest management.
+	SceneInterestGrid interest_grid;
+
 	// Pending local spawn information (handles spawning nested nodes during ready).
 	HashSet<ObjectID> spawn_queue;
 
@@ -89,6 +141,7 @@ private:
 	SceneMultiplayer *multiplayer = nullptr;
 	SceneCacheInterface *multiplayer_cache = nullptr;
 	PackedByteArray packet_cache;
+	SceneReplicationCodec::BitWriter codec_writer;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
 
@@ -102,11 +155,15 @@ private:
 
 	void _send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
 	void _send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
+	void _send_sync_acks(int p_peer, PeerInfo &p_info);
+	Error _on_sync_ack_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
 
 	void _visibility_changed(int p_peer, ObjectID p_oid);
+	void _update_interest();
+	void _apply_interest_changes(const LocalVector<SceneInterestGrid::Change> &p_changes);
 	Error _update_sync_visibility(int p_peer, MultiplayerSynchronizer *p_sync);
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
 	void _free_remotes(const PeerInfo &p_info);
@@ -145,6 +202,13 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_peer_interest(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void remove_peer_interest(int p_peer);
+	bool has_peer_interest(int p_peer) const;
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
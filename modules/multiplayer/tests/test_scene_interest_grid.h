@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*  test_scene_interest_grid.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "tests/test_macros.h"
+
+#include "../scene_interest_grid.h"
+
+namespace TestSceneInterestGrid {
+
+static int count_changes(const LocalVector<SceneInterestGrid::Change> &p_changes, int p_peer, bool p_relevant) {
+	int count = 0;
+	for (const SceneInterestGrid::Change &change : p_changes) {
+		if (change.peer == p_peer && change.relevant == p_relevant) {
+			count++;
+		}
+	}
+	return count;
+}
+
+TEST_CASE("[Multiplayer][SceneInterestGrid] Entities entering and leaving peer areas") {
+	SceneInterestGrid grid;
+	LocalVector<SceneInterestGrid::Change> changes;
+	grid.set_cell_size(10, changes);
+	CHECK(changes.is_empty());
+
+	const ObjectID a = ObjectID(uint64_t(1));
+	const ObjectID b = ObjectID(uint64_t(2));
+	grid.update_entity(a, Vector3(5, 5, 5), changes);
+	grid.update_entity(b, Vector3(105, 5, 5), changes);
+	CHECK(changes.is_empty()); // No peers yet.
+
+	grid.set_peer(2, Vector3(0, 0, 0), 15, changes);
+	CHECK_EQ(changes.size(), 1u);
+	CHECK_EQ(changes[0].id, a);
+	CHECK(changes[0].relevant);
+	CHECK(grid.is_relevant(a, 2));
+	CHECK_FALSE(grid.is_relevant(b, 2));
+
+	// Moving within a cell doesn't report anything.
+	changes.clear();
+	grid.update_entity(a, Vector3(6, 7, 8), changes);
+	CHECK(changes.is_empty());
+
+	// Moving across subscribed cells doesn't either.
+	grid.update_entity(a, Vector3(12, 5, 5), changes);
+	CHECK(changes.is_empty());
+
+	// Leaving the area.
+	grid.update_entity(a, Vector3(50, 5, 5), changes);
+	CHECK_EQ(count_changes(changes, 2, false), 1);
+	CHECK_FALSE(grid.is_relevant(a, 2));
+
+	// Peer moving toward both entities.
+	changes.clear();
+	grid.set_peer(2, Vector3(100, 0, 0), 60, changes);
+	CHECK_EQ(count_changes(changes, 2, true), 2);
+	CHECK(grid.is_relevant(a, 2));
+	CHECK(grid.is_relevant(b, 2));
+
+	// Removing a peer.
+	changes.clear();
+	grid.remove_peer(2, changes);
+	CHECK_EQ(count_changes(changes, 2, false), 2);
+	CHECK_FALSE(grid.has_peer(2));
+
+	// Removing an entity only reports for interested peers.
+	changes.clear();
+	grid.set_peer(3, Vector3(100, 0, 0), 10, changes);
+	CHECK_EQ(count_changes(changes, 3, true), 1);
+	changes.clear();
+	grid.remove_entity(a, changes);
+	CHECK(changes.is_empty());
+	grid.remove_entity(b, changes);
+	CHECK_EQ(count_changes(changes, 3, false), 1);
+	CHECK_FALSE(grid.has_entity(b));
+}
+
+TEST_CASE("[Multiplayer][SceneInterestGrid] Cell size changes only report differences") {
+	SceneInterestGrid grid;
+	LocalVector<SceneInterestGrid::Change> changes;
+	grid.set_cell_size(100, changes);
+	const ObjectID a = ObjectID(uint64_t(1));
+	const ObjectID b = ObjectID(uint64_t(2));
+	grid.update_entity(a, Vector3(1, 1, 1), changes);
+	grid.update_entity(b, Vector3(80, 1, 1), changes);
+	grid.set_peer(2, Vector3(0, 0, 0), 10, changes);
+	CHECK_EQ(count_changes(changes, 2, true), 2); // Same cell.
+
+	changes.clear();
+	grid.set_cell_size(10, changes);
+	CHECK_EQ(changes.size(), 1u);
+	CHECK_EQ(changes[0].id, b);
+	CHECK_FALSE(changes[0].relevant);
+	CHECK(grid.is_relevant(a, 2));
+}
+
+TEST_CASE("[Multiplayer][SceneInterestGrid] Peers with huge radii only subscribe to used cells") {
+	SceneInterestGrid grid;
+	LocalVector<SceneInterestGrid::Change> changes;
+	grid.set_cell_size(10, changes);
+	const ObjectID a = ObjectID(uint64_t(1));
+	const ObjectID b = ObjectID(uint64_t(2));
+	grid.update_entity(a, Vector3(5, 5, 5), changes);
+
+	// Visiting every cell of this sphere would never finish.
+	grid.set_peer(2, Vector3(0, 0, 0), 1e9, changes);
+	CHECK_EQ(count_changes(changes, 2, true), 1);
+	CHECK(grid.is_relevant(a, 2));
+
+	// Cells created later are subscribed to when they are inside the sphere.
+	changes.clear();
+	grid.update_entity(b, Vector3(-50000, 20000, 3000), changes);
+	CHECK_EQ(count_changes(changes, 2, true), 1);
+	CHECK(grid.is_relevant(b, 2));
+	changes.clear();
+	grid.update_entity(a, Vector3(70000, 5, 5), changes);
+	CHECK(changes.is_empty());
+	CHECK(grid.is_relevant(a, 2));
+
+	// Cells are only created once entities enter them, for narrow and wide peers alike.
+	changes.clear();
+	const ObjectID c = ObjectID(uint64_t(3));
+	grid.set_peer(3, Vector3(1000, 0, 0), 15, changes);
+	CHECK(changes.is_empty());
+	grid.update_entity(c, Vector3(1012, 5, 5), changes);
+	CHECK_EQ(count_changes(changes, 2, true), 1);
+	CHECK_EQ(count_changes(changes, 3, true), 1);
+	CHECK(grid.is_relevant(c, 2));
+	CHECK(grid.is_relevant(c, 3));
+	changes.clear();
+	grid.remove_entity(c, changes);
+	grid.remove_peer(3, changes);
+	CHECK_EQ(count_changes(changes, 2, false), 1);
+	CHECK_EQ(count_changes(changes, 3, false), 1);
+
+	// Shrinking the radius goes back to regular subscriptions.
+	changes.clear();
+	grid.set_peer(2, Vector3(70000, 0, 0), 15, changes);
+	CHECK_EQ(count_changes(changes, 2, false), 1);
+	CHECK(grid.is_relevant(a, 2));
+	CHECK_FALSE(grid.is_relevant(b, 2));
+	changes.clear();
+	grid.update_entity(b, Vector3(-60000, 0, 0), changes);
+	CHECK(changes.is_empty());
+
+	changes.clear();
+	grid.remove_peer(2, changes);
+	CHECK_EQ(count_changes(changes, 2, false), 1);
+}
+
+} // namespace TestSceneInterestGrid
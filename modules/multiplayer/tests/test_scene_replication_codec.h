@@ -0,0 +1,209 @@
+/**************************************************************************/
+/*  test_scene_replication_codec.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "tests/test_macros.h"
+
+#include "../scene_replication_codec.h"
+
+namespace TestSceneReplicationCodec {
+
+typedef SceneReplicationCodec::Quantization Quantization;
+
+static Vector<Variant> round_trip(const Vector<Variant> &p_state, const Vector<Variant> *p_baseline, const LocalVector<Quantization> &p_quantization, int *r_size = nullptr) {
+	SceneReplicationCodec::BitWriter writer;
+	Vector<Variant> state = p_state;
+	SceneReplicationCodec::quantize_state(state, p_quantization);
+	CHECK_EQ(SceneReplicationCodec::encode_state(writer, state, p_baseline, p_quantization), OK);
+	if (r_size) {
+		*r_size = writer.get_size();
+	}
+	SceneReplicationCodec::BitReader reader(writer.get_data(), writer.get_size());
+	Vector<Variant> out;
+	out.resize(p_state.size());
+	CHECK_EQ(SceneReplicationCodec::decode_state(reader, out, p_baseline, p_quantization), OK);
+	CHECK_EQ(out, state);
+	return out;
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationCodec] Bit packing") {
+	SceneReplicationCodec::BitWriter writer;
+	writer.write(5, 3);
+	writer.write_bit(true);
+	writer.write(0xDEADBEEFCAFEBABE, 64);
+	writer.write_varint(0);
+	writer.write_varint(1234567);
+	writer.write_signed(-3);
+	writer.write_signed(INT64_MIN);
+
+	SceneReplicationCodec::BitReader reader(writer.get_data(), writer.get_size());
+	CHECK_EQ(reader.read(3), 5u);
+	CHECK(reader.read_bit());
+	CHECK_EQ(reader.read(64), 0xDEADBEEFCAFEBABE);
+	CHECK_EQ(reader.read_varint(), 0u);
+	CHECK_EQ(reader.read_varint(), 1234567u);
+	CHECK_EQ(reader.read_signed(), -3);
+	CHECK_EQ(reader.read_signed(), INT64_MIN);
+	CHECK_FALSE(reader.has_error());
+
+	reader.read(64);
+	CHECK(reader.has_error());
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationCodec] Lossless round trip") {
+	Vector<Variant> state = { Variant(), true, 42, -1.5, Vector2(1.25, -3), Vector3(0.1, 0.2, 0.3), Vector3i(-7, 8, 9), Quaternion(0, 0.7071068, 0, 0.7071068), Color(0.5, 0.25, 1, 1), "hello", StringName("name"), PackedInt32Array({ 1, 2, 3 }) };
+	LocalVector<Quantization> quantization;
+
+	Vector<Variant> keyframe = round_trip(state, nullptr, quantization);
+
+	// Small changes against the baseline.
+	Vector<Variant> next = state;
+	next.write[2] = 43;
+	next.write[4] = Vector2(1.3, -3);
+	next.write[5] = Vector3(0.1, 0.2, 0.35);
+	next.write[9] = "world";
+	round_trip(next, &keyframe, quantization);
+
+	// Type changes.
+	next.write[0] = 7;
+	next.write[3] = "not a float";
+	round_trip(next, &keyframe, quantization);
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationCodec] Quantization") {
+	LocalVector<Quantization> quantization;
+	quantization.resize(3);
+	quantization[0].step = 0.01;
+	quantization[1].step = 0.01;
+	quantization[1].range = 100;
+	// Third property stays lossless.
+
+	const Variant quantized = SceneReplicationCodec::quantize(Vector3(1.234, -5.678, 200), quantization[1]);
+	CHECK(Vector3(quantized).is_equal_approx(Vector3(1.23, -5.68, 100)));
+	CHECK_EQ(SceneReplicationCodec::quantize("text", quantization[1]), Variant("text"));
+	CHECK_EQ(SceneReplicationCodec::quantize(3.14159, Quantization()), Variant(3.14159));
+
+	Vector<Variant> state = { 12.345, Vector3(1.234, -5.678, 200), 0.1 };
+	Vector<Variant> keyframe = round_trip(state, nullptr, quantization);
+	CHECK(Math::is_equal_approx(double(keyframe[0]), 12.35));
+	CHECK_EQ(keyframe[2], Variant(0.1));
+
+	state.write[1] = Vector3(1.244, -5.678, -250);
+	Vector<Variant> delta = round_trip(state, &keyframe, quantization);
+	CHECK(Vector3(delta[1]).is_equal_approx(Vector3(1.24, -5.68, -100)));
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationCodec] Deltas are smaller than full states") {
+	LocalVector<Quantization> quantization;
+	quantization.resize(2);
+	quantization[0].step = 0.001;
+	quantization[0].range = 1000;
+
+	Vector<Variant> state = { Vector3(10, 2, -30), Quaternion(0, 0.7071068, 0, 0.7071068) };
+	int full_size = 0;
+	Vector<Variant> baseline = round_trip(state, nullptr, quantization, &full_size);
+
+	int same_size = 0;
+	round_trip(state, &baseline, quantization, &same_size);
+	CHECK_EQ(same_size, 1); // One bit per unchanged property.
+
+	state.write[0] = Vector3(10.01, 2, -30);
+	int delta_size = 0;
+	round_trip(state, &baseline, quantization, &delta_size);
+	CHECK_LT(delta_size, full_size / 2);
+}
+
+// Values are lossless, so the receiver sees them unchanged and ends up with the same baseline as the sender.
+static void send_delta(const List<Variant> &p_values, uint64_t p_indexes, LocalVector<Variant> &r_sent, LocalVector<Variant> &r_received) {
+	const LocalVector<Quantization> quantization;
+	SceneReplicationCodec::BitWriter writer;
+	CHECK_EQ(SceneReplicationCodec::encode_delta(writer, p_values, p_indexes, r_sent, quantization), OK);
+	SceneReplicationCodec::BitReader reader(writer.get_data(), writer.get_size());
+	Vector<Variant> out;
+	out.resize(p_values.size());
+	CHECK_EQ(SceneReplicationCodec::decode_delta(reader, out, p_indexes, r_received, quantization), OK);
+
+	int i = 0;
+	for (const Variant &value : p_values) {
+		CHECK_EQ(out[i], value);
+		i++;
+	}
+	REQUIRE_EQ(r_received.size(), r_sent.size());
+	for (uint32_t j = 0; j < r_sent.size(); j++) {
+		CHECK_EQ(r_received[j], r_sent[j]);
+	}
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationCodec] Deltas after the sender drops its baseline") {
+	LocalVector<Variant> sent;
+	LocalVector<Variant> received;
+
+	send_delta({ 5, Vector3(1, 2, 3) }, 0b11, sent, received);
+	send_delta({ 6 }, 0b01, sent, received);
+
+	// Hidden from the receiver, which keeps its values while the sender drops its own.
+	sent.clear();
+
+	// Changed while hidden, then shown again. A null value is only sent as "same type as the baseline",
+	// so the receiver must not decode it against its stale one.
+	send_delta({ Variant(), Vector3(4, 5, 6) }, 0b11, sent, received);
+	send_delta({ 7 }, 0b01, sent, received);
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationCodec] Malformed data") {
+	LocalVector<Quantization> quantization;
+	Vector<Variant> state = { Vector3(1, 2, 3), "text" };
+	SceneReplicationCodec::BitWriter writer;
+	CHECK_EQ(SceneReplicationCodec::encode_state(writer, state, nullptr, quantization), OK);
+
+	// Truncated.
+	ERR_PRINT_OFF;
+	SceneReplicationCodec::BitReader reader(writer.get_data(), writer.get_size() / 2);
+	Vector<Variant> out;
+	out.resize(state.size());
+	CHECK_NE(SceneReplicationCodec::decode_state(reader, out, nullptr, quantization), OK);
+
+	// Generic value lengths that would overflow when converted to bits, or exceed the data left.
+	const uint64_t lengths[] = { 1ULL << 61, UINT64_MAX, 1 << 30, 64 };
+	for (uint64_t len : lengths) {
+		SceneReplicationCodec::BitWriter bad;
+		bad.write_bit(false); // No baseline.
+		bad.write(Variant::STRING, 6);
+		bad.write_varint(len);
+		bad.write(0, 32);
+		SceneReplicationCodec::BitReader bad_reader(bad.get_data(), bad.get_size());
+		Variant value;
+		CHECK_EQ(SceneReplicationCodec::decode_value(bad_reader, value, Variant(), Quantization()), ERR_INVALID_DATA);
+	}
+	ERR_PRINT_ON;
+}
+
+} // namespace TestSceneReplicationCodec
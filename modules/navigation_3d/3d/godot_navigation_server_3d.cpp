@@ -1226,6 +1226,11 @@ COMMAND_1(free, RID, p_object) {
 			active_maps.remove_at(map_index);
 			active_maps_iteration_id.remove_at(map_index);
 		}
+
+		// Pending path query batches may still read from this map. Their callbacks are left to the next
+		// process step, so they don't run while the map is being freed.
+		_process_path_query_batches(true);
+
 		map_owner.free(p_object);
 
 	} else if (region_owner.owns(p_object)) {
@@ -1343,6 +1348,9 @@ void GodotNavigationServer3D::sync() {
 void GodotNavigationServer3D::process(real_t p_delta_time) {
 	flush_queries();
 
+	_process_path_query_batches(false);
+	_emit_path_query_callbacks();
+
 	if (!active) {
 		return;
 	}
@@ -1402,6 +1410,8 @@ void GodotNavigationServer3D::init() {
 
 void GodotNavigationServer3D::finish() {
 	flush_queries();
+	_process_path_query_batches(true);
+	_emit_path_query_callbacks();
 	if (navmesh_generator_3d) {
 		navmesh_generator_3d->finish();
 		memdelete(navmesh_generator_3d);
@@ -1419,6 +1429,114 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+bool GodotNavigationServer3D::_path_query_batch_fill(NavMeshQueries3D::NavMeshPathQueryBatch3D &r_batch, const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback) const {
+	ERR_FAIL_COND_V_MSG(p_query_parameters.size() != p_query_results.size(), false, "Path query batch needs exactly one result for each query parameters.");
+
+	r_batch.query_tasks.resize(p_query_parameters.size());
+	for (uint32_t i = 0; i < r_batch.query_tasks.size(); i++) {
+		Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		Ref<NavigationPathQueryResult3D> query_result = p_query_results[i];
+		ERR_FAIL_COND_V(query_parameters.is_null(), false);
+		ERR_FAIL_COND_V(query_result.is_null(), false);
+
+		NavMap3D *map = map_owner.get_or_null(query_parameters->get_map());
+		ERR_FAIL_NULL_V(map, false);
+
+		NavMeshQueries3D::NavMeshPathQueryTask3D &query_task = r_batch.query_tasks[i];
+		NavMeshQueries3D::query_task_set_parameters(query_task, query_parameters);
+		query_task.map = map;
+		query_task.query_result = query_result;
+	}
+	r_batch.callback = p_callback;
+
+	return true;
+}
+
+void GodotNavigationServer3D::query_path_batch(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback) {
+	NavMeshQueries3D::NavMeshPathQueryBatch3D batch;
+	if (!_path_query_batch_fill(batch, p_query_parameters, p_query_results, p_callback)) {
+		return;
+	}
+
+	NavMeshQueries3D::path_query_batch_start(batch);
+	NavMeshQueries3D::path_query_batch_finish(batch);
+
+	if (batch.callback.is_valid()) {
+		NavMeshQueries3D::emit_callback(batch.callback);
+	}
+}
+
+int64_t GodotNavigationServer3D::query_path_batch_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback) {
+	NavMeshQueries3D::NavMeshPathQueryBatch3D *batch = memnew(NavMeshQueries3D::NavMeshPathQueryBatch3D);
+	if (!_path_query_batch_fill(*batch, p_query_parameters, p_query_results, p_callback)) {
+		memdelete(batch);
+		return -1;
+	}
+
+	NavMeshQueries3D::path_query_batch_start(*batch);
+
+	MutexLock lock(path_query_batches_mutex);
+	const int64_t batch_id = ++path_query_batch_last_id;
+	path_query_batches.insert(batch_id, batch);
+	return batch_id;
+}
+
+bool GodotNavigationServer3D::query_path_batch_is_finished(int64_t p_batch_id) const {
+	MutexLock lock(path_query_batches_mutex);
+	NavMeshQueries3D::NavMeshPathQueryBatch3D *const *batch = path_query_batches.getptr(p_batch_id);
+	if (batch == nullptr) {
+		return true;
+	}
+	return NavMeshQueries3D::path_query_batch_is_finished(**batch);
+}
+
+void GodotNavigationServer3D::_process_path_query_batches(bool p_wait) {
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryBatch3D *> finished_batches;
+	{
+		MutexLock lock(path_query_batches_mutex);
+		LocalVector<int64_t> finished_batch_ids;
+		for (const KeyValue<int64_t, NavMeshQueries3D::NavMeshPathQueryBatch3D *> &E : path_query_batches) {
+			if (p_wait || NavMeshQueries3D::path_query_batch_is_finished(*E.value)) {
+				finished_batch_ids.push_back(E.key);
+				finished_batches.push_back(E.value);
+			}
+		}
+		for (const int64_t batch_id : finished_batch_ids) {
+			path_query_batches.erase(batch_id);
+		}
+	}
+
+	LocalVector<Callable> callbacks;
+	for (NavMeshQueries3D::NavMeshPathQueryBatch3D *batch : finished_batches) {
+		NavMeshQueries3D::path_query_batch_finish(*batch);
+		if (batch->callback.is_valid()) {
+			callbacks.push_back(batch->callback);
+		}
+		memdelete(batch);
+	}
+
+	if (!callbacks.is_empty()) {
+		MutexLock lock(path_query_batches_mutex);
+		for (const Callable &callback : callbacks) {
+			path_query_callbacks.push_back(callback);
+		}
+	}
+}
+
+void GodotNavigationServer3D::_emit_path_query_callbacks() {
+	LocalVector<Callable> callbacks;
+	{
+		MutexLock lock(path_query_batches_mutex);
+		callbacks = path_query_callbacks;
+		path_query_callbacks.clear();
+	}
+
+	// Callbacks are emitted outside the lock so they can start new batches.
+	for (const Callable &callback : callbacks) {
+		NavMeshQueries3D::emit_callback(callback);
+	}
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
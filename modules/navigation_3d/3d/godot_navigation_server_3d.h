@@ -35,6 +35,7 @@
 #include "../nav_map_3d.h"
 #include "../nav_obstacle_3d.h"
 #include "../nav_region_3d.h"
+#include "nav_mesh_queries_3d.h"
 
 #include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
@@ -83,6 +84,16 @@ class GodotNavigationServer3D : public NavigationServer3D {
 
 	NavMeshGenerator3D *navmesh_generator_3d = nullptr;
 
+	/// Path query batches started with `query_path_batch_async()` that are not yet finished.
+	Mutex path_query_batches_mutex;
+	HashMap<int64_t, NavMeshQueries3D::NavMeshPathQueryBatch3D *> path_query_batches;
+	int64_t path_query_batch_last_id = 0;
+	LocalVector<Callable> path_query_callbacks; // Of finished batches, emitted from `process()`.
+
+	bool _path_query_batch_fill(NavMeshQueries3D::NavMeshPathQueryBatch3D &r_batch, const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback) const;
+	void _process_path_query_batches(bool p_wait);
+	void _emit_path_query_callbacks();
+
 	// Performance Monitor
 	int pm_region_count = 0;
 	int pm_agent_count = 0;
@@ -286,6 +297,9 @@ public:
 	virtual void finish() override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual void query_path_batch(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback = Callable()) override;
+	virtual int64_t query_path_batch_async(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const Callable &p_callback = Callable()) override;
+	virtual bool query_path_batch_is_finished(int64_t p_batch_id) const override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
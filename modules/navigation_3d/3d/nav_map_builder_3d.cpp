@@ -86,16 +86,66 @@ void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild3D
 		region_external_connections[region.id] = LocalVector<Edge::Connection>();
 	}
 
+	// Any change to the map settings invalidates all cached region connections.
+	if (!r_build.region_caches_valid ||
+			r_build.region_caches_merge_rasterizer_cell_size != r_build.merge_rasterizer_cell_size ||
+			r_build.region_caches_use_edge_connections != r_build.use_edge_connections ||
+			r_build.region_caches_edge_connection_margin != r_build.edge_connection_margin) {
+		r_build.clear_region_caches();
+		r_build.region_caches_valid = true;
+		r_build.region_caches_merge_rasterizer_cell_size = r_build.merge_rasterizer_cell_size;
+		r_build.region_caches_use_edge_connections = r_build.use_edge_connections;
+		r_build.region_caches_edge_connection_margin = r_build.edge_connection_margin;
+	}
+
+	for (NavMapIterationBuild3D::RegionCache &region_cache : r_build.region_caches) {
+		region_cache.used = false;
+		region_cache.dirty = false;
+		region_cache.affected = false;
+		region_cache.region_iteration = nullptr;
+	}
+
 	// Copy all region polygons in the map.
 	int polygon_count = 0;
 	for (NavRegionIteration3D &region : regions) {
 		if (!region.get_enabled()) {
 			continue;
 		}
+
+		uint32_t region_cache_id;
+		HashMap<RID, uint32_t>::Iterator region_cache_id_it = r_build.region_cache_ids.find(region.get_self());
+		if (region_cache_id_it) {
+			region_cache_id = region_cache_id_it->value;
+		} else {
+			if (r_build.region_caches_unused.is_empty()) {
+				region_cache_id = r_build.region_caches.size();
+				r_build.region_caches.resize(region_cache_id + 1);
+			} else {
+				region_cache_id = r_build.region_caches_unused[r_build.region_caches_unused.size() - 1];
+				r_build.region_caches_unused.remove_at(r_build.region_caches_unused.size() - 1);
+			}
+			r_build.region_cache_ids.insert(region.get_self(), region_cache_id);
+		}
+
+		NavMapIterationBuild3D::RegionCache &region_cache = r_build.region_caches[region_cache_id];
+		if (!region_cache_id_it || region_cache.polygons_iteration_id != region.polygons_iteration_id) {
+			region_cache.region_rid = region.get_self();
+			region_cache.polygons_iteration_id = region.polygons_iteration_id;
+			region_cache.dirty = true;
+			_build_mark_region_cache_affected(r_build, region_cache_id);
+		}
+		region_cache.used = true;
+		region_cache.region_iteration = &region;
+
 		LocalVector<Polygon> &polygons_source = region.navmesh_polygons;
 		for (uint32_t n = 0; n < polygons_source.size(); n++) {
 			polygons_source[n].id = polygon_count;
 			polygon_count++;
+
+			// Polygons handed over from an older iteration still hold the connections of that iteration.
+			for (Edge &edge : polygons_source[n].edges) {
+				edge.connections.clear();
+			}
 		}
 	}
 
@@ -104,47 +154,70 @@ void NavMapBuilder3D::_build_step_gather_region_polygons(NavMapIterationBuild3D
 }
 
 void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
-	PerformanceData &performance_data = r_build.performance_data;
-	NavMapIteration3D *map_iteration = r_build.map_iteration;
-	int polygon_count = r_build.polygon_count;
+	HashMap<EdgeKey, NavMapIterationBuild3D::EdgeRefPair, EdgeKey> &edge_ref_pairs = r_build.edge_ref_pairs;
 
-	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
+	// Remove the edges of regions that changed or are no longer part of the map.
+	for (uint32_t region_cache_id = 0; region_cache_id < r_build.region_caches.size(); region_cache_id++) {
+		NavMapIterationBuild3D::RegionCache &region_cache = r_build.region_caches[region_cache_id];
+		if (region_cache.used && !region_cache.dirty) {
+			continue;
+		}
+
+		for (const EdgeKey &ek : region_cache.edge_keys) {
+			HashMap<EdgeKey, NavMapIterationBuild3D::EdgeRefPair, EdgeKey>::Iterator pair_it = edge_ref_pairs.find(ek);
+			if (!pair_it) {
+				continue;
+			}
+			NavMapIterationBuild3D::EdgeRefPair &pair = pair_it->value;
+			uint32_t kept = 0;
+			for (uint32_t i = 0; i < pair.size; i++) {
+				if (pair.edges[i].region != region_cache_id) {
+					pair.edges[kept++] = pair.edges[i];
+				}
+			}
+			pair.size = kept;
 
-	// Group all edges per key.
-	connection_pairs_map.clear();
-	connection_pairs_map.reserve(polygon_count);
-	int free_edges_count = 0; // How many ConnectionPairs have only one Connection.
+			if (pair.size == 0) {
+				edge_ref_pairs.remove(pair_it);
+			} else if (pair.size == 1) {
+				// The edge that stays behind is free again.
+				_build_mark_region_cache_affected(r_build, pair.edges[0].region);
+			}
+		}
+		region_cache.edge_keys.clear();
+	}
 
-	for (NavRegionIteration3D &region : map_iteration->region_iterations) {
-		if (!region.get_enabled()) {
+	// Group the edges of new and changed regions per key.
+	for (uint32_t region_cache_id = 0; region_cache_id < r_build.region_caches.size(); region_cache_id++) {
+		NavMapIterationBuild3D::RegionCache &region_cache = r_build.region_caches[region_cache_id];
+		if (!region_cache.used || !region_cache.dirty) {
 			continue;
 		}
 
-		for (Polygon &poly : region.navmesh_polygons) {
+		const LocalVector<Polygon> &polygons = region_cache.region_iteration->navmesh_polygons;
+		for (uint32_t poly_index = 0; poly_index < polygons.size(); poly_index++) {
+			const Polygon &poly = polygons[poly_index];
 			for (uint32_t p = 0; p < poly.points.size(); p++) {
 				const int next_point = (p + 1) % poly.points.size();
 				const EdgeKey ek(poly.points[p].key, poly.points[next_point].key);
+				region_cache.edge_keys.push_back(ek);
 
-				HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = connection_pairs_map.find(ek);
+				HashMap<EdgeKey, NavMapIterationBuild3D::EdgeRefPair, EdgeKey>::Iterator pair_it = edge_ref_pairs.find(ek);
 				if (!pair_it) {
-					pair_it = connection_pairs_map.insert(ek, EdgeConnectionPair());
-					performance_data.pm_edge_count += 1;
-					++free_edges_count;
+					pair_it = edge_ref_pairs.insert(ek, NavMapIterationBuild3D::EdgeRefPair());
 				}
-				EdgeConnectionPair &pair = pair_it->value;
+				NavMapIterationBuild3D::EdgeRefPair &pair = pair_it->value;
 				if (pair.size < 2) {
 					// Add the polygon/edge tuple to this key.
-					Edge::Connection new_connection;
-					new_connection.polygon = &poly;
-					new_connection.edge = p;
-					new_connection.pathway_start = poly.points[p].pos;
-					new_connection.pathway_end = poly.points[next_point].pos;
-
-					pair.connections[pair.size] = new_connection;
-					++pair.size;
-					if (pair.size == 2) {
-						--free_edges_count;
+					if (pair.size == 1) {
+						// The other edge is no longer free.
+						_build_mark_region_cache_affected(r_build, pair.edges[0].region);
 					}
+					NavMapIterationBuild3D::EdgeRef &edge_ref = pair.edges[pair.size];
+					edge_ref.region = region_cache_id;
+					edge_ref.polygon = poly_index;
+					edge_ref.edge = p;
+					++pair.size;
 
 				} else {
 					// The edge is already connected with another edge, skip.
@@ -154,37 +227,82 @@ void NavMapBuilder3D::_build_step_find_edge_connection_pairs(NavMapIterationBuil
 		}
 	}
 
-	r_build.free_edge_count = free_edges_count;
+	r_build.performance_data.pm_edge_count = edge_ref_pairs.size();
 }
 
 void NavMapBuilder3D::_build_step_merge_edge_connection_pairs(NavMapIterationBuild3D &r_build) {
 	PerformanceData &performance_data = r_build.performance_data;
 
-	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
-	LocalVector<Edge::Connection> &free_edges = r_build.iter_free_edges;
-	int free_edges_count = r_build.free_edge_count;
+	const HashMap<EdgeKey, NavMapIterationBuild3D::EdgeRefPair, EdgeKey> &edge_ref_pairs = r_build.edge_ref_pairs;
 	bool use_edge_connections = r_build.use_edge_connections;
 
-	free_edges.clear();
-	free_edges.reserve(free_edges_count);
-
-	for (const KeyValue<EdgeKey, EdgeConnectionPair> &pair_it : connection_pairs_map) {
-		const EdgeConnectionPair &pair = pair_it.value;
-		if (pair.size == 2) {
-			// Connect edge that are shared in different polygons.
-			const Edge::Connection &c1 = pair.connections[0];
-			const Edge::Connection &c2 = pair.connections[1];
-			c1.polygon->edges[c1.edge].connections.push_back(c2);
-			c2.polygon->edges[c2.edge].connections.push_back(c1);
-			// Note: The pathway_start/end are full for those connection and do not need to be modified.
-			performance_data.pm_edge_merge_count += 1;
-		} else {
-			CRASH_COND_MSG(pair.size != 1, vformat("Number of connection != 1. Found: %d", pair.size));
-			if (use_edge_connections && pair.connections[0].polygon->owner->get_use_edge_connections()) {
-				free_edges.push_back(pair.connections[0]);
+	// Only the regions whose edges were merged or freed need to look at their edge pairs again.
+	for (uint32_t region_cache_id : r_build.affected_region_caches) {
+		NavMapIterationBuild3D::RegionCache &region_cache = r_build.region_caches[region_cache_id];
+		if (!region_cache.used) {
+			continue;
+		}
+		region_cache.free_edges.clear();
+		region_cache.merged_connections.clear();
+
+		const NavRegionIteration3D &region = *region_cache.region_iteration;
+		const bool region_uses_edge_connections = use_edge_connections && region.get_use_edge_connections();
+
+		uint32_t edge_key_index = 0;
+		for (uint32_t poly_index = 0; poly_index < region.navmesh_polygons.size(); poly_index++) {
+			const Polygon &poly = region.navmesh_polygons[poly_index];
+			for (uint32_t p = 0; p < poly.points.size(); p++) {
+				const NavMapIterationBuild3D::EdgeRefPair *pair = edge_ref_pairs.getptr(region_cache.edge_keys[edge_key_index++]);
+				ERR_CONTINUE(pair == nullptr);
+
+				NavMapIterationBuild3D::EdgeRef edge_ref;
+				edge_ref.region = region_cache_id;
+				edge_ref.polygon = poly_index;
+				edge_ref.edge = p;
+
+				if (pair->size == 2) {
+					// Connect edge that are shared in different polygons.
+					NavMapIterationBuild3D::EdgeRefConnection connection;
+					if (pair->edges[0] == edge_ref) {
+						connection.to = pair->edges[1];
+					} else if (pair->edges[1] == edge_ref) {
+						connection.to = pair->edges[0];
+					} else {
+						// This edge was skipped as the key was already merged.
+						continue;
+					}
+					connection.from = edge_ref;
+
+					// Note: The pathway_start/end are full for those connection and do not need to be modified.
+					const Polygon &other_poly = _build_get_polygon(r_build, connection.to);
+					connection.pathway_start = other_poly.points[connection.to.edge].pos;
+					connection.pathway_end = other_poly.points[(connection.to.edge + 1) % other_poly.points.size()].pos;
+					region_cache.merged_connections.push_back(connection);
+				} else if (region_uses_edge_connections) {
+					region_cache.free_edges.push_back(edge_ref);
+				}
 			}
 		}
 	}
+
+	int merged_connection_count = 0;
+	for (const NavMapIterationBuild3D::RegionCache &region_cache : r_build.region_caches) {
+		if (!region_cache.used) {
+			continue;
+		}
+		for (const NavMapIterationBuild3D::EdgeRefConnection &connection : region_cache.merged_connections) {
+			Edge::Connection new_connection;
+			new_connection.polygon = &_build_get_polygon(r_build, connection.to);
+			new_connection.edge = connection.to.edge;
+			new_connection.pathway_start = connection.pathway_start;
+			new_connection.pathway_end = connection.pathway_end;
+			_build_get_polygon(r_build, connection.from).edges[connection.from.edge].connections.push_back(new_connection);
+		}
+		merged_connection_count += region_cache.merged_connections.size();
+	}
+
+	// Each merged edge pair has a connection in both directions.
+	performance_data.pm_edge_merge_count = merged_connection_count / 2;
 }
 
 void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build) {
@@ -192,7 +310,6 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
 	real_t edge_connection_margin = r_build.edge_connection_margin;
-	LocalVector<Edge::Connection> &free_edges = r_build.iter_free_edges;
 	HashMap<uint32_t, LocalVector<Edge::Connection>> &region_external_connections = map_iteration->external_region_connections;
 
 	// Find the compatible near edges.
@@ -202,23 +319,99 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 	// to be connected, create new polygons to remove that small gap is
 	// not really useful and would result in wasteful computation during
 	// connection, integration and path finding.
-	performance_data.pm_edge_free_count = free_edges.size();
-
-	const real_t edge_connection_margin_squared = edge_connection_margin * edge_connection_margin;
+	// Unchanged regions drop their connections to regions that changed or left the map.
+	for (NavMapIterationBuild3D::RegionCache &region_cache : r_build.region_caches) {
+		if (!region_cache.used || region_cache.affected || region_cache.margin_connections.is_empty()) {
+			continue;
+		}
+		uint32_t kept = 0;
+		for (uint32_t i = 0; i < region_cache.margin_connections.size(); i++) {
+			const NavMapIterationBuild3D::RegionCache &other_region_cache = r_build.region_caches[region_cache.margin_connections[i].to.region];
+			if (other_region_cache.used && !other_region_cache.affected) {
+				region_cache.margin_connections[kept++] = region_cache.margin_connections[i];
+			}
+		}
+		region_cache.margin_connections.resize(kept);
+	}
 
-	for (uint32_t i = 0; i < free_edges.size(); i++) {
-		const Edge::Connection &free_edge = free_edges[i];
-		Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
-		Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
+	// Connect the free edges of the changed regions with the other regions, in both directions.
+	for (uint32_t region_cache_id : r_build.affected_region_caches) {
+		NavMapIterationBuild3D::RegionCache &region_cache = r_build.region_caches[region_cache_id];
+		if (!region_cache.used) {
+			continue;
+		}
+		region_cache.margin_connections.clear();
 
-		for (uint32_t j = 0; j < free_edges.size(); j++) {
-			const Edge::Connection &other_edge = free_edges[j];
-			if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
+		for (uint32_t other_region_cache_id = 0; other_region_cache_id < r_build.region_caches.size(); other_region_cache_id++) {
+			NavMapIterationBuild3D::RegionCache &other_region_cache = r_build.region_caches[other_region_cache_id];
+			if (other_region_cache_id == region_cache_id || !other_region_cache.used) {
 				continue;
 			}
+			_build_connect_free_edges(r_build, region_cache, other_region_cache, edge_connection_margin);
+			if (!other_region_cache.affected) {
+				_build_connect_free_edges(r_build, other_region_cache, region_cache, edge_connection_margin);
+			}
+		}
+	}
+
+	int free_edge_count = 0;
+	int margin_connection_count = 0;
+	for (const NavMapIterationBuild3D::RegionCache &region_cache : r_build.region_caches) {
+		if (!region_cache.used) {
+			continue;
+		}
+		LocalVector<Edge::Connection> &external_connections = region_external_connections[region_cache.region_iteration->id];
+		for (const NavMapIterationBuild3D::EdgeRefConnection &connection : region_cache.margin_connections) {
+			// The edges can now be connected.
+			Edge::Connection new_connection;
+			new_connection.polygon = &_build_get_polygon(r_build, connection.to);
+			new_connection.edge = connection.to.edge;
+			new_connection.pathway_start = connection.pathway_start;
+			new_connection.pathway_end = connection.pathway_end;
+			_build_get_polygon(r_build, connection.from).edges[connection.from.edge].connections.push_back(new_connection);
+
+			// Add the connection to the region_connection map.
+			external_connections.push_back(new_connection);
+		}
+		free_edge_count += region_cache.free_edges.size();
+		margin_connection_count += region_cache.margin_connections.size();
+	}
+
+	performance_data.pm_edge_free_count = free_edge_count;
+	performance_data.pm_edge_connection_count = margin_connection_count;
+
+	// Regions that left the map are only kept until everything connected to them was removed.
+	for (uint32_t region_cache_id = 0; region_cache_id < r_build.region_caches.size(); region_cache_id++) {
+		NavMapIterationBuild3D::RegionCache &region_cache = r_build.region_caches[region_cache_id];
+		if (region_cache.used || !region_cache.region_rid.is_valid()) {
+			continue;
+		}
+		r_build.region_cache_ids.erase(region_cache.region_rid);
+		region_cache = NavMapIterationBuild3D::RegionCache();
+		r_build.region_caches_unused.push_back(region_cache_id);
+	}
+}
+
+void NavMapBuilder3D::_build_connect_free_edges(NavMapIterationBuild3D &r_build, NavMapIterationBuild3D::RegionCache &r_region_cache, const NavMapIterationBuild3D::RegionCache &p_other_region_cache, real_t p_edge_connection_margin) {
+	if (r_region_cache.free_edges.is_empty() || p_other_region_cache.free_edges.is_empty()) {
+		return;
+	}
+	const AABB region_bounds = r_region_cache.region_iteration->get_bounds().grow(p_edge_connection_margin);
+	if (!region_bounds.intersects_inclusive(p_other_region_cache.region_iteration->get_bounds())) {
+		return;
+	}
+
+	const real_t edge_connection_margin_squared = p_edge_connection_margin * p_edge_connection_margin;
 
-			Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
-			Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
+	for (const NavMapIterationBuild3D::EdgeRef &free_edge : r_region_cache.free_edges) {
+		const Polygon &free_edge_poly = _build_get_polygon(r_build, free_edge);
+		Vector3 edge_p1 = free_edge_poly.points[free_edge.edge].pos;
+		Vector3 edge_p2 = free_edge_poly.points[(free_edge.edge + 1) % free_edge_poly.points.size()].pos;
+
+		for (const NavMapIterationBuild3D::EdgeRef &other_edge : p_other_region_cache.free_edges) {
+			const Polygon &other_edge_poly = _build_get_polygon(r_build, other_edge);
+			Vector3 other_edge_p1 = other_edge_poly.points[other_edge.edge].pos;
+			Vector3 other_edge_p2 = other_edge_poly.points[(other_edge.edge + 1) % other_edge_poly.points.size()].pos;
 
 			// Compute the projection of the opposite edge on the current one
 			Vector3 edge_vector = edge_p2 - edge_p1;
@@ -251,19 +444,29 @@ void NavMapBuilder3D::_build_step_edge_connection_margin_connections(NavMapItera
 				continue;
 			}
 
-			// The edges can now be connected.
-			Edge::Connection new_connection = other_edge;
-			new_connection.pathway_start = (self1 + other1) / 2.0;
-			new_connection.pathway_end = (self2 + other2) / 2.0;
-			free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
-
-			// Add the connection to the region_connection map.
-			region_external_connections[(uint32_t)free_edge.polygon->owner->id].push_back(new_connection);
-			performance_data.pm_edge_connection_count += 1;
+			NavMapIterationBuild3D::EdgeRefConnection connection;
+			connection.from = free_edge;
+			connection.to = other_edge;
+			connection.pathway_start = (self1 + other1) / 2.0;
+			connection.pathway_end = (self2 + other2) / 2.0;
+			r_region_cache.margin_connections.push_back(connection);
 		}
 	}
 }
 
+void NavMapBuilder3D::_build_mark_region_cache_affected(NavMapIterationBuild3D &r_build, uint32_t p_region_cache_id) {
+	NavMapIterationBuild3D::RegionCache &region_cache = r_build.region_caches[p_region_cache_id];
+	if (region_cache.affected) {
+		return;
+	}
+	region_cache.affected = true;
+	r_build.affected_region_caches.push_back(p_region_cache_id);
+}
+
+Polygon &NavMapBuilder3D::_build_get_polygon(const NavMapIterationBuild3D &p_build, const NavMapIterationBuild3D::EdgeRef &p_edge_ref) {
+	return p_build.region_caches[p_edge_ref.region].region_iteration->navmesh_polygons[p_edge_ref.polygon];
+}
+
 void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -401,6 +604,10 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_buil
 		p_path_query_slot.traversable_polys.reserve(map_iteration->navmesh_polygon_count * 0.25);
 		p_path_query_slot.path_corridor.clear();
 		p_path_query_slot.path_corridor.resize(map_iteration->navmesh_polygon_count + map_iteration->link_polygon_count);
+		for (NavigationPoly &polygon : p_path_query_slot.path_corridor) {
+			polygon.reset();
+		}
+		p_path_query_slot.touched_poly_ids.clear();
 	}
 	map_iteration->path_query_slots_mutex.unlock();
 }
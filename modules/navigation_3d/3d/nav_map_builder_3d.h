@@ -31,8 +31,7 @@
 #pragma once
 
 #include "../nav_utils_3d.h"
-
-struct NavMapIterationBuild3D;
+#include "nav_map_iteration_3d.h"
 
 class NavMapBuilder3D {
 	static void _build_step_gather_region_polygons(NavMapIterationBuild3D &r_build);
@@ -42,6 +41,10 @@ class NavMapBuilder3D {
 	static void _build_step_navlink_connections(NavMapIterationBuild3D &r_build);
 	static void _build_update_map_iteration(NavMapIterationBuild3D &r_build);
 
+	static void _build_connect_free_edges(NavMapIterationBuild3D &r_build, NavMapIterationBuild3D::RegionCache &r_region_cache, const NavMapIterationBuild3D::RegionCache &p_other_region_cache, real_t p_edge_connection_margin);
+	static void _build_mark_region_cache_affected(NavMapIterationBuild3D &r_build, uint32_t p_region_cache_id);
+	static Nav3D::Polygon &_build_get_polygon(const NavMapIterationBuild3D &p_build, const NavMapIterationBuild3D::EdgeRef &p_edge_ref);
+
 public:
 	static Nav3D::PointKey get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size);
 
@@ -43,16 +43,66 @@ struct NavRegionIteration3D;
 struct NavMapIteration3D;
 
 struct NavMapIterationBuild3D {
+	/// A polygon edge of a region that stays valid between builds.
+	/// `region` is the index of the region in `region_caches`.
+	struct EdgeRef {
+		uint32_t region = 0;
+		uint32_t polygon = 0;
+		uint32_t edge = 0;
+
+		bool operator==(const EdgeRef &p_other) const {
+			return region == p_other.region && polygon == p_other.polygon && edge == p_other.edge;
+		}
+	};
+
+	struct EdgeRefPair {
+		EdgeRef edges[2];
+		uint32_t size = 0;
+	};
+
+	struct EdgeRefConnection {
+		EdgeRef from;
+		EdgeRef to;
+		Vector3 pathway_start;
+		Vector3 pathway_end;
+	};
+
+	/// The connections of a region, kept between builds until the region polygons change.
+	struct RegionCache {
+		RID region_rid;
+		uint32_t polygons_iteration_id = 0;
+		NavRegionIteration3D *region_iteration = nullptr;
+
+		bool used = false;
+		bool dirty = false;
+		bool affected = false;
+
+		/// Edge keys of all polygon edges, in polygon and edge order.
+		LocalVector<Nav3D::EdgeKey> edge_keys;
+		LocalVector<EdgeRef> free_edges;
+		LocalVector<EdgeRefConnection> merged_connections;
+		LocalVector<EdgeRefConnection> margin_connections;
+	};
+
 	Vector3 merge_rasterizer_cell_size;
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
 	Nav3D::PerformanceData performance_data;
 	int polygon_count = 0;
-	int free_edge_count = 0;
 
-	HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> iter_connection_pairs_map;
-	LocalVector<Nav3D::Edge::Connection> iter_free_edges;
+	// Persistent between builds so only regions that changed need to be reconnected.
+	LocalVector<RegionCache> region_caches;
+	LocalVector<uint32_t> region_caches_unused;
+	HashMap<RID, uint32_t> region_cache_ids;
+	HashMap<Nav3D::EdgeKey, EdgeRefPair, Nav3D::EdgeKey> edge_ref_pairs;
+	LocalVector<uint32_t> affected_region_caches;
+
+	// The map settings used by the cached connections, changing any of them reconnects all regions.
+	bool region_caches_valid = false;
+	Vector3 region_caches_merge_rasterizer_cell_size;
+	bool region_caches_use_edge_connections = true;
+	real_t region_caches_edge_connection_margin = 0.0;
 
 	NavMapIteration3D *map_iteration = nullptr;
 
@@ -62,14 +112,21 @@ struct NavMapIterationBuild3D {
 	void reset() {
 		performance_data.reset();
 
-		iter_connection_pairs_map.clear();
-		iter_free_edges.clear();
+		affected_region_caches.clear();
 		polygon_count = 0;
-		free_edge_count = 0;
 
 		navmesh_polygon_count = 0;
 		link_polygon_count = 0;
 	}
+
+	void clear_region_caches() {
+		region_caches.clear();
+		region_caches_unused.clear();
+		region_cache_ids.clear();
+		edge_ref_pairs.clear();
+		affected_region_caches.clear();
+		region_caches_valid = false;
+	}
 };
 
 struct NavMapIteration3D {
@@ -150,82 +150,195 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	ERR_FAIL_COND(p_query_parameters.is_null());
 	ERR_FAIL_COND(p_query_result.is_null());
 
-	using namespace NavigationUtilities;
-
 	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
-	query_task.start_position = p_query_parameters->get_start_position();
-	query_task.target_position = p_query_parameters->get_target_position();
-	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
+	query_task_set_parameters(query_task, p_query_parameters);
+	query_task.query_result = p_query_result;
 	query_task.callback = p_callback;
 
+	map->query_path(query_task);
+
+	query_task_set_result(query_task);
+
+	if (query_task.callback.is_valid()) {
+		if (emit_callback(query_task.callback)) {
+			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
+		} else {
+			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
+		}
+	}
+}
+
+void NavMeshQueries3D::query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters) {
+	using namespace NavigationUtilities;
+
+	p_query_task.start_position = p_query_parameters->get_start_position();
+	p_query_task.target_position = p_query_parameters->get_target_position();
+	p_query_task.navigation_layers = p_query_parameters->get_navigation_layers();
+
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
 
 	uint32_t _excluded_region_count = _excluded_regions.size();
 	uint32_t _included_region_count = _included_regions.size();
 
-	query_task.exclude_regions = _excluded_region_count > 0;
-	query_task.include_regions = _included_region_count > 0;
+	p_query_task.exclude_regions = _excluded_region_count > 0;
+	p_query_task.include_regions = _included_region_count > 0;
 
-	if (query_task.exclude_regions) {
-		query_task.excluded_regions.resize(_excluded_region_count);
+	if (p_query_task.exclude_regions) {
+		p_query_task.excluded_regions.resize(_excluded_region_count);
 		for (uint32_t i = 0; i < _excluded_region_count; i++) {
-			query_task.excluded_regions[i] = _excluded_regions[i];
+			p_query_task.excluded_regions[i] = _excluded_regions[i];
 		}
 	}
 
-	if (query_task.include_regions) {
-		query_task.included_regions.resize(_included_region_count);
+	if (p_query_task.include_regions) {
+		p_query_task.included_regions.resize(_included_region_count);
 		for (uint32_t i = 0; i < _included_region_count; i++) {
-			query_task.included_regions[i] = _included_regions[i];
+			p_query_task.included_regions[i] = _included_regions[i];
 		}
 	}
 
 	switch (p_query_parameters->get_pathfinding_algorithm()) {
 		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			p_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			p_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 	}
 
 	switch (p_query_parameters->get_path_postprocessing()) {
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_NONE: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathPostProcessing - fallback to default");
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			p_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 	}
 
-	query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
-	query_task.simplify_path = p_query_parameters->get_simplify_path();
-	query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
-	query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+	p_query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
+	p_query_task.simplify_path = p_query_parameters->get_simplify_path();
+	p_query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+	p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+}
 
-	map->query_path(query_task);
+void NavMeshQueries3D::query_task_set_result(const NavMeshPathQueryTask3D &p_query_task) {
+	p_query_task.query_result->set_data(
+			p_query_task.path_points,
+			p_query_task.path_meta_point_types,
+			p_query_task.path_meta_point_rids,
+			p_query_task.path_meta_point_owners);
+}
 
-	p_query_result->set_data(
-			query_task.path_points,
-			query_task.path_meta_point_types,
-			query_task.path_meta_point_rids,
-			query_task.path_meta_point_owners);
+void NavMeshQueries3D::map_iteration_query_paths(NavMapIteration3D &p_map_iteration, NavMeshPathQueryTask3D *p_query_tasks, uint32_t p_query_task_count) {
+	// A single slot serves all the queries, so its scratch buffers are only acquired once.
+	PathQuerySlot *path_query_slot = nullptr;
 
-	if (query_task.callback.is_valid()) {
-		if (emit_callback(query_task.callback)) {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
-		} else {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
+	p_map_iteration.path_query_slots_semaphore.wait();
+
+	p_map_iteration.path_query_slots_mutex.lock();
+	for (PathQuerySlot &p_path_query_slot : p_map_iteration.path_query_slots) {
+		if (!p_path_query_slot.in_use) {
+			p_path_query_slot.in_use = true;
+			path_query_slot = &p_path_query_slot;
+			break;
+		}
+	}
+	p_map_iteration.path_query_slots_mutex.unlock();
+
+	if (path_query_slot == nullptr) {
+		p_map_iteration.path_query_slots_semaphore.post();
+		ERR_FAIL_NULL_MSG(path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+	}
+
+	for (uint32_t i = 0; i < p_query_task_count; i++) {
+		NavMeshPathQueryTask3D &query_task = p_query_tasks[i];
+		query_task.path_query_slot = path_query_slot;
+		query_task.map_up = p_map_iteration.map_up;
+
+		query_task_map_iteration_get_path(query_task, p_map_iteration);
+
+		query_task.path_query_slot = nullptr;
+	}
+
+	p_map_iteration.path_query_slots_mutex.lock();
+	path_query_slot->in_use = false;
+	p_map_iteration.path_query_slots_mutex.unlock();
+
+	p_map_iteration.path_query_slots_semaphore.post();
+}
+
+void NavMeshQueries3D::path_query_batch_start(NavMeshPathQueryBatch3D &p_batch) {
+	for (NavMeshPathQueryTask3D &query_task : p_batch.query_tasks) {
+		int64_t map_index = p_batch.maps.find(query_task.map);
+		if (map_index < 0) {
+			map_index = p_batch.maps.size();
+			p_batch.maps.push_back(query_task.map);
+			p_batch.map_iterations.push_back(query_task.map->acquire_path_query_iteration());
+		}
+		query_task.map_iteration = p_batch.map_iterations[map_index];
+	}
+
+	if (p_batch.query_tasks.is_empty()) {
+		return;
+	}
+
+	p_batch.group_task_id = WorkerThreadPool::get_singleton()->add_native_group_range_task(&NavMeshQueries3D::_path_query_batch_process_range, &p_batch, p_batch.query_tasks.size(), -1, 1, true, SNAME("NavMeshPathQueryBatch3D"));
+}
+
+bool NavMeshQueries3D::path_query_batch_is_finished(const NavMeshPathQueryBatch3D &p_batch) {
+	if (p_batch.group_task_id == WorkerThreadPool::INVALID_TASK_ID) {
+		return true;
+	}
+	return WorkerThreadPool::get_singleton()->is_group_task_completed(p_batch.group_task_id);
+}
+
+void NavMeshQueries3D::path_query_batch_finish(NavMeshPathQueryBatch3D &p_batch) {
+	if (p_batch.group_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(p_batch.group_task_id);
+		p_batch.group_task_id = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	for (uint32_t i = 0; i < p_batch.maps.size(); i++) {
+		p_batch.maps[i]->release_path_query_iteration(p_batch.map_iterations[i]);
+	}
+	p_batch.maps.clear();
+	p_batch.map_iterations.clear();
+
+	// Results are only written here, on the thread finishing the batch, since the same result object
+	// may be used by several queries of the batch.
+	for (const NavMeshPathQueryTask3D &query_task : p_batch.query_tasks) {
+		query_task_set_result(query_task);
+	}
+}
+
+void NavMeshQueries3D::_path_query_batch_process_range(void *p_userdata, uint32_t p_begin, uint32_t p_end) {
+	NavMeshPathQueryBatch3D *batch = static_cast<NavMeshPathQueryBatch3D *>(p_userdata);
+
+	uint32_t run_begin = p_begin;
+	while (run_begin < p_end) {
+		// Consecutive queries on the same map share the iteration lock and the query slot.
+		NavMapIteration3D *map_iteration = batch->query_tasks[run_begin].map_iteration;
+		uint32_t run_end = run_begin + 1;
+		while (run_end < p_end && batch->query_tasks[run_end].map_iteration == map_iteration) {
+			run_end++;
 		}
+
+		// Maps without any iteration yet give empty paths, as in NavMap3D::query_path().
+		if (map_iteration) {
+			NavMapIterationRead3D iteration_read_lock(*map_iteration);
+			map_iteration_query_paths(*map_iteration, &batch->query_tasks[run_begin], run_end - run_begin);
+		}
+
+		run_begin = run_end;
 	}
 }
 
@@ -290,10 +403,13 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 			&traversable_polys = p_query_task.path_query_slot->traversable_polys;
 	traversable_polys.clear();
 
+	// Only reset what the previous query on this slot touched, instead of the whole corridor.
 	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
-	for (NavigationPoly &polygon : navigation_polys) {
-		polygon.reset();
+	LocalVector<uint32_t> &touched_poly_ids = p_query_task.path_query_slot->touched_poly_ids;
+	for (uint32_t poly_id : touched_poly_ids) {
+		navigation_polys[poly_id].reset();
 	}
+	touched_poly_ids.clear();
 
 	// Initialize the matching navigation polygon.
 	NavigationPoly &begin_navigation_poly = navigation_polys[begin_poly->id];
@@ -302,6 +418,7 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	begin_navigation_poly.back_navigation_edge_pathway_start = begin_point;
 	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
 	begin_navigation_poly.traveled_distance = 0.f;
+	touched_poly_ids.push_back(begin_poly->id);
 
 	// This is an implementation of the A* algorithm.
 	uint32_t least_cost_id = begin_poly->id;
@@ -351,6 +468,7 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 					} else {
 						neighbor_poly.poly = connection.polygon;
 						traversable_polys.push(&neighbor_poly);
+						touched_poly_ids.push_back(connection.polygon->id);
 					}
 				}
 			}
@@ -32,6 +32,7 @@
 
 #include "../nav_utils_3d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "servers/navigation/navigation_path_query_parameters_3d.h"
 #include "servers/navigation/navigation_path_query_result_3d.h"
 #include "servers/navigation/navigation_utilities.h"
@@ -46,6 +47,8 @@ public:
 	struct PathQuerySlot {
 		LocalVector<Nav3D::NavigationPoly> path_corridor;
 		Heap<Nav3D::NavigationPoly *, Nav3D::NavPolyTravelCostGreaterThan, Nav3D::NavPolyHeapIndexer> traversable_polys;
+		// Polygons of the corridor touched by the last query, the only ones the next query has to reset.
+		LocalVector<uint32_t> touched_poly_ids;
 		bool in_use = false;
 		uint32_t slot_index = 0;
 	};
@@ -83,6 +86,7 @@ public:
 		// Map.
 		Vector3 map_up;
 		NavMap3D *map = nullptr;
+		NavMapIteration3D *map_iteration = nullptr;
 		PathQuerySlot *path_query_slot = nullptr;
 
 		// Path points.
@@ -111,6 +115,17 @@ public:
 		}
 	};
 
+	// Path queries run together on the WorkerThreadPool. Each map iteration used by the batch
+	// stays pinned until the batch is finished, so all queries see the same map state.
+	// The result objects are only written when finishing, and emitting the callback is left to the caller.
+	struct NavMeshPathQueryBatch3D {
+		LocalVector<NavMeshPathQueryTask3D> query_tasks;
+		LocalVector<NavMap3D *> maps;
+		LocalVector<NavMapIteration3D *> map_iterations;
+		Callable callback;
+		WorkerThreadPool::GroupID group_task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
 	static bool emit_callback(const Callable &p_callback);
 
 	static Vector3 polygons_get_random_point(const LocalVector<Nav3D::Polygon> &p_polygons, uint32_t p_navigation_layers, bool p_uniformly);
@@ -129,6 +144,15 @@ public:
 	static Vector3 map_iteration_get_random_point(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
 
 	static void map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
+	static void map_iteration_query_paths(NavMapIteration3D &p_map_iteration, NavMeshPathQueryTask3D *p_query_tasks, uint32_t p_query_task_count);
+
+	static void path_query_batch_start(NavMeshPathQueryBatch3D &p_batch);
+	static bool path_query_batch_is_finished(const NavMeshPathQueryBatch3D &p_batch);
+	static void path_query_batch_finish(NavMeshPathQueryBatch3D &p_batch);
+	static void _path_query_batch_process_range(void *p_userdata, uint32_t p_begin, uint32_t p_end);
+
+	static void query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters);
+	static void query_task_set_result(const NavMeshPathQueryTask3D &p_query_task);
 
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
@@ -39,6 +39,8 @@ struct NavRegionIteration3D : NavBaseIteration3D {
 	Transform3D transform;
 	real_t surface_area = 0.0;
 	AABB bounds;
+	/// Id of the region polygons this iteration holds a copy of.
+	uint32_t polygons_iteration_id = 0;
 
 	const Transform3D &get_transform() const { return transform; }
 	real_t get_surface_area() const { return surface_area; }
@@ -149,34 +149,27 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 
 	GET_MAP_ITERATION();
 
-	map_iteration.path_query_slots_semaphore.wait();
-
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
-		if (!p_path_query_slot.in_use) {
-			p_path_query_slot.in_use = true;
-			p_query_task.path_query_slot = &p_path_query_slot;
-			break;
-		}
-	}
-	map_iteration.path_query_slots_mutex.unlock();
+	NavMeshQueries3D::map_iteration_query_paths(map_iteration, &p_query_task, 1);
+}
 
-	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
-		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+NavMapIteration3D *NavMap3D::acquire_path_query_iteration() {
+	if (iteration_id == 0) {
+		return nullptr;
 	}
 
-	p_query_task.map_up = map_iteration.map_up;
-
-	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+	iteration_slot_rwlock.read_lock();
+	NavMapIteration3D *map_iteration = &iteration_slots[iteration_slot_index];
+	// Counted as a user, the next iteration build can't reuse this slot until it is released.
+	map_iteration->users.increment();
+	iteration_slot_rwlock.read_unlock();
 
-	map_iteration.path_query_slots_mutex.lock();
-	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
-	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+	return map_iteration;
+}
 
-	map_iteration.path_query_slots_semaphore.post();
+void NavMap3D::release_path_query_iteration(NavMapIteration3D *p_map_iteration) {
+	if (p_map_iteration) {
+		p_map_iteration->users.decrement();
+	}
 }
 
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -382,6 +375,14 @@ void NavMap3D::_build_iteration() {
 
 	next_map_iteration.region_ptr_to_region_id.clear();
 
+	// Regions that did not change since this slot was last built keep their polygon copies.
+	HashMap<RID, uint32_t> previous_region_ids;
+	LocalVector<NavRegionIteration3D> previous_region_iterations = std::move(next_map_iteration.region_iterations);
+	previous_region_ids.reserve(previous_region_iterations.size());
+	for (uint32_t i = 0; i < previous_region_iterations.size(); i++) {
+		previous_region_ids[previous_region_iterations[i].get_self()] = i;
+	}
+
 	next_map_iteration.region_iterations.clear();
 	next_map_iteration.link_iterations.clear();
 
@@ -396,6 +397,12 @@ void NavMap3D::_build_iteration() {
 			continue;
 		}
 		NavRegionIteration3D &region_iteration = next_map_iteration.region_iterations[region_id_count];
+		HashMap<RID, uint32_t>::ConstIterator previous_id = previous_region_ids.find(region->get_self());
+		if (previous_id) {
+			NavRegionIteration3D &previous_region_iteration = previous_region_iterations[previous_id->value];
+			region_iteration.polygons_iteration_id = previous_region_iteration.polygons_iteration_id;
+			region_iteration.navmesh_polygons = std::move(previous_region_iteration.navmesh_polygons);
+		}
 		region_iteration.id = region_id_count++;
 		region->get_iteration_update(region_iteration);
 		next_map_iteration.region_ptr_to_region_id[region] = (uint32_t)region_iteration.id;
@@ -205,6 +205,7 @@ void NavRegion3D::update_polygons() {
 	surface_area = 0.0;
 	bounds = AABB();
 	polygons_dirty = false;
+	polygons_iteration_id = polygons_iteration_id % UINT32_MAX + 1;
 
 	if (map == nullptr) {
 		return;
@@ -304,6 +305,15 @@ void NavRegion3D::get_iteration_update(NavRegionIteration3D &r_iteration) {
 	r_iteration.bounds = get_bounds();
 	r_iteration.surface_area = get_surface_area();
 
+	// The map hands over the polygons of the previous iteration when they are still up to date.
+	if (r_iteration.polygons_iteration_id == polygons_iteration_id && r_iteration.navmesh_polygons.size() == navmesh_polygons.size()) {
+		for (Polygon &polygon : r_iteration.navmesh_polygons) {
+			polygon.owner = &r_iteration;
+		}
+		return;
+	}
+
+	r_iteration.polygons_iteration_id = polygons_iteration_id;
 	r_iteration.navmesh_polygons.clear();
 	r_iteration.navmesh_polygons.resize(navmesh_polygons.size());
 	for (uint32_t i = 0; i < navmesh_polygons.size(); i++) {
@@ -51,6 +51,8 @@ class NavRegion3D : public NavBase3D {
 	bool polygons_dirty = true;
 
 	LocalVector<Nav3D::Polygon> navmesh_polygons;
+	/// Changes every time the polygons are rebuilt.
+	uint32_t polygons_iteration_id = 0;
 
 	real_t surface_area = 0.0;
 	AABB bounds;
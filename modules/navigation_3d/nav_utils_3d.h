@@ -184,11 +184,6 @@ struct ClosestPointQueryResult {
 	RID owner;
 };
 
-struct EdgeConnectionPair {
-	Edge::Connection connections[2];
-	int size = 0;
-};
-
 struct PerformanceData {
 	int pm_region_count = 0;
 	int pm_agent_count = 0;
@@ -32,6 +32,7 @@
 #include "cpu_particles_2d.compat.inc"
 
 #include "core/math/random_number_generator.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/math/transform_interpolator.h"
 #include "scene/2d/gpu_particles_2d.h"
 #include "scene/resources/atlas_texture.h"
@@ -393,7 +394,9 @@ static void _adjust_curve_range(const Ref<Curve> &p_curve, real_t p_min, real_t
 void CPUParticles2D::set_param_curve(Parameter p_param, const Ref<Curve> &p_curve) {
 	ERR_FAIL_INDEX(p_param, PARAM_MAX);
 
+	baked_table_replace_source(curve_parameters[p_param], p_curve, callable_mp(this, &CPUParticles2D::_baked_tables_changed));
 	curve_parameters[p_param] = p_curve;
+	baked_tables_dirty = true;
 
 	switch (p_param) {
 		case PARAM_INITIAL_LINEAR_VELOCITY: {
@@ -452,7 +455,9 @@ Color CPUParticles2D::get_color() const {
 }
 
 void CPUParticles2D::set_color_ramp(const Ref<Gradient> &p_ramp) {
+	baked_table_replace_source(color_ramp, p_ramp, callable_mp(this, &CPUParticles2D::_baked_tables_changed));
 	color_ramp = p_ramp;
+	baked_tables_dirty = true;
 }
 
 Ref<Gradient> CPUParticles2D::get_color_ramp() const {
@@ -557,15 +562,20 @@ Vector2 CPUParticles2D::get_gravity() const {
 }
 
 void CPUParticles2D::set_scale_curve_x(Ref<Curve> p_scale_curve) {
+	baked_table_replace_source(scale_curve_x, p_scale_curve, callable_mp(this, &CPUParticles2D::_baked_tables_changed));
 	scale_curve_x = p_scale_curve;
+	baked_tables_dirty = true;
 }
 
 void CPUParticles2D::set_scale_curve_y(Ref<Curve> p_scale_curve) {
+	baked_table_replace_source(scale_curve_y, p_scale_curve, callable_mp(this, &CPUParticles2D::_baked_tables_changed));
 	scale_curve_y = p_scale_curve;
+	baked_tables_dirty = true;
 }
 
 void CPUParticles2D::set_split_scale(bool p_split_scale) {
 	split_scale = p_split_scale;
+	baked_tables_dirty = true;
 	notify_property_list_changed();
 }
 
@@ -674,6 +684,26 @@ static real_t rand_from_seed(uint32_t &seed) {
 	return (seed % uint32_t(65536)) / 65535.0;
 }
 
+void CPUParticles2D::_baked_tables_changed() {
+	baked_tables_dirty = true;
+}
+
+void CPUParticles2D::_update_baked_tables() {
+	if (!baked_tables_dirty) {
+		return;
+	}
+	baked_tables_dirty = false;
+
+	for (int i = 0; i < PARAM_MAX; i++) {
+		baked_curve_parameters[i].bake(curve_parameters[i]);
+	}
+	if (split_scale) {
+		baked_scale_curve_x.bake(scale_curve_x);
+		baked_scale_curve_y.bake(scale_curve_y);
+	}
+	baked_color_ramp.bake(color_ramp);
+}
+
 void CPUParticles2D::_update_internal() {
 	if (particles.size() == 0 || !is_visible_in_tree()) {
 		_set_do_redraw(false);
@@ -773,9 +803,16 @@ void CPUParticles2D::_particles_process(double p_delta) {
 
 	double system_phase = time / lifetime;
 
+	_update_baked_tables();
+
+	particle_steps.resize(pcount);
+	ParticleStep *steps = particle_steps.ptr();
+
 	bool should_be_active = false;
 	for (int i = 0; i < pcount; i++) {
 		Particle &p = parray[i];
+		ParticleStep &step = steps[i];
+		step.mode = STEP_SKIP;
 
 		if (!emitting && !p.active) {
 			continue;
@@ -832,8 +869,6 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			restart = true;
 		}
 
-		float tv = 0.0;
-
 		if (restart) {
 			if (!emitting) {
 				p.active = false;
@@ -841,19 +876,21 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			}
 			p.active = true;
 
+			float tv = 0.0;
+
 			/*real_t tex_linear_velocity = 0;
 			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
 				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->sample(0);
 			}*/
 
 			real_t tex_angle = 1.0;
-			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_angle = curve_parameters[PARAM_ANGLE]->sample(tv);
+			if (baked_curve_parameters[PARAM_ANGLE].is_valid()) {
+				tex_angle = baked_curve_parameters[PARAM_ANGLE].sample(tv);
 			}
 
 			real_t tex_anim_offset = 1.0;
-			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_anim_offset = curve_parameters[PARAM_ANGLE]->sample(tv);
+			if (baked_curve_parameters[PARAM_ANGLE].is_valid()) {
+				tex_anim_offset = baked_curve_parameters[PARAM_ANGLE].sample(tv);
 			}
 
 			p.seed = seed + uint32_t(i) + i + cycle;
@@ -936,135 +973,182 @@ void CPUParticles2D::_particles_process(double p_delta) {
 				p.transform = emission_xform * p.transform;
 			}
 
+			step.mode = STEP_RESTARTED;
 		} else if (!p.active) {
 			continue;
-		} else if (p.time > p.lifetime) {
-			p.active = false;
-			tv = 1.0;
 		} else {
-			uint32_t _seed = p.seed;
-			p.time += local_delta;
-			p.custom[1] = p.time / lifetime;
-			tv = p.time / p.lifetime;
+			step.mode = STEP_ADVANCE;
+		}
 
-			real_t tex_linear_velocity = 1.0;
-			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
-				tex_linear_velocity = curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY]->sample(tv);
-			}
+		step.delta = local_delta;
+		should_be_active = true;
+	}
 
-			real_t tex_orbit_velocity = 1.0;
-			if (curve_parameters[PARAM_ORBIT_VELOCITY].is_valid()) {
-				tex_orbit_velocity = curve_parameters[PARAM_ORBIT_VELOCITY]->sample(tv);
-			}
+	ParticleAdvance advance;
+	advance.particles = parray;
+	advance.steps = steps;
+	advance.count = pcount;
+	advance.emission_xform = emission_xform;
 
-			real_t tex_angular_velocity = 1.0;
-			if (curve_parameters[PARAM_ANGULAR_VELOCITY].is_valid()) {
-				tex_angular_velocity = curve_parameters[PARAM_ANGULAR_VELOCITY]->sample(tv);
-			}
+	if (pcount >= PARALLEL_PROCESS_MIN_PARTICLES) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_particles_advance_chunk, &advance, Math::division_round_up(advance.count, (uint32_t)PARALLEL_PROCESS_CHUNK_SIZE), -1, true, SNAME("CPUParticles2DProcess"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_particles_advance(advance, 0, advance.count);
+	}
 
-			real_t tex_linear_accel = 1.0;
-			if (curve_parameters[PARAM_LINEAR_ACCEL].is_valid()) {
-				tex_linear_accel = curve_parameters[PARAM_LINEAR_ACCEL]->sample(tv);
-			}
+	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
+		active = false;
+		emit_signal(SceneStringName(finished));
+	}
+}
 
-			real_t tex_tangential_accel = 1.0;
-			if (curve_parameters[PARAM_TANGENTIAL_ACCEL].is_valid()) {
-				tex_tangential_accel = curve_parameters[PARAM_TANGENTIAL_ACCEL]->sample(tv);
-			}
+void CPUParticles2D::_particles_advance_chunk(uint32_t p_chunk, const ParticleAdvance *p_advance) {
+	const uint32_t from = p_chunk * PARALLEL_PROCESS_CHUNK_SIZE;
+	_particles_advance(*p_advance, from, MIN(from + PARALLEL_PROCESS_CHUNK_SIZE, p_advance->count));
+}
 
-			real_t tex_radial_accel = 1.0;
-			if (curve_parameters[PARAM_RADIAL_ACCEL].is_valid()) {
-				tex_radial_accel = curve_parameters[PARAM_RADIAL_ACCEL]->sample(tv);
-			}
+void CPUParticles2D::_particles_advance(const ParticleAdvance &p_advance, uint32_t p_from, uint32_t p_to) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		const ParticleStep &step = p_advance.steps[i];
+		if (step.mode == STEP_SKIP) {
+			continue;
+		}
 
-			real_t tex_damping = 1.0;
-			if (curve_parameters[PARAM_DAMPING].is_valid()) {
-				tex_damping = curve_parameters[PARAM_DAMPING]->sample(tv);
-			}
+		Particle &p = p_advance.particles[i];
+		double local_delta = step.delta;
+		float tv = 0.0;
 
-			real_t tex_angle = 1.0;
-			if (curve_parameters[PARAM_ANGLE].is_valid()) {
-				tex_angle = curve_parameters[PARAM_ANGLE]->sample(tv);
-			}
-			real_t tex_anim_speed = 1.0;
-			if (curve_parameters[PARAM_ANIM_SPEED].is_valid()) {
-				tex_anim_speed = curve_parameters[PARAM_ANIM_SPEED]->sample(tv);
-			}
+		if (step.mode == STEP_ADVANCE) {
+			if (p.time > p.lifetime) {
+				p.active = false;
+				tv = 1.0;
+			} else {
+				uint32_t _seed = p.seed;
+				p.time += local_delta;
+				p.custom[1] = p.time / lifetime;
+				tv = p.time / p.lifetime;
+
+				real_t tex_linear_velocity = 1.0;
+				if (baked_curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
+					tex_linear_velocity = baked_curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].sample(tv);
+				}
 
-			real_t tex_anim_offset = 1.0;
-			if (curve_parameters[PARAM_ANIM_OFFSET].is_valid()) {
-				tex_anim_offset = curve_parameters[PARAM_ANIM_OFFSET]->sample(tv);
-			}
+				real_t tex_orbit_velocity = 1.0;
+				if (baked_curve_parameters[PARAM_ORBIT_VELOCITY].is_valid()) {
+					tex_orbit_velocity = baked_curve_parameters[PARAM_ORBIT_VELOCITY].sample(tv);
+				}
 
-			Vector2 force = gravity;
-			Vector2 pos = p.transform[2];
-
-			//apply linear acceleration
-			force += p.velocity.length() > 0.0 ? p.velocity.normalized() * tex_linear_accel * Math::lerp(parameters_min[PARAM_LINEAR_ACCEL], parameters_max[PARAM_LINEAR_ACCEL], rand_from_seed(_seed)) : Vector2();
-			//apply radial acceleration
-			Vector2 org = emission_xform[2];
-			Vector2 diff = pos - org;
-			force += diff.length() > 0.0 ? diff.normalized() * (tex_radial_accel)*Math::lerp(parameters_min[PARAM_RADIAL_ACCEL], parameters_max[PARAM_RADIAL_ACCEL], rand_from_seed(_seed)) : Vector2();
-			//apply tangential acceleration;
-			Vector2 yx = Vector2(diff.y, diff.x);
-			force += yx.length() > 0.0 ? (yx * Vector2(-1.0, 1.0)).normalized() * (tex_tangential_accel * Math::lerp(parameters_min[PARAM_TANGENTIAL_ACCEL], parameters_max[PARAM_TANGENTIAL_ACCEL], rand_from_seed(_seed))) : Vector2();
-			//apply attractor forces
-			p.velocity += force * local_delta;
-			//orbit velocity
-			real_t orbit_amount = tex_orbit_velocity * Math::lerp(parameters_min[PARAM_ORBIT_VELOCITY], parameters_max[PARAM_ORBIT_VELOCITY], rand_from_seed(_seed));
-			if (orbit_amount != 0.0) {
-				real_t ang = orbit_amount * local_delta * Math_TAU;
-				// Not sure why the ParticleProcessMaterial code uses a clockwise rotation matrix,
-				// but we use -ang here to reproduce its behavior.
-				Transform2D rot = Transform2D(-ang, Vector2());
-				p.transform[2] -= diff;
-				p.transform[2] += rot.basis_xform(diff);
-			}
-			if (curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
-				p.velocity = p.velocity.normalized() * tex_linear_velocity;
-			}
+				real_t tex_angular_velocity = 1.0;
+				if (baked_curve_parameters[PARAM_ANGULAR_VELOCITY].is_valid()) {
+					tex_angular_velocity = baked_curve_parameters[PARAM_ANGULAR_VELOCITY].sample(tv);
+				}
+
+				real_t tex_linear_accel = 1.0;
+				if (baked_curve_parameters[PARAM_LINEAR_ACCEL].is_valid()) {
+					tex_linear_accel = baked_curve_parameters[PARAM_LINEAR_ACCEL].sample(tv);
+				}
+
+				real_t tex_tangential_accel = 1.0;
+				if (baked_curve_parameters[PARAM_TANGENTIAL_ACCEL].is_valid()) {
+					tex_tangential_accel = baked_curve_parameters[PARAM_TANGENTIAL_ACCEL].sample(tv);
+				}
+
+				real_t tex_radial_accel = 1.0;
+				if (baked_curve_parameters[PARAM_RADIAL_ACCEL].is_valid()) {
+					tex_radial_accel = baked_curve_parameters[PARAM_RADIAL_ACCEL].sample(tv);
+				}
+
+				real_t tex_damping = 1.0;
+				if (baked_curve_parameters[PARAM_DAMPING].is_valid()) {
+					tex_damping = baked_curve_parameters[PARAM_DAMPING].sample(tv);
+				}
+
+				real_t tex_angle = 1.0;
+				if (baked_curve_parameters[PARAM_ANGLE].is_valid()) {
+					tex_angle = baked_curve_parameters[PARAM_ANGLE].sample(tv);
+				}
+				real_t tex_anim_speed = 1.0;
+				if (baked_curve_parameters[PARAM_ANIM_SPEED].is_valid()) {
+					tex_anim_speed = baked_curve_parameters[PARAM_ANIM_SPEED].sample(tv);
+				}
 
-			if (parameters_max[PARAM_DAMPING] + tex_damping > 0.0) {
-				real_t v = p.velocity.length();
-				real_t damp = tex_damping * Math::lerp(parameters_min[PARAM_DAMPING], parameters_max[PARAM_DAMPING], rand_from_seed(_seed));
-				v -= damp * local_delta;
-				if (v < 0.0) {
-					p.velocity = Vector2();
-				} else {
-					p.velocity = p.velocity.normalized() * v;
+				real_t tex_anim_offset = 1.0;
+				if (baked_curve_parameters[PARAM_ANIM_OFFSET].is_valid()) {
+					tex_anim_offset = baked_curve_parameters[PARAM_ANIM_OFFSET].sample(tv);
 				}
+
+				Vector2 force = gravity;
+				Vector2 pos = p.transform[2];
+
+				//apply linear acceleration
+				force += p.velocity.length() > 0.0 ? p.velocity.normalized() * tex_linear_accel * Math::lerp(parameters_min[PARAM_LINEAR_ACCEL], parameters_max[PARAM_LINEAR_ACCEL], rand_from_seed(_seed)) : Vector2();
+				//apply radial acceleration
+				Vector2 org = p_advance.emission_xform[2];
+				Vector2 diff = pos - org;
+				force += diff.length() > 0.0 ? diff.normalized() * (tex_radial_accel)*Math::lerp(parameters_min[PARAM_RADIAL_ACCEL], parameters_max[PARAM_RADIAL_ACCEL], rand_from_seed(_seed)) : Vector2();
+				//apply tangential acceleration;
+				Vector2 yx = Vector2(diff.y, diff.x);
+				force += yx.length() > 0.0 ? (yx * Vector2(-1.0, 1.0)).normalized() * (tex_tangential_accel * Math::lerp(parameters_min[PARAM_TANGENTIAL_ACCEL], parameters_max[PARAM_TANGENTIAL_ACCEL], rand_from_seed(_seed))) : Vector2();
+				//apply attractor forces
+				p.velocity += force * local_delta;
+				//orbit velocity
+				real_t orbit_amount = tex_orbit_velocity * Math::lerp(parameters_min[PARAM_ORBIT_VELOCITY], parameters_max[PARAM_ORBIT_VELOCITY], rand_from_seed(_seed));
+				if (orbit_amount != 0.0) {
+					real_t ang = orbit_amount * local_delta * Math_TAU;
+					// Not sure why the ParticleProcessMaterial code uses a clockwise rotation matrix,
+					// but we use -ang here to reproduce its behavior.
+					Transform2D rot = Transform2D(-ang, Vector2());
+					p.transform[2] -= diff;
+					p.transform[2] += rot.basis_xform(diff);
+				}
+				if (baked_curve_parameters[PARAM_INITIAL_LINEAR_VELOCITY].is_valid()) {
+					p.velocity = p.velocity.normalized() * tex_linear_velocity;
+				}
+
+				if (parameters_max[PARAM_DAMPING] + tex_damping > 0.0) {
+					real_t v = p.velocity.length();
+					real_t damp = tex_damping * Math::lerp(parameters_min[PARAM_DAMPING], parameters_max[PARAM_DAMPING], rand_from_seed(_seed));
+					v -= damp * local_delta;
+					if (v < 0.0) {
+						p.velocity = Vector2();
+					} else {
+						p.velocity = p.velocity.normalized() * v;
+					}
+				}
+				real_t base_angle = (tex_angle)*Math::lerp(parameters_min[PARAM_ANGLE], parameters_max[PARAM_ANGLE], p.angle_rand);
+				base_angle += p.custom[1] * lifetime * tex_angular_velocity * Math::lerp(parameters_min[PARAM_ANGULAR_VELOCITY], parameters_max[PARAM_ANGULAR_VELOCITY], rand_from_seed(_seed));
+				p.rotation = Math::deg_to_rad(base_angle); //angle
+				p.custom[2] = tex_anim_offset * Math::lerp(parameters_min[PARAM_ANIM_OFFSET], parameters_max[PARAM_ANIM_OFFSET], p.anim_offset_rand) + tv * tex_anim_speed * Math::lerp(parameters_min[PARAM_ANIM_SPEED], parameters_max[PARAM_ANIM_SPEED], rand_from_seed(_seed));
 			}
-			real_t base_angle = (tex_angle)*Math::lerp(parameters_min[PARAM_ANGLE], parameters_max[PARAM_ANGLE], p.angle_rand);
-			base_angle += p.custom[1] * lifetime * tex_angular_velocity * Math::lerp(parameters_min[PARAM_ANGULAR_VELOCITY], parameters_max[PARAM_ANGULAR_VELOCITY], rand_from_seed(_seed));
-			p.rotation = Math::deg_to_rad(base_angle); //angle
-			p.custom[2] = tex_anim_offset * Math::lerp(parameters_min[PARAM_ANIM_OFFSET], parameters_max[PARAM_ANIM_OFFSET], p.anim_offset_rand) + tv * tex_anim_speed * Math::lerp(parameters_min[PARAM_ANIM_SPEED], parameters_max[PARAM_ANIM_SPEED], rand_from_seed(_seed));
 		}
+
 		//apply color
 		//apply hue rotation
 
 		Vector2 tex_scale = Vector2(1.0, 1.0);
 		if (split_scale) {
-			if (scale_curve_x.is_valid()) {
-				tex_scale.x = scale_curve_x->sample(tv);
+			if (baked_scale_curve_x.is_valid()) {
+				tex_scale.x = baked_scale_curve_x.sample(tv);
 			} else {
 				tex_scale.x = 1.0;
 			}
-			if (scale_curve_y.is_valid()) {
-				tex_scale.y = scale_curve_y->sample(tv);
+			if (baked_scale_curve_y.is_valid()) {
+				tex_scale.y = baked_scale_curve_y.sample(tv);
 			} else {
 				tex_scale.y = 1.0;
 			}
 		} else {
-			if (curve_parameters[PARAM_SCALE].is_valid()) {
-				real_t tmp_scale = curve_parameters[PARAM_SCALE]->sample(tv);
+			if (baked_curve_parameters[PARAM_SCALE].is_valid()) {
+				real_t tmp_scale = baked_curve_parameters[PARAM_SCALE].sample(tv);
 				tex_scale.x = tmp_scale;
 				tex_scale.y = tmp_scale;
 			}
 		}
 
 		real_t tex_hue_variation = 0.0;
-		if (curve_parameters[PARAM_HUE_VARIATION].is_valid()) {
-			tex_hue_variation = curve_parameters[PARAM_HUE_VARIATION]->sample(tv);
+		if (baked_curve_parameters[PARAM_HUE_VARIATION].is_valid()) {
+			tex_hue_variation = baked_curve_parameters[PARAM_HUE_VARIATION].sample(tv);
 		}
 
 		real_t hue_rot_angle = (tex_hue_variation)*Math_TAU * Math::lerp(parameters_min[PARAM_HUE_VARIATION], parameters_max[PARAM_HUE_VARIATION], p.hue_rot_rand);
@@ -1082,8 +1166,8 @@ void CPUParticles2D::_particles_process(double p_delta) {
 			}
 		}
 
-		if (color_ramp.is_valid()) {
-			p.color = color_ramp->get_color_at_offset(tv) * color;
+		if (baked_color_ramp.is_valid()) {
+			p.color = baked_color_ramp.sample(tv) * color;
 		} else {
 			p.color = color;
 		}
@@ -1118,43 +1202,20 @@ void CPUParticles2D::_particles_process(double p_delta) {
 		p.transform.columns[1] *= base_scale.y;
 
 		p.transform[2] += p.velocity * local_delta;
-
-		should_be_active = true;
-	}
-	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
-		active = false;
-		emit_signal(SceneStringName(finished));
 	}
 }
 
-void CPUParticles2D::_update_particle_data_buffer() {
-	MutexLock lock(update_mutex);
-
-	int pc = particles.size();
-
-	int *ow;
-	int *order = nullptr;
-
-	float *w = particle_data.ptrw();
-	const Particle *r = particles.ptr();
-	float *ptr = w;
+void CPUParticles2D::_fill_particle_data_chunk(uint32_t p_chunk, const ParticleDataFill *p_fill) {
+	const uint32_t from = p_chunk * PARALLEL_PROCESS_CHUNK_SIZE;
+	_fill_particle_data(*p_fill, from, MIN(from + PARALLEL_PROCESS_CHUNK_SIZE, p_fill->count));
+}
 
-	if (draw_order != DRAW_ORDER_INDEX) {
-		ow = particle_order.ptrw();
-		order = ow;
+void CPUParticles2D::_fill_particle_data(const ParticleDataFill &p_fill, uint32_t p_from, uint32_t p_to) {
+	const Particle *r = p_fill.particles;
+	float *ptr = p_fill.data + p_from * 16;
 
-		for (int i = 0; i < pc; i++) {
-			order[i] = i;
-		}
-		if (draw_order == DRAW_ORDER_LIFETIME) {
-			SortArray<int, SortLifetime> sorter;
-			sorter.compare.particles = r;
-			sorter.sort(order, pc);
-		}
-	}
-
-	for (int i = 0; i < pc; i++) {
-		int idx = order ? order[i] : i;
+	for (uint32_t i = p_from; i < p_to; i++) {
+		int idx = p_fill.order ? p_fill.order[i] : i;
 
 		Transform2D t = r[idx].transform;
 
@@ -1192,6 +1253,45 @@ void CPUParticles2D::_update_particle_data_buffer() {
 	}
 }
 
+void CPUParticles2D::_update_particle_data_buffer() {
+	MutexLock lock(update_mutex);
+
+	int pc = particles.size();
+
+	int *ow;
+	int *order = nullptr;
+
+	float *w = particle_data.ptrw();
+	const Particle *r = particles.ptr();
+
+	if (draw_order != DRAW_ORDER_INDEX) {
+		ow = particle_order.ptrw();
+		order = ow;
+
+		for (int i = 0; i < pc; i++) {
+			order[i] = i;
+		}
+		if (draw_order == DRAW_ORDER_LIFETIME) {
+			SortArray<int, SortLifetime> sorter;
+			sorter.compare.particles = r;
+			sorter.sort(order, pc);
+		}
+	}
+
+	ParticleDataFill fill;
+	fill.particles = r;
+	fill.order = order;
+	fill.data = w;
+	fill.count = pc;
+
+	if (pc >= PARALLEL_PROCESS_MIN_PARTICLES) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_fill_particle_data_chunk, &fill, Math::division_round_up(fill.count, (uint32_t)PARALLEL_PROCESS_CHUNK_SIZE), -1, true, SNAME("CPUParticles2DFillBuffer"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_fill_particle_data(fill, 0, fill.count);
+	}
+}
+
 void CPUParticles2D::_set_do_redraw(bool p_do_redraw) {
 	if (do_redraw == p_do_redraw) {
 		return;
@@ -1380,9 +1480,9 @@ void CPUParticles2D::convert_from_particles(Node *p_particles) {
 
 	Ref<CurveXYZTexture> scale3D = proc_mat->get_param_texture(ParticleProcessMaterial::PARAM_SCALE);
 	if (scale3D.is_valid()) {
-		split_scale = true;
-		scale_curve_x = scale3D->get_curve_x();
-		scale_curve_y = scale3D->get_curve_y();
+		set_split_scale(true);
+		set_scale_curve_x(scale3D->get_curve_x());
+		set_scale_curve_y(scale3D->get_curve_y());
 	}
 	set_gravity(Vector2(proc_mat->get_gravity().x, proc_mat->get_gravity().y));
 	set_lifetime_randomness(proc_mat->get_lifetime_randomness());
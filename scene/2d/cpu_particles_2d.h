@@ -31,6 +31,7 @@
 #pragma once
 
 #include "scene/2d/node_2d.h"
+#include "scene/resources/baked_curve_table.h"
 
 class RandomNumberGenerator;
 
@@ -112,6 +113,41 @@ private:
 	Vector<float> particle_data;
 	Vector<int> particle_order;
 
+	enum {
+		// Emitters with fewer particles are processed on the calling thread.
+		PARALLEL_PROCESS_MIN_PARTICLES = 4096,
+		PARALLEL_PROCESS_CHUNK_SIZE = 1024,
+	};
+
+	enum StepMode : uint8_t {
+		STEP_SKIP,
+		STEP_RESTARTED,
+		STEP_ADVANCE,
+	};
+
+	// How a particle moves in the current step. Emission draws from the shared RNG, so it is decided
+	// serially; the rest of the step only touches the particle itself and can run in parallel.
+	struct ParticleStep {
+		double delta = 0.0;
+		StepMode mode = STEP_SKIP;
+	};
+
+	LocalVector<ParticleStep> particle_steps;
+
+	struct ParticleAdvance {
+		Particle *particles = nullptr;
+		const ParticleStep *steps = nullptr;
+		uint32_t count = 0;
+		Transform2D emission_xform;
+	};
+
+	struct ParticleDataFill {
+		const Particle *particles = nullptr;
+		const int *order = nullptr;
+		float *data = nullptr;
+		uint32_t count = 0;
+	};
+
 	struct SortLifetime {
 		const Particle *particles = nullptr;
 
@@ -186,8 +222,21 @@ private:
 
 	Ref<RandomNumberGenerator> rng;
 
+	BakedCurveTable baked_curve_parameters[PARAM_MAX];
+	BakedCurveTable baked_scale_curve_x;
+	BakedCurveTable baked_scale_curve_y;
+	BakedGradientTable baked_color_ramp;
+	bool baked_tables_dirty = true;
+
+	void _baked_tables_changed();
+	void _update_baked_tables();
+
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _particles_advance(const ParticleAdvance &p_advance, uint32_t p_from, uint32_t p_to);
+	void _particles_advance_chunk(uint32_t p_chunk, const ParticleAdvance *p_advance);
+	void _fill_particle_data(const ParticleDataFill &p_fill, uint32_t p_from, uint32_t p_to);
+	void _fill_particle_data_chunk(uint32_t p_chunk, const ParticleDataFill *p_fill);
 	void _update_particle_data_buffer();
 	void _set_emitting();
 
@@ -32,6 +32,7 @@
 
 #include "core/math/transform_interpolator.h"
 #include "scene/3d/visual_instance_3d.h"
+#include "scene/main/global_transform_batch.h"
 #include "scene/main/viewport.h"
 #include "scene/property_utils.h"
 
@@ -494,6 +495,11 @@ Transform3D Node3D::get_global_transform() const {
 	return data.global_transform;
 }
 
+void Node3D::update_global_transforms(const LocalVector<Node3D *> &p_nodes) {
+	ERR_FAIL_COND(!is_current_thread_safe_for_nodes());
+	GlobalTransformBatch<Node3D>::update(p_nodes, SNAME("Node3DGlobalTransforms"));
+}
+
 #ifdef TOOLS_ENABLED
 Transform3D Node3D::get_global_gizmo_transform() const {
 	return get_global_transform();
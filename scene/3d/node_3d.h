@@ -50,6 +50,9 @@ public:
 class Node3D : public Node {
 	GDCLASS(Node3D, Node);
 
+	template <typename T>
+	friend class GlobalTransformBatch;
+
 public:
 	// Edit mode for the rotation.
 	// THIS MODE ONLY AFFECTS HOW DATA IS EDITED AND SAVED
@@ -147,6 +150,11 @@ private:
 	void _set_dirty_bits(uint32_t p_bits) const;
 	void _clear_dirty_bits(uint32_t p_bits) const;
 
+	// For GlobalTransformBatch.
+	_FORCE_INLINE_ bool _is_global_transform_dirty() const { return _test_dirty_bits(DIRTY_GLOBAL_TRANSFORM); }
+	_FORCE_INLINE_ Node3D *_get_global_transform_parent() const { return data.top_level ? nullptr : data.parent; }
+	_FORCE_INLINE_ const List<Node3D *> &_get_global_transform_children() const { return data.children; }
+
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
@@ -225,6 +233,7 @@ public:
 	Basis get_basis() const;
 	Quaternion get_quaternion() const;
 	Transform3D get_global_transform() const;
+	static void update_global_transforms(const LocalVector<Node3D *> &p_nodes);
 
 	Transform3D get_global_transform_interpolated();
 	bool update_client_physics_interpolation_data();
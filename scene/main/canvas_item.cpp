@@ -33,6 +33,7 @@
 
 #include "scene/2d/canvas_group.h"
 #include "scene/main/canvas_layer.h"
+#include "scene/main/global_transform_batch.h"
 #include "scene/main/window.h"
 #include "scene/resources/atlas_texture.h"
 #include "scene/resources/font.h"
@@ -188,6 +189,11 @@ Transform2D CanvasItem::get_global_transform() const {
 	return global_transform;
 }
 
+void CanvasItem::update_global_transforms(const LocalVector<CanvasItem *> &p_items) {
+	ERR_FAIL_COND(!is_current_thread_safe_for_nodes() || is_group_processing());
+	GlobalTransformBatch<CanvasItem>::update(p_items, SNAME("CanvasItemGlobalTransforms"));
+}
+
 // Same as get_global_transform() but no reset for `global_invalid`.
 Transform2D CanvasItem::get_global_transform_const() const {
 	if (_is_global_invalid()) {
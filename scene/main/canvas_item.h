@@ -43,6 +43,8 @@ class CanvasItem : public Node {
 	GDCLASS(CanvasItem, Node);
 
 	friend class CanvasLayer;
+	template <typename T>
+	friend class GlobalTransformBatch;
 
 public:
 	enum TextureFilter {
@@ -123,6 +125,11 @@ private:
 	_FORCE_INLINE_ bool _is_global_invalid() const { return is_group_processing() ? global_invalid.mt.is_set() : global_invalid.st; }
 	void _set_global_invalid(bool p_invalid) const;
 
+	// For GlobalTransformBatch.
+	_FORCE_INLINE_ bool _is_global_transform_dirty() const { return _is_global_invalid(); }
+	_FORCE_INLINE_ CanvasItem *_get_global_transform_parent() const { return top_level ? nullptr : Object::cast_to<CanvasItem>(get_parent()); }
+	_FORCE_INLINE_ const List<CanvasItem *> &_get_global_transform_children() const { return children_items; }
+
 	void _top_level_raise_self();
 
 	void _propagate_visibility_changed(bool p_parent_visible_in_tree);
@@ -340,6 +347,7 @@ public:
 	virtual Transform2D get_transform() const = 0;
 
 	virtual Transform2D get_global_transform() const;
+	static void update_global_transforms(const LocalVector<CanvasItem *> &p_items);
 	virtual Transform2D get_global_transform_const() const;
 	virtual Transform2D get_global_transform_with_canvas() const;
 	virtual Transform2D get_screen_transform() const;
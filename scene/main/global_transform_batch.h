@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  global_transform_batch.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+#include "scene/main/node.h"
+
+// Resolves the global transforms of a batch of nodes top-down, one depth at a time, shared by Node3D and CanvasItem.
+// T must befriend this class and provide:
+// - bool _is_global_transform_dirty() const
+// - T *_get_global_transform_parent() const, null when the global transform doesn't depend on the parent.
+// - const List<T *> &_get_global_transform_children() const
+template <typename T>
+class GlobalTransformBatch {
+	// Below this many nodes of a same depth, resolving them is cheaper than dispatching to threads.
+	static constexpr uint32_t PARALLEL_MIN_NODES = 256;
+
+	static void _update_task(void *p_userdata, uint32_t p_index) {
+		// Nodes of a same depth don't depend on each other, and their parents are already resolved.
+		set_current_thread_safe_for_nodes(true);
+		T **nodes = (T **)p_userdata;
+		nodes[p_index]->get_global_transform();
+	}
+
+public:
+	static void update(const LocalVector<T *> &p_nodes, const StringName &p_task_name) {
+		// Find the topmost dirty ancestor of each node, so the dirty subtrees can be resolved top-down
+		// instead of each node recursing into its parents.
+		LocalVector<T *> nodes;
+		HashSet<const T *> visited;
+		for (T *node : p_nodes) {
+			if (!node->is_inside_tree() || !node->_is_global_transform_dirty()) {
+				continue;
+			}
+			T *root = node;
+			bool known = false;
+			while (true) {
+				if (visited.has(root)) {
+					known = true;
+					break;
+				}
+				visited.insert(root);
+				T *parent = root->_get_global_transform_parent();
+				if (!parent || !parent->_is_global_transform_dirty()) {
+					break;
+				}
+				root = parent;
+			}
+			if (!known) {
+				nodes.push_back(root);
+			}
+		}
+
+		// Flatten the dirty subtrees, ordered by depth.
+		LocalVector<uint32_t> depth_offsets;
+		uint32_t from = 0;
+		while (from < nodes.size()) {
+			const uint32_t to = nodes.size();
+			depth_offsets.push_back(from);
+			for (uint32_t i = from; i < to; i++) {
+				for (T *child : nodes[i]->_get_global_transform_children()) {
+					if (child->_get_global_transform_parent() && child->_is_global_transform_dirty()) {
+						nodes.push_back(child);
+					}
+				}
+			}
+			from = to;
+		}
+		depth_offsets.push_back(nodes.size());
+
+		for (uint32_t i = 0; i + 1 < depth_offsets.size(); i++) {
+			T **depth_nodes = nodes.ptr() + depth_offsets[i];
+			const uint32_t count = depth_offsets[i + 1] - depth_offsets[i];
+			if (count < PARALLEL_MIN_NODES) {
+				for (uint32_t j = 0; j < count; j++) {
+					depth_nodes[j]->get_global_transform();
+				}
+				continue;
+			}
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_update_task, depth_nodes, count, -1, true, p_task_name);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		}
+	}
+};
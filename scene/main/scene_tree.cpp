@@ -196,9 +196,42 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 	}
 }
 
+void SceneTree::_update_global_transforms() {
+	// Resolve the global transforms of the nodes about to be notified in a single batched pass,
+	// so notification handlers don't each recurse into their dirty parents.
+	LocalVector<CanvasItem *> canvas_items;
+#ifndef _3D_DISABLED
+	LocalVector<Node3D *> nodes_3d;
+#endif // _3D_DISABLED
+	for (SelfList<Node> *n = xform_change_list.first(); n; n = n->next()) {
+		Node *node = n->self();
+		if (CanvasItem *ci = Object::cast_to<CanvasItem>(node)) {
+			canvas_items.push_back(ci);
+			continue;
+		}
+#ifndef _3D_DISABLED
+		if (Node3D *n3d = Object::cast_to<Node3D>(node)) {
+			nodes_3d.push_back(n3d);
+		}
+#endif // _3D_DISABLED
+	}
+	if (canvas_items.size() >= TRANSFORM_UPDATE_BATCH_MIN_NODES) {
+		CanvasItem::update_global_transforms(canvas_items);
+	}
+#ifndef _3D_DISABLED
+	if (nodes_3d.size() >= TRANSFORM_UPDATE_BATCH_MIN_NODES) {
+		Node3D::update_global_transforms(nodes_3d);
+	}
+#endif // _3D_DISABLED
+}
+
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	if (!Node::is_group_processing() && xform_change_list.first()) {
+		_update_global_transforms();
+	}
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -182,6 +182,11 @@ private:
 	bool ugc_locked = false;
 	void _flush_ugc();
 
+	enum {
+		TRANSFORM_UPDATE_BATCH_MIN_NODES = 512, // Smaller batches are left to lazy resolution.
+	};
+	void _update_global_transforms();
+
 	_FORCE_INLINE_ void _update_group_order(Group &g);
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  baked_curve_table.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "baked_curve_table.h"
+
+static float _get_color_difference(const Color &p_a, const Color &p_b) {
+	return MAX(MAX(Math::abs(p_a.r - p_b.r), Math::abs(p_a.g - p_b.g)), MAX(Math::abs(p_a.b - p_b.b), Math::abs(p_a.a - p_b.a)));
+}
+
+void BakedCurveTable::bake(const Ref<Curve> &p_curve) {
+	values.clear();
+	direct.unref();
+	if (p_curve.is_null()) {
+		return;
+	}
+
+	values.resize(TABLE_SIZE);
+	for (int i = 0; i < TABLE_SIZE; i++) {
+		values[i] = p_curve->sample(real_t(i) / (TABLE_SIZE - 1));
+	}
+
+	// Interpolating between entries cuts corners and smooths out steps. Check halfway between entries, where
+	// the table is least accurate, and at every point, where corners are.
+	const real_t tolerance = MAX(p_curve->get_value_range(), (real_t)CMP_EPSILON) * 0.001;
+	bool accurate = true;
+	for (int i = 0; i < TABLE_SIZE - 1 && accurate; i++) {
+		const real_t offset = (i + 0.5) / (TABLE_SIZE - 1);
+		accurate = Math::abs(sample(offset) - p_curve->sample(offset)) <= tolerance;
+	}
+	for (int i = 0; i < p_curve->get_point_count() && accurate; i++) {
+		const real_t offset = p_curve->get_point_position(i).x;
+		accurate = offset < 0.0 || offset > 1.0 || Math::abs(sample(offset) - p_curve->sample(offset)) <= tolerance;
+	}
+	if (!accurate) {
+		values.clear();
+		direct = p_curve;
+	}
+}
+
+void BakedGradientTable::bake(const Ref<Gradient> &p_gradient) {
+	values.clear();
+	direct.unref();
+	if (p_gradient.is_null()) {
+		return;
+	}
+
+	// Sorts the points if needed, which must not happen later on several threads at once.
+	p_gradient->get_color_at_offset(0.0);
+
+	if (p_gradient->get_interpolation_mode() == Gradient::GRADIENT_INTERPOLATE_CONSTANT) {
+		direct = p_gradient;
+		return;
+	}
+
+	values.resize(TABLE_SIZE);
+	for (int i = 0; i < TABLE_SIZE; i++) {
+		values[i] = p_gradient->get_color_at_offset(float(i) / (TABLE_SIZE - 1));
+	}
+
+	// Points very close to each other make hard edges, check like for curves. Less than one 8-bit step.
+	const float tolerance = 0.5 / 255.0;
+	bool accurate = true;
+	for (int i = 0; i < TABLE_SIZE - 1 && accurate; i++) {
+		const float offset = (i + 0.5) / (TABLE_SIZE - 1);
+		accurate = _get_color_difference(sample(offset), p_gradient->get_color_at_offset(offset)) <= tolerance;
+	}
+	for (int i = 0; i < p_gradient->get_point_count() && accurate; i++) {
+		const float offset = p_gradient->get_offset(i);
+		accurate = _get_color_difference(sample(offset), p_gradient->get_color_at_offset(offset)) <= tolerance;
+	}
+	if (!accurate) {
+		values.clear();
+		direct = p_gradient;
+	}
+}
+
+void baked_table_replace_source(const Ref<Resource> &p_old, const Ref<Resource> &p_new, const Callable &p_changed) {
+	if (p_old.is_valid()) {
+		p_old->disconnect_changed(p_changed);
+	}
+	if (p_new.is_valid()) {
+		p_new->connect_changed(p_changed, Object::CONNECT_REFERENCE_COUNTED);
+	}
+}
@@ -0,0 +1,88 @@
+/**************************************************************************/
+/*  baked_curve_table.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/local_vector.h"
+#include "scene/resources/curve.h"
+#include "scene/resources/gradient.h"
+
+// Curves and gradients sampled at regular offsets, so particles don't search control points for every lookup.
+// Lookups are read-only and safe to share between threads. Sources a table can't follow closely enough
+// (steps, sharp corners, constant gradients) are sampled directly instead, which is just as thread-safe
+// since baking leaves them with nothing to update lazily.
+class BakedCurveTable {
+public:
+	static constexpr int TABLE_SIZE = 256;
+
+private:
+	LocalVector<real_t> values;
+	Ref<Curve> direct;
+
+public:
+	void bake(const Ref<Curve> &p_curve);
+
+	_FORCE_INLINE_ bool is_valid() const { return !values.is_empty() || direct.is_valid(); }
+	_FORCE_INLINE_ bool is_direct() const { return direct.is_valid(); }
+	_FORCE_INLINE_ real_t sample(real_t p_offset) const {
+		if (unlikely(direct.is_valid())) {
+			return direct->sample(p_offset);
+		}
+		const real_t pos = CLAMP(p_offset, (real_t)0.0, (real_t)1.0) * (TABLE_SIZE - 1);
+		const int idx = MIN(int(pos), TABLE_SIZE - 2);
+		return Math::lerp(values[idx], values[idx + 1], pos - idx);
+	}
+};
+
+class BakedGradientTable {
+public:
+	static constexpr int TABLE_SIZE = 256;
+
+private:
+	LocalVector<Color> values;
+	Ref<Gradient> direct;
+
+public:
+	void bake(const Ref<Gradient> &p_gradient);
+
+	_FORCE_INLINE_ bool is_valid() const { return !values.is_empty() || direct.is_valid(); }
+	_FORCE_INLINE_ bool is_direct() const { return direct.is_valid(); }
+	_FORCE_INLINE_ Color sample(real_t p_offset) const {
+		if (unlikely(direct.is_valid())) {
+			return direct->get_color_at_offset(p_offset);
+		}
+		const real_t pos = CLAMP(p_offset, (real_t)0.0, (real_t)1.0) * (TABLE_SIZE - 1);
+		const int idx = MIN(int(pos), TABLE_SIZE - 2);
+		return values[idx].lerp(values[idx + 1], pos - idx);
+	}
+};
+
+// Moves the connection which marks baked tables as outdated from the previous source to the new one.
+void baked_table_replace_source(const Ref<Resource> &p_old, const Ref<Resource> &p_new, const Callable &p_changed);
@@ -81,6 +81,9 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_random_point", "map", "navigation_layers", "uniformly"), &NavigationServer3D::map_get_random_point);
 
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result", "callback"), &NavigationServer3D::query_path, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_batch", "parameters", "results", "callback"), &NavigationServer3D::query_path_batch, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_batch_async", "parameters", "results", "callback"), &NavigationServer3D::query_path_batch_async, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_batch_is_finished", "batch_id"), &NavigationServer3D::query_path_batch_is_finished);
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer3D::region_create);
 	ClassDB::bind_method(D_METHOD("region_set_enabled", "region", "enabled"), &NavigationServer3D::region_set_enabled);
@@ -475,6 +475,127 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 	return r;
 }
 
+int PhysicsDirectSpaceState3D::intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_collided) {
+	RayParameters parameters = p_parameters;
+	int collided_count = 0;
+
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_collided[i] = intersect_ray(parameters, r_results[i]);
+		if (r_collided[i]) {
+			collided_count++;
+		}
+	}
+
+	return collided_count;
+}
+
+void PhysicsDirectSpaceState3D::cast_motion_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	ShapeParameters parameters = p_parameters;
+
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		parameters.motion = p_motions[i];
+		r_closest_safe[i] = 1.0f;
+		r_closest_unsafe[i] = 1.0f;
+		cast_motion(parameters, r_closest_safe[i], r_closest_unsafe[i]);
+	}
+}
+
+Dictionary PhysicsDirectSpaceState3D::_intersect_ray_batch(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	ERR_FAIL_COND_V(p_ray_query.is_null(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The 'from' and 'to' arrays must have the same size.");
+
+	int count = p_from.size();
+
+	Vector<RayResult> results;
+	results.resize(count);
+	LocalVector<bool> collided;
+	collided.resize(count);
+
+	intersect_ray_batch(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptrw(), collided.ptr());
+
+	PackedByteArray collided_array;
+	PackedVector3Array positions;
+	PackedVector3Array normals;
+	PackedInt32Array face_indices;
+	PackedInt64Array collider_ids;
+	PackedInt32Array shapes;
+	collided_array.resize(count);
+	positions.resize(count);
+	normals.resize(count);
+	face_indices.resize(count);
+	collider_ids.resize(count);
+	shapes.resize(count);
+
+	uint8_t *collided_w = collided_array.ptrw();
+	Vector3 *positions_w = positions.ptrw();
+	Vector3 *normals_w = normals.ptrw();
+	int32_t *face_indices_w = face_indices.ptrw();
+	int64_t *collider_ids_w = collider_ids.ptrw();
+	int32_t *shapes_w = shapes.ptrw();
+
+	for (int i = 0; i < count; i++) {
+		if (collided[i]) {
+			const RayResult &result = results[i];
+			collided_w[i] = 1;
+			positions_w[i] = result.position;
+			normals_w[i] = result.normal;
+			face_indices_w[i] = result.face_index;
+			collider_ids_w[i] = (int64_t)result.collider_id;
+			shapes_w[i] = result.shape;
+		} else {
+			collided_w[i] = 0;
+			positions_w[i] = Vector3();
+			normals_w[i] = Vector3();
+			face_indices_w[i] = -1;
+			collider_ids_w[i] = 0;
+			shapes_w[i] = -1;
+		}
+	}
+
+	Dictionary d;
+	d["collided"] = collided_array;
+	d["position"] = positions;
+	d["normal"] = normals;
+	d["face_index"] = face_indices;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+
+	return d;
+}
+
+Vector<real_t> PhysicsDirectSpaceState3D::_cast_motion_batch(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const PackedVector3Array &p_origins, const PackedVector3Array &p_motions) {
+	ERR_FAIL_COND_V(p_shape_query.is_null(), Vector<real_t>());
+	ERR_FAIL_COND_V_MSG(p_origins.size() != p_motions.size(), Vector<real_t>(), "The 'origins' and 'motions' arrays must have the same size.");
+
+	int count = p_origins.size();
+	const ShapeParameters &parameters = p_shape_query->get_parameters();
+
+	LocalVector<Transform3D> transforms;
+	transforms.resize(count);
+	for (int i = 0; i < count; i++) {
+		transforms[i] = Transform3D(parameters.transform.basis, p_origins[i]);
+	}
+
+	LocalVector<real_t> closest_safe;
+	LocalVector<real_t> closest_unsafe;
+	closest_safe.resize(count);
+	closest_unsafe.resize(count);
+
+	cast_motion_batch(parameters, transforms.ptr(), p_motions.ptr(), count, closest_safe.ptr(), closest_unsafe.ptr());
+
+	Vector<real_t> ret;
+	ret.resize(count * 2);
+	real_t *ret_w = ret.ptrw();
+	for (int i = 0; i < count; i++) {
+		ret_w[i * 2 + 0] = closest_safe[i];
+		ret_w[i * 2 + 1] = closest_unsafe[i];
+	}
+	return ret;
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
@@ -485,6 +606,8 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
+	ClassDB::bind_method(D_METHOD("intersect_ray_batch", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_ray_batch);
+	ClassDB::bind_method(D_METHOD("cast_motion_batch", "parameters", "origins", "motions"), &PhysicsDirectSpaceState3D::_cast_motion_batch);
 }
 
 ///////////////////////////////
@@ -1138,6 +1261,7 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.001,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/default_contact_bias", PROPERTY_HINT_RANGE, "0,1,0.01"), 0.8);
+	GLOBAL_DEF("physics/3d/solver/parallel_integration", true);
 }
 
 PhysicsServer3D::~PhysicsServer3D() {
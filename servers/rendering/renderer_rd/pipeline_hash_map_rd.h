@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "servers/rendering/renderer_rd/shader_compilation_scheduler_rd.h"
 #include "servers/rendering/rendering_device.h"
 #include "servers/rendering_server.h"
 
@@ -37,6 +38,8 @@
 
 template <typename Key, typename CreationClass, typename CreationFunction>
 class PipelineHashMapRD {
+	friend class TestPipelineHashMapRDInternalsAccessor;
+
 private:
 	CreationClass *creation_object = nullptr;
 	CreationFunction creation_function = nullptr;
@@ -46,9 +49,41 @@ private:
 	LocalVector<Pair<uint32_t, RID>> compiled_queue;
 	Mutex compiled_queue_mutex;
 	RBSet<uint32_t> compilation_set;
-	HashMap<uint32_t, WorkerThreadPool::TaskID> compilation_tasks;
+
+	struct CompilationTask {
+		Key key;
+		uint32_t key_hash = 0;
+		uint64_t queued_usec = 0;
+	};
+
+	struct QueuedCompilation {
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+		Key key;
+	};
+
+	HashMap<uint32_t, QueuedCompilation> compilation_tasks;
+	// Pipelines whose creation already began, either on a compilation thread or on a thread that needed it right away.
+	HashSet<uint32_t> compilation_started;
+	// Tasks that lost the race against a thread that needed their pipeline, they have nothing left to do but must still be waited on.
+	LocalVector<WorkerThreadPool::TaskID> superseded_tasks;
+	bool compilation_cancelled = false;
 	Mutex local_mutex;
 
+	void _compile_pipeline(CompilationTask p_task) {
+		ShaderCompilationSchedulerRD::task_started(p_task.queued_usec);
+
+		{
+			MutexLock local_lock(local_mutex);
+			if (compilation_cancelled || compilation_started.has(p_task.key_hash)) {
+				return;
+			}
+
+			compilation_started.insert(p_task.key_hash);
+		}
+
+		(creation_object->*creation_function)(p_task.key);
+	}
+
 	bool _add_new_pipelines_to_map() {
 		thread_local Vector<uint32_t> hashes_added;
 		hashes_added.clear();
@@ -66,11 +101,28 @@ private:
 		{
 			MutexLock local_lock(local_mutex);
 			for (uint32_t hash : hashes_added) {
-				HashMap<uint32_t, WorkerThreadPool::TaskID>::Iterator task_it = compilation_tasks.find(hash);
+				typename HashMap<uint32_t, QueuedCompilation>::Iterator task_it = compilation_tasks.find(hash);
 				if (task_it != compilation_tasks.end()) {
 					compilation_tasks.remove(task_it);
 				}
 			}
+
+			if (!superseded_tasks.is_empty()) {
+				WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+				if (pool == nullptr) {
+					// The scheduler was finalized, which finished every task.
+					superseded_tasks.clear();
+				} else {
+					for (uint32_t i = 0; i < superseded_tasks.size();) {
+						if (pool->is_task_completed(superseded_tasks[i])) {
+							pool->wait_for_task_completion(superseded_tasks[i]);
+							superseded_tasks.remove_at_unordered(i);
+						} else {
+							i++;
+						}
+					}
+				}
+			}
 		}
 
 		return !hashes_added.is_empty();
@@ -81,13 +133,28 @@ private:
 		tasks_to_wait.clear();
 		{
 			MutexLock local_lock(local_mutex);
-			for (KeyValue<uint32_t, WorkerThreadPool::TaskID> key_value : compilation_tasks) {
-				tasks_to_wait.push_back(key_value.value);
+			for (const KeyValue<uint32_t, QueuedCompilation> &key_value : compilation_tasks) {
+				tasks_to_wait.push_back(key_value.value.task_id);
+			}
+
+			for (WorkerThreadPool::TaskID task_id : superseded_tasks) {
+				tasks_to_wait.push_back(task_id);
 			}
+
+			superseded_tasks.clear();
 		}
 
+		if (tasks_to_wait.is_empty()) {
+			return;
+		}
+
+		WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+		if (pool == nullptr) {
+			// The scheduler was finalized, which finished every task.
+			return;
+		}
 		for (WorkerThreadPool::TaskID task_id : tasks_to_wait) {
-			WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+			pool->wait_for_task_completion(task_id);
 		}
 	}
 
@@ -108,6 +175,9 @@ public:
 			return;
 		}
 
+		WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+		ERR_FAIL_NULL_MSG(pool, "Can't compile a pipeline after the shader compilation scheduler was finalized.");
+
 		// Record the pipeline as submitted, a task can't be started for it again.
 		compilation_set.insert(p_key_hash);
 
@@ -139,13 +209,22 @@ public:
 		print_line("HASH:", p_key_hash, "SOURCE:", source_name);
 #endif
 
-		// Queue a background compilation task.
-		WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_template_task(creation_object, creation_function, p_key, p_high_priority, "PipelineCompilation");
-		compilation_tasks.insert(p_key_hash, task_id);
+		// Queue a compilation task on the shader compilation scheduler. Low priority tasks only use its background share of threads.
+		CompilationTask task;
+		task.key = p_key;
+		task.key_hash = p_key_hash;
+		task.queued_usec = ShaderCompilationSchedulerRD::tasks_queued(1);
+
+		QueuedCompilation queued;
+		queued.task_id = pool->add_template_task(this, &PipelineHashMapRD::_compile_pipeline, task, p_high_priority, "PipelineCompilation");
+		queued.key = p_key;
+		compilation_tasks.insert(p_key_hash, queued);
 	}
 
 	void wait_for_pipeline(uint32_t p_key_hash) {
 		WorkerThreadPool::TaskID task_id_to_wait = WorkerThreadPool::INVALID_TASK_ID;
+		bool create_on_this_thread = false;
+		Key key;
 
 		{
 			MutexLock local_lock(local_mutex);
@@ -154,16 +233,30 @@ public:
 				return;
 			}
 
-			HashMap<uint32_t, WorkerThreadPool::TaskID>::Iterator task_it = compilation_tasks.find(p_key_hash);
+			typename HashMap<uint32_t, QueuedCompilation>::Iterator task_it = compilation_tasks.find(p_key_hash);
 			if (task_it != compilation_tasks.end()) {
-				// Wait for and remove the compilation task if it exists.
-				task_id_to_wait = task_it->value;
+				if (compilation_started.has(p_key_hash)) {
+					// Wait for the compilation task if it's already running.
+					task_id_to_wait = task_it->value.task_id;
+				} else {
+					// The task may be stuck behind background compilations, don't wait for the scheduler to reach it.
+					compilation_started.insert(p_key_hash);
+					superseded_tasks.push_back(task_it->value.task_id);
+					key = task_it->value.key;
+					create_on_this_thread = true;
+				}
+
 				compilation_tasks.remove(task_it);
 			}
 		}
 
-		if (task_id_to_wait != WorkerThreadPool::INVALID_TASK_ID) {
-			WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id_to_wait);
+		if (create_on_this_thread) {
+			(creation_object->*creation_function)(key);
+		} else if (task_id_to_wait != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+			if (pool != nullptr) {
+				pool->wait_for_task_completion(task_id_to_wait);
+			}
 		}
 	}
 
@@ -202,11 +295,23 @@ public:
 		}
 	}
 
-	// Delete all cached pipelines. Can stall if background compilation is in progress.
+	// Delete all cached pipelines. Compilations that didn't start yet are cancelled, but it can stall if one is in progress.
 	void clear_pipelines() {
+		{
+			MutexLock local_lock(local_mutex);
+			compilation_cancelled = true;
+		}
+
 		_wait_for_all_pipelines();
 		_add_new_pipelines_to_map();
 
+		{
+			MutexLock local_lock(local_mutex);
+			compilation_cancelled = false;
+			compilation_started.clear();
+			compilation_tasks.clear();
+		}
+
 		for (KeyValue<uint32_t, RID> entry : hash_map) {
 			RD::get_singleton()->free(entry.value);
 		}
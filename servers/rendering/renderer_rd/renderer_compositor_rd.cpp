@@ -35,6 +35,7 @@
 
 #include "servers/rendering/renderer_rd/forward_clustered/render_forward_clustered.h"
 #include "servers/rendering/renderer_rd/forward_mobile/render_forward_mobile.h"
+#include "servers/rendering/renderer_rd/shader_compilation_scheduler_rd.h"
 
 void RendererCompositorRD::blit_render_targets_to_screen(DisplayServer::WindowID p_screen, const BlitToScreen *p_render_targets, int p_amount) {
 	Error err = RD::get_singleton()->screen_prepare_for_drawing(p_screen);
@@ -270,6 +271,8 @@ RendererCompositorRD::RendererCompositorRD() {
 	uniform_set_cache = memnew(UniformSetCacheRD);
 	framebuffer_cache = memnew(FramebufferCacheRD);
 
+	ShaderCompilationSchedulerRD::initialize(GLOBAL_GET("rendering/shader_compiler/compilation/max_threads"), GLOBAL_GET("rendering/shader_compiler/compilation/background_thread_ratio"));
+
 	{
 		String shader_cache_dir = Engine::get_singleton()->get_shader_cache_path();
 		if (shader_cache_dir.is_empty()) {
@@ -299,6 +302,7 @@ RendererCompositorRD::RendererCompositorRD() {
 					bool strip_debug = GLOBAL_GET("rendering/shader_compiler/shader_cache/strip_debug");
 
 					ShaderRD::set_shader_cache_dir(shader_cache_dir);
+					ShaderCompiler::set_cache_dir(shader_cache_dir.path_join("shader_compiler"));
 					ShaderRD::set_shader_cache_save_compressed(compress);
 					ShaderRD::set_shader_cache_save_compressed_zstd(use_zstd);
 					ShaderRD::set_shader_cache_save_debug(!strip_debug);
@@ -343,4 +347,6 @@ RendererCompositorRD::~RendererCompositorRD() {
 	memdelete(uniform_set_cache);
 	memdelete(framebuffer_cache);
 	ShaderRD::set_shader_cache_dir(String());
+	ShaderCompiler::set_cache_dir(String());
+	ShaderCompilationSchedulerRD::finalize();
 }
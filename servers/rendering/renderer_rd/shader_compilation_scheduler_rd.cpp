@@ -0,0 +1,99 @@
+/**************************************************************************/
+/*  shader_compilation_scheduler_rd.cpp                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "shader_compilation_scheduler_rd.h"
+
+#include "core/os/os.h"
+
+Mutex ShaderCompilationSchedulerRD::mutex;
+WorkerThreadPool *ShaderCompilationSchedulerRD::pool = nullptr;
+bool ShaderCompilationSchedulerRD::finalized = false;
+int ShaderCompilationSchedulerRD::thread_count = -1;
+float ShaderCompilationSchedulerRD::background_thread_ratio = 0.3;
+SafeNumeric<uint32_t> ShaderCompilationSchedulerRD::queue_depth;
+uint64_t ShaderCompilationSchedulerRD::average_latency_usec = 0;
+
+void ShaderCompilationSchedulerRD::initialize(int p_thread_count, float p_background_thread_ratio) {
+	MutexLock lock(mutex);
+	ERR_FAIL_COND_MSG(pool != nullptr, "The shader compilation scheduler must be initialized before any compilation is queued.");
+	finalized = false;
+	thread_count = p_thread_count;
+	background_thread_ratio = CLAMP(p_background_thread_ratio, 0.0f, 1.0f);
+}
+
+void ShaderCompilationSchedulerRD::finalize() {
+	WorkerThreadPool *old_pool = nullptr;
+	{
+		MutexLock lock(mutex);
+		old_pool = pool;
+		pool = nullptr;
+		finalized = true;
+		average_latency_usec = 0;
+	}
+
+	// Finish outside of the lock, tasks still running need it to report that they started.
+	if (old_pool != nullptr) {
+		old_pool->finish();
+		memdelete(old_pool);
+	}
+	queue_depth.set(0);
+}
+
+WorkerThreadPool *ShaderCompilationSchedulerRD::get_pool() {
+	MutexLock lock(mutex);
+	if (pool == nullptr && !finalized) {
+		pool = memnew(WorkerThreadPool(false));
+		pool->init(thread_count, background_thread_ratio);
+	}
+	return pool;
+}
+
+uint64_t ShaderCompilationSchedulerRD::tasks_queued(uint32_t p_count) {
+	queue_depth.add(p_count);
+	return OS::get_singleton()->get_ticks_usec();
+}
+
+void ShaderCompilationSchedulerRD::task_started(uint64_t p_queued_usec) {
+	queue_depth.decrement();
+
+	uint64_t latency = OS::get_singleton()->get_ticks_usec() - p_queued_usec;
+	MutexLock lock(mutex);
+	// Smooth it out a bit, single compilations are too noisy to be useful as a monitor.
+	average_latency_usec = average_latency_usec == 0 ? latency : (average_latency_usec * 7 + latency) / 8;
+}
+
+uint32_t ShaderCompilationSchedulerRD::get_queue_depth() {
+	return queue_depth.get();
+}
+
+uint64_t ShaderCompilationSchedulerRD::get_average_latency_usec() {
+	MutexLock lock(mutex);
+	return average_latency_usec;
+}
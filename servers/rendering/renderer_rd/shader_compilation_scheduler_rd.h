@@ -0,0 +1,65 @@
+/**************************************************************************/
+/*  shader_compilation_scheduler_rd.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/safe_refcount.h"
+
+// Shader variant and pipeline compilations run on their own thread pool, so they never compete
+// with gameplay tasks on the main one. Compilations the renderer is about to wait on are queued
+// as high priority; speculative ones (e.g. pipelines precompiled when a mesh is loaded) are
+// queued as low priority and only get the share of the threads given by the background ratio.
+class ShaderCompilationSchedulerRD {
+	static Mutex mutex;
+	static WorkerThreadPool *pool;
+	static bool finalized;
+	static int thread_count;
+	static float background_thread_ratio;
+
+	static SafeNumeric<uint32_t> queue_depth;
+	static uint64_t average_latency_usec;
+
+public:
+	static void initialize(int p_thread_count, float p_background_thread_ratio);
+	static void finalize();
+
+	// The pool is created on first use. Returns null after finalize(), which already waited for every queued task.
+	static WorkerThreadPool *get_pool();
+
+	// Every queued compilation must report when it starts running, even if it ends up doing nothing,
+	// to keep the queue depth and latency monitors accurate. Returns the time to pass to task_started().
+	static uint64_t tasks_queued(uint32_t p_count);
+	static void task_started(uint64_t p_queued_usec);
+
+	static uint32_t get_queue_depth();
+	static uint64_t get_average_latency_usec();
+};
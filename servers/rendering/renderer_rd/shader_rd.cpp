@@ -34,6 +34,7 @@
 #include "core/io/file_access.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/version.h"
+#include "servers/rendering/renderer_rd/shader_compilation_scheduler_rd.h"
 #include "servers/rendering/rendering_device.h"
 #include "servers/rendering/shader_include_db.h"
 
@@ -170,13 +171,7 @@ RID ShaderRD::version_create() {
 	//initialize() was never called
 	ERR_FAIL_COND_V(group_to_variant_map.is_empty(), RID());
 
-	Version version;
-	version.dirty = true;
-	version.valid = false;
-	version.initialize_needed = true;
-	version.variants.clear();
-	version.variant_data.clear();
-	return version_owner.make_rid(version);
+	return version_owner.make_rid();
 }
 
 void ShaderRD::_initialize_version(Version *p_version) {
@@ -191,7 +186,7 @@ void ShaderRD::_initialize_version(Version *p_version) {
 }
 
 void ShaderRD::_clear_version(Version *p_version) {
-	_compile_ensure_finished(p_version);
+	_compile_cancel(p_version);
 
 	// Clear versions if they exist.
 	if (!p_version->variants.is_empty()) {
@@ -260,12 +255,18 @@ void ShaderRD::_build_variant_code(StringBuilder &builder, uint32_t p_variant, c
 }
 
 void ShaderRD::_compile_variant(uint32_t p_variant, CompileData p_data) {
+	ShaderCompilationSchedulerRD::task_started(p_data.queued_usec);
+
 	uint32_t variant = group_to_variant_map[p_data.group][p_variant];
 
 	if (!variants_enabled[variant]) {
 		return; // Variant is disabled, return.
 	}
 
+	if (p_data.version->compilation_cancelled.is_set()) {
+		return; // The version is being freed or recompiled, return.
+	}
+
 	Vector<RD::ShaderStageSPIRVData> stages;
 
 	String error;
@@ -550,11 +551,16 @@ void ShaderRD::_compile_version_start(Version *p_version, int p_group) {
 	}
 #endif
 
+	WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+	ERR_FAIL_NULL_MSG(pool, "Can't compile a shader version after the shader compilation scheduler was finalized.");
+
 	CompileData compile_data;
 	compile_data.version = p_version;
 	compile_data.group = p_group;
+	compile_data.queued_usec = ShaderCompilationSchedulerRD::tasks_queued(group_to_variant_map[p_group].size());
 
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_named_pool(SNAME("ShaderCompilationPool"))->add_template_group_task(this, &ShaderRD::_compile_variant, compile_data, group_to_variant_map[p_group].size(), -1, true, SNAME("ShaderCompilation"));
+	// Variants are waited on as soon as the version is used, so they are always high priority.
+	WorkerThreadPool::GroupID group_task = pool->add_template_group_task(this, &ShaderRD::_compile_variant, compile_data, group_to_variant_map[p_group].size(), -1, true, SNAME("ShaderCompilation"));
 	p_version->group_compilation_tasks.write[p_group] = group_task;
 }
 
@@ -563,7 +569,11 @@ void ShaderRD::_compile_version_end(Version *p_version, int p_group) {
 		return;
 	}
 	WorkerThreadPool::GroupID group_task = p_version->group_compilation_tasks[p_group];
-	WorkerThreadPool::get_named_pool(SNAME("ShaderCompilationPool"))->wait_for_group_task_completion(group_task);
+	WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+	if (pool != nullptr) {
+		// Otherwise the scheduler was finalized, which finished every task.
+		pool->wait_for_group_task_completion(group_task);
+	}
 	p_version->group_compilation_tasks.write[p_group] = 0;
 
 	bool all_valid = true;
@@ -610,13 +620,20 @@ void ShaderRD::_compile_ensure_finished(Version *p_version) {
 	}
 }
 
+void ShaderRD::_compile_cancel(Version *p_version) {
+	// Variants that are already compiling can't be interrupted, but the queued ones are skipped.
+	p_version->compilation_cancelled.set();
+	_compile_ensure_finished(p_version);
+	p_version->compilation_cancelled.clear();
+}
+
 void ShaderRD::version_set_code(RID p_version, const HashMap<String, String> &p_code, const String &p_uniforms, const String &p_vertex_globals, const String &p_fragment_globals, const Vector<String> &p_custom_defines) {
 	ERR_FAIL_COND(is_compute);
 
 	Version *version = version_owner.get_or_null(p_version);
 	ERR_FAIL_NULL(version);
 
-	_compile_ensure_finished(version);
+	_compile_cancel(version);
 
 	version->vertex_globals = p_vertex_globals.utf8();
 	version->fragment_globals = p_fragment_globals.utf8();
@@ -651,7 +668,7 @@ void ShaderRD::version_set_compute_code(RID p_version, const HashMap<String, Str
 	Version *version = version_owner.get_or_null(p_version);
 	ERR_FAIL_NULL(version);
 
-	_compile_ensure_finished(version);
+	_compile_cancel(version);
 
 	version->compute_globals = p_compute_globals.utf8();
 	version->uniforms = p_uniforms.utf8();
@@ -751,7 +768,7 @@ bool ShaderRD::shader_cache_cleanup_on_start = false;
 ShaderRD::ShaderRD() {
 	// Do not feel forced to use this, in most cases it makes little to no difference.
 	bool use_32_threads = false;
-	if (RD::get_singleton()->get_device_vendor_name() == "NVIDIA") {
+	if (RD::get_singleton() != nullptr && RD::get_singleton()->get_device_vendor_name() == "NVIDIA") { // Tests create shaders without a device.
 		use_32_threads = true;
 	}
 	String base_compute_define_text;
@@ -38,6 +38,8 @@
 #include "servers/rendering_server.h"
 
 class ShaderRD {
+	friend class TestShaderRDInternalsAccessor;
+
 public:
 	struct VariantDefine {
 		int group = 0;
@@ -70,13 +72,15 @@ private:
 		HashMap<StringName, CharString> code_sections;
 		Vector<CharString> custom_defines;
 		Vector<WorkerThreadPool::GroupID> group_compilation_tasks;
+		// Set while the version's compilations are obsolete, so variants that didn't start yet are skipped.
+		SafeFlag compilation_cancelled;
 
 		Vector<Vector<uint8_t>> variant_data;
 		Vector<RID> variants;
 
-		bool valid;
-		bool dirty;
-		bool initialize_needed;
+		bool valid = false;
+		bool dirty = true;
+		bool initialize_needed = true;
 	};
 
 	Mutex variant_set_mutex;
@@ -84,6 +88,7 @@ private:
 	struct CompileData {
 		Version *version;
 		int group = 0;
+		uint64_t queued_usec = 0;
 	};
 
 	void _compile_variant(uint32_t p_variant, CompileData p_data);
@@ -93,6 +98,7 @@ private:
 	void _compile_version_start(Version *p_version, int p_group);
 	void _compile_version_end(Version *p_version, int p_group);
 	void _compile_ensure_finished(Version *p_version);
+	void _compile_cancel(Version *p_version);
 	void _allocate_placeholders(Version *p_version, int p_group);
 
 	RID_Owner<Version> version_owner;
@@ -34,6 +34,7 @@
 #include "light_storage.h"
 #include "mesh_storage.h"
 #include "particles_storage.h"
+#include "servers/rendering/renderer_rd/shader_compilation_scheduler_rd.h"
 #include "texture_storage.h"
 
 using namespace RendererRD;
@@ -306,6 +307,10 @@ uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
 		return buffer_mem_cache;
 	} else if (p_info == RS::RENDERING_INFO_VIDEO_MEM_USED) {
 		return total_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_SHADER_COMPILATION_QUEUE_DEPTH) {
+		return ShaderCompilationSchedulerRD::get_queue_depth();
+	} else if (p_info == RS::RENDERING_INFO_SHADER_COMPILATION_LATENCY) {
+		return ShaderCompilationSchedulerRD::get_average_latency_usec();
 	}
 	return 0;
 }
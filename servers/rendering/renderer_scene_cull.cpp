@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "renderer_scene_occlusion_cull_software.h"
 #include "rendering_light_culler.h"
 #include "rendering_server_default.h"
 
@@ -40,6 +41,11 @@
 #include "scene/main/node.h"
 #endif
 
+#if !defined(REAL_T_IS_DOUBLE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SCENE_CULL_SSE2
+#include <emmintrin.h>
+#endif
+
 /* HALTON SEQUENCE */
 
 #ifndef _3D_DISABLED
@@ -164,6 +170,34 @@ void RendererSceneCull::occluder_set_mesh(RID p_occluder, const PackedVector3Arr
 
 /* SCENARIO API */
 
+void RendererSceneCull::_scenario_update_instance_cluster(Scenario *p_scenario, uint32_t p_index) {
+	// Keep the clusters in sync with instance_aabbs. Passing the index of an instance
+	// that was just popped from the arrays releases its slot.
+	const uint32_t instance_count = p_scenario->instance_aabbs.size();
+	p_scenario->instance_clusters.resize((instance_count + InstanceBoundsCluster::MASK) >> InstanceBoundsCluster::SHIFT);
+
+	const uint32_t cluster_index = p_index >> InstanceBoundsCluster::SHIFT;
+	if (cluster_index >= p_scenario->instance_clusters.size()) {
+		return;
+	}
+
+	InstanceBoundsCluster &cluster = p_scenario->instance_clusters[cluster_index];
+	const uint32_t slot = p_index & InstanceBoundsCluster::MASK;
+	cluster.dirty = true;
+
+	if (p_index >= instance_count) {
+		cluster.ignore_culling_mask &= ~(1u << slot);
+		return;
+	}
+
+	cluster.set_instance_bounds(slot, p_scenario->instance_aabbs[p_index]);
+	if (p_scenario->instance_data[p_index].flags & InstanceData::FLAG_IGNORE_ALL_CULLING) {
+		cluster.ignore_culling_mask |= 1u << slot;
+	} else {
+		cluster.ignore_culling_mask &= ~(1u << slot);
+	}
+}
+
 void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 	RendererSceneCull *self = (RendererSceneCull *)singleton;
 	Instance *A = p_A;
@@ -1230,6 +1264,7 @@ void RendererSceneCull::instance_set_ignore_culling(RID p_instance, bool p_enabl
 		} else {
 			idata.flags &= ~InstanceData::FLAG_IGNORE_ALL_CULLING;
 		}
+		_scenario_update_instance_cluster(instance->scenario, instance->array_index);
 	}
 }
 
@@ -1904,6 +1939,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 
 		p_instance->scenario->instance_data.push_back(idata);
 		p_instance->scenario->instance_aabbs.push_back(InstanceBounds(p_instance->transformed_aabb));
+		_scenario_update_instance_cluster(p_instance->scenario, p_instance->array_index);
 		_update_instance_visibility_dependencies(p_instance);
 	} else {
 		if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
@@ -1912,6 +1948,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 			p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb);
 		}
 		p_instance->scenario->instance_aabbs[p_instance->array_index] = InstanceBounds(p_instance->transformed_aabb);
+		_scenario_update_instance_cluster(p_instance->scenario, p_instance->array_index);
 	}
 
 	if (p_instance->visibility_index != -1) {
@@ -2002,6 +2039,7 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 		swapped_instance->array_index = p_instance->array_index; //swap
 		p_instance->scenario->instance_data[p_instance->array_index] = p_instance->scenario->instance_data[swap_with_index];
 		p_instance->scenario->instance_aabbs[p_instance->array_index] = p_instance->scenario->instance_aabbs[swap_with_index];
+		_scenario_update_instance_cluster(p_instance->scenario, p_instance->array_index);
 
 		if (swapped_instance->visibility_index != -1) {
 			swapped_instance->scenario->instance_visibility[swapped_instance->visibility_index].array_index = swapped_instance->array_index;
@@ -2018,6 +2056,7 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 	// pop last
 	p_instance->scenario->instance_data.pop_back();
 	p_instance->scenario->instance_aabbs.pop_back();
+	_scenario_update_instance_cluster(p_instance->scenario, swap_with_index);
 
 	//uninitialize
 	p_instance->array_index = -1;
@@ -2874,11 +2913,114 @@ bool RendererSceneCull::_visibility_parent_check(const CullData &p_cull_data, co
 	return ((parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK) == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE) || (parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 }
 
+void RendererSceneCull::InstanceBoundsCluster::update_cluster_bounds(uint32_t p_count) {
+	for (uint32_t i = 0; i < 3; i++) {
+		real_t min = bounds[i][0];
+		real_t max = bounds[i + 3][0];
+		for (uint32_t j = 1; j < p_count; j++) {
+			min = MIN(min, bounds[i][j]);
+			max = MAX(max, bounds[i + 3][j]);
+		}
+		cluster_bounds.bounds[i] = min;
+		cluster_bounds.bounds[i + 3] = max;
+	}
+	dirty = false;
+}
+
+uint32_t RendererSceneCull::InstanceBoundsCluster::cull(const Frustum &p_frustum, uint32_t p_count) const {
+	const uint32_t count_mask = p_count == SIZE ? 0xFFFFFFFF : ((1u << p_count) - 1);
+
+	// Since the union contains every instance, the plane distance of the union's nearest corner
+	// is a lower bound, and the one of its farthest corner an upper bound, for every instance.
+	bool fully_inside = true;
+	for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+		const Plane &plane = p_frustum.planes_ptr[i];
+		const uint32_t *signs = p_frustum.plane_signs_ptr[i].signs;
+
+		Vector3 nearest(cluster_bounds.bounds[signs[0]], cluster_bounds.bounds[signs[1]], cluster_bounds.bounds[signs[2]]);
+		if (plane.distance_to(nearest) >= 0.0) {
+			return 0;
+		}
+		Vector3 farthest(cluster_bounds.bounds[(signs[0] + 3) % 6], cluster_bounds.bounds[(signs[1] + 3) % 6], cluster_bounds.bounds[(signs[2] + 3) % 6]);
+		if (plane.distance_to(farthest) >= 0.0) {
+			fully_inside = false;
+		}
+	}
+
+	if (fully_inside) {
+		return count_mask;
+	}
+
+	// Same test as InstanceBounds::in_frustum(), four instances at a time.
+	uint32_t mask = 0;
+	for (uint32_t from = 0; from < p_count; from += 4) {
+#ifdef SCENE_CULL_SSE2
+		__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+			const Plane &plane = p_frustum.planes_ptr[i];
+			const uint32_t *signs = p_frustum.plane_signs_ptr[i].signs;
+
+			__m128 distance = _mm_mul_ps(_mm_set1_ps(plane.normal.x), _mm_loadu_ps(&bounds[signs[0]][from]));
+			distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.normal.y), _mm_loadu_ps(&bounds[signs[1]][from])));
+			distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.normal.z), _mm_loadu_ps(&bounds[signs[2]][from])));
+			distance = _mm_sub_ps(distance, _mm_set1_ps(plane.d));
+			inside = _mm_and_ps(inside, _mm_cmplt_ps(distance, _mm_setzero_ps()));
+			if (_mm_movemask_ps(inside) == 0) {
+				break;
+			}
+		}
+		mask |= uint32_t(_mm_movemask_ps(inside)) << from;
+#else
+		uint32_t inside = 0xF;
+		for (uint32_t i = 0; i < p_frustum.plane_count && inside; i++) {
+			const Plane &plane = p_frustum.planes_ptr[i];
+			const uint32_t *signs = p_frustum.plane_signs_ptr[i].signs;
+
+			for (uint32_t j = 0; j < 4; j++) {
+				Vector3 nearest(bounds[signs[0]][from + j], bounds[signs[1]][from + j], bounds[signs[2]][from + j]);
+				if (plane.distance_to(nearest) >= 0.0) {
+					inside &= ~(1u << j);
+				}
+			}
+		}
+		mask |= inside << from;
+#endif
+	}
+
+	return mask & count_mask;
+}
+
+bool RendererSceneCull::_scene_cull_cluster(CullData &cull_data, uint64_t p_index, uint32_t &r_frustum_mask, uint32_t r_cascade_masks[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS][RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES]) {
+	const uint32_t cluster_index = p_index >> InstanceBoundsCluster::SHIFT;
+	const uint32_t cluster_count = MIN(cull_data.scenario->instance_aabbs.size() - (uint64_t(cluster_index) << InstanceBoundsCluster::SHIFT), uint64_t(InstanceBoundsCluster::SIZE));
+	InstanceBoundsCluster &cluster = cull_data.scenario->instance_clusters[cluster_index];
+
+	// Threads cull whole clusters, so this can't race with another thread.
+	if (cluster.dirty) {
+		cluster.update_cluster_bounds(cluster_count);
+	}
+
+	r_frustum_mask = cluster.cull(cull_data.cull->frustum, cluster_count);
+	uint32_t visible_mask = r_frustum_mask | cluster.ignore_culling_mask;
+
+	for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
+		for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
+			r_cascade_masks[j][k] = cluster.cull(cull_data.cull->shadows[j].cascades[k].frustum, cluster_count);
+			visible_mask |= r_cascade_masks[j][k];
+		}
+	}
+
+	// Instances outside every frustum can only be picked up by SDFGI regions.
+	return visible_mask != 0 || cull_data.cull->sdfgi.region_count > 0;
+}
+
 void RendererSceneCull::_scene_cull_threaded(uint32_t p_thread, CullData *cull_data) {
+	// Split on cluster boundaries, so each cluster is culled by a single thread.
 	uint32_t cull_total = cull_data->scenario->instance_data.size();
+	uint32_t cluster_total = (cull_total + InstanceBoundsCluster::MASK) >> InstanceBoundsCluster::SHIFT;
 	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
-	uint32_t cull_from = p_thread * cull_total / total_threads;
-	uint32_t cull_to = (p_thread + 1 == total_threads) ? cull_total : ((p_thread + 1) * cull_total / total_threads);
+	uint32_t cull_from = (p_thread * cluster_total / total_threads) << InstanceBoundsCluster::SHIFT;
+	uint32_t cull_to = (p_thread + 1 == total_threads) ? cull_total : (((p_thread + 1) * cluster_total / total_threads) << InstanceBoundsCluster::SHIFT);
 
 	_scene_cull(*cull_data, scene_cull_result_threads[p_thread], cull_from, cull_to);
 }
@@ -2895,7 +3037,20 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 	Transform3D inv_cam_transform = cull_data.cam_transform.inverse();
 	float z_near = cull_data.camera_matrix->get_z_near();
 
+	uint32_t frustum_mask = 0;
+	uint32_t cascade_masks[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS][RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+
 	for (uint64_t i = p_from; i < p_to; i++) {
+		const uint32_t cluster_slot = i & InstanceBoundsCluster::MASK;
+		if (cluster_slot == 0 || i == p_from) {
+			if (!_scene_cull_cluster(cull_data, i, frustum_mask, cascade_masks)) {
+				// Nothing in this cluster is visible, skip to the next one.
+				i |= InstanceBoundsCluster::MASK;
+				continue;
+			}
+		}
+		const uint32_t cluster_bit = 1u << cluster_slot;
+
 		bool mesh_visible = false;
 
 		InstanceData &idata = cull_data.scenario->instance_data[i];
@@ -2904,14 +3059,14 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 #define HIDDEN_BY_VISIBILITY_CHECKS (visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE || visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN)
 #define LAYER_CHECK (cull_data.visible_layers & idata.layer_mask)
-#define IN_FRUSTUM(f) (cull_data.scenario->instance_aabbs[i].in_frustum(f))
+#define IN_FRUSTUM(m) ((m) & cluster_bit)
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, cull_data.scenario->instance_data[i].occlusion_timeout))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && IN_FRUSTUM(frustum_mask) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RS::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -3115,7 +3270,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 					continue;
 				}
 				for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
-					if (IN_FRUSTUM(cull_data.cull->shadows[j].cascades[k].frustum) && VIS_CHECK) {
+					if (IN_FRUSTUM(cascade_masks[j][k]) && VIS_CHECK) {
 						uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 
 						if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS && (LAYER_CHECK & cull_data.cull->shadows[j].caster_mask)) {
@@ -4252,6 +4407,7 @@ bool RendererSceneCull::free(RID p_rid) {
 			instance_set_scenario(scenario->instances.first()->self()->self, RID());
 		}
 		scenario->instance_aabbs.reset();
+		scenario->instance_clusters.reset();
 		scenario->instance_data.reset();
 		scenario->instance_visibility.reset();
 
@@ -4455,7 +4611,7 @@ RendererSceneCull::RendererSceneCull() {
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
 	RendererSceneOcclusionCull::HZBuffer::occlusion_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
 
-	dummy_occlusion_culling = memnew(RendererSceneOcclusionCull);
+	default_occlusion_culling = memnew(RendererSceneOcclusionCullSoftware);
 
 	light_culler = memnew(RenderingLightCuller);
 
@@ -4481,8 +4637,8 @@ RendererSceneCull::~RendererSceneCull() {
 	}
 	scene_cull_result_threads.clear();
 
-	if (dummy_occlusion_culling) {
-		memdelete(dummy_occlusion_culling);
+	if (default_occlusion_culling) {
+		memdelete(default_occlusion_culling);
 	}
 
 	if (light_culler) {
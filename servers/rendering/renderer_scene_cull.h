@@ -125,7 +125,7 @@ public:
 
 	/* VISIBILITY NOTIFIER API */
 
-	RendererSceneOcclusionCull *dummy_occlusion_culling = nullptr;
+	RendererSceneOcclusionCull *default_occlusion_culling = nullptr; // Replaced by the raycast module when Embree is available.
 
 	/* SCENARIO API */
 
@@ -250,6 +250,32 @@ public:
 		}
 	};
 
+	struct InstanceBoundsCluster {
+		// Bounds of SIZE consecutive instances stored as structure of arrays,
+		// so that several instances can be tested against a plane at once.
+		// The union of all bounds allows accepting or rejecting the whole
+		// cluster with a single test per plane.
+
+		static constexpr uint32_t SHIFT = 5;
+		static constexpr uint32_t SIZE = 1 << SHIFT;
+		static constexpr uint32_t MASK = SIZE - 1;
+
+		real_t bounds[6][SIZE] = {};
+		InstanceBounds cluster_bounds;
+		uint32_t ignore_culling_mask = 0;
+		bool dirty = true;
+
+		void set_instance_bounds(uint32_t p_slot, const InstanceBounds &p_bounds) {
+			for (uint32_t i = 0; i < 6; i++) {
+				bounds[i][p_slot] = p_bounds.bounds[i];
+			}
+			dirty = true;
+		}
+		void update_cluster_bounds(uint32_t p_count);
+		// Returns a bit for every one of the first p_count instances that passes InstanceBounds::in_frustum().
+		uint32_t cull(const Frustum &p_frustum, uint32_t p_count) const;
+	};
+
 	struct InstanceVisibilityNotifierData;
 
 	struct InstanceData {
@@ -351,6 +377,7 @@ public:
 		PagedArray<InstanceBounds> instance_aabbs;
 		PagedArray<InstanceData> instance_data;
 		VisibilityArray instance_visibility;
+		LocalVector<InstanceBoundsCluster> instance_clusters; // Mirrors instance_aabbs, InstanceBoundsCluster::SIZE instances per cluster.
 
 		Scenario() {
 			indexers[INDEXER_GEOMETRY].set_index(INDEXER_GEOMETRY);
@@ -363,6 +390,8 @@ public:
 
 	mutable RID_Owner<Scenario, true> scenario_owner;
 
+	static void _scenario_update_instance_cluster(Scenario *p_scenario, uint32_t p_index);
+
 	static void _instance_pair(Instance *p_A, Instance *p_B);
 	static void _instance_unpair(Instance *p_A, Instance *p_B);
 
@@ -1169,6 +1198,7 @@ public:
 
 	void _scene_cull_threaded(uint32_t p_thread, CullData *cull_data);
 	void _scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to);
+	_FORCE_INLINE_ bool _scene_cull_cluster(CullData &cull_data, uint64_t p_index, uint32_t &r_frustum_mask, uint32_t r_cascade_masks[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS][RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES]);
 	static void _scene_particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis);
 	_FORCE_INLINE_ bool _visibility_parent_check(const CullData &p_cull_data, const InstanceData &p_instance_data);
 
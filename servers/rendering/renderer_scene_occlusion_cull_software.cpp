@@ -0,0 +1,526 @@
+/**************************************************************************/
+/*  renderer_scene_occlusion_cull_software.cpp                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "renderer_scene_occlusion_cull_software.h"
+
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OCCLUSION_CULL_SSE2
+#include <emmintrin.h>
+#endif
+
+void RendererSceneOcclusionCullSoftware::SoftwareHZBuffer::clear() {
+	HZBuffer::clear();
+
+	tile_grid_size = Size2i();
+	tile_triangles.clear();
+	triangles.clear();
+}
+
+void RendererSceneOcclusionCullSoftware::SoftwareHZBuffer::resize(const Size2i &p_size) {
+	if (p_size == Size2i()) {
+		clear();
+		return;
+	}
+
+	if (!sizes.is_empty() && p_size == sizes[0]) {
+		return; // Size didn't change
+	}
+
+	HZBuffer::resize(p_size);
+
+	tile_grid_size = Size2i((p_size.x + TILE_WIDTH - 1) / TILE_WIDTH, (p_size.y + TILE_HEIGHT - 1) / TILE_HEIGHT);
+	tile_triangles.resize(tile_grid_size.x * tile_grid_size.y);
+}
+
+void RendererSceneOcclusionCullSoftware::SoftwareHZBuffer::bin_triangles(const uint32_t *p_offsets, const uint32_t *p_counts, uint32_t p_instance_count) {
+	for (LocalVector<uint32_t> &tile : tile_triangles) {
+		tile.clear();
+	}
+
+	const Size2i &buffer_size = sizes[0];
+
+	for (uint32_t i = 0; i < p_instance_count; i++) {
+		for (uint32_t j = p_offsets[i]; j < p_offsets[i] + p_counts[i]; j++) {
+			const Triangle &triangle = triangles[j];
+
+			// Pixels are sampled at their centers.
+			const int px_min = MAX(0, int(Math::ceil(triangle.min_x - 0.5f)));
+			const int py_min = MAX(0, int(Math::ceil(triangle.min_y - 0.5f)));
+			const int px_max = MIN(buffer_size.x - 1, int(Math::floor(triangle.max_x - 0.5f)));
+			const int py_max = MIN(buffer_size.y - 1, int(Math::floor(triangle.max_y - 0.5f)));
+			if (px_min > px_max || py_min > py_max) {
+				continue;
+			}
+
+			for (int ty = py_min / TILE_HEIGHT; ty <= py_max / TILE_HEIGHT; ty++) {
+				for (int tx = px_min / TILE_WIDTH; tx <= px_max / TILE_WIDTH; tx++) {
+					tile_triangles[ty * tile_grid_size.x + tx].push_back(j);
+				}
+			}
+		}
+	}
+}
+
+void RendererSceneOcclusionCullSoftware::SoftwareHZBuffer::rasterize(const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	debug_tex_range = p_cam_projection.get_z_far();
+
+	RasterData rd;
+	rd.triangles = triangles.ptr();
+	rd.inv_projection = p_cam_projection.inverse();
+	rd.orthogonal = p_cam_orthogonal;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SoftwareHZBuffer::_rasterize_tile, &rd, tile_triangles.size(), -1, true, SNAME("OcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void RendererSceneOcclusionCullSoftware::SoftwareHZBuffer::_rasterize_tile(uint32_t p_tile, const RasterData *p_data) {
+	const Size2i &buffer_size = sizes[0];
+	const int tile_x = (p_tile % tile_grid_size.x) * TILE_WIDTH;
+	const int tile_y = (p_tile / tile_grid_size.x) * TILE_HEIGHT;
+	const int tile_w = MIN(TILE_WIDTH, buffer_size.x - tile_x);
+	const int tile_h = MIN(TILE_HEIGHT, buffer_size.y - tile_y);
+
+	float depth[TILE_WIDTH * TILE_HEIGHT];
+	float depth_scale[TILE_WIDTH * TILE_HEIGHT];
+
+	for (int i = 0; i < TILE_WIDTH * TILE_HEIGHT; i++) {
+		depth[i] = FLT_MAX;
+	}
+
+	const LocalVector<uint32_t> &tile = tile_triangles[p_tile];
+	if (!tile.is_empty()) {
+		// Depth is stored as the distance to the camera, like _is_occluded() expects,
+		// so scale the view depth by the length of each pixel's ray per unit of depth.
+		for (int y = 0; y < TILE_HEIGHT; y++) {
+			for (int x = 0; x < TILE_WIDTH; x++) {
+				float scale = 1.0f;
+				if (!p_data->orthogonal) {
+					const float ndc_x = (tile_x + x + 0.5f) / buffer_size.x * 2.0f - 1.0f;
+					const float ndc_y = (tile_y + y + 0.5f) / buffer_size.y * 2.0f - 1.0f;
+					const Vector4 view = p_data->inv_projection.xform(Vector4(ndc_x, ndc_y, 1.0, 1.0));
+					const Vector3 ray = Vector3(view.x, view.y, view.z) / view.w;
+					scale = ray.length() / MAX(-ray.z, (real_t)CMP_EPSILON);
+				}
+				depth_scale[y * TILE_WIDTH + x] = scale;
+			}
+		}
+	}
+
+	for (const uint32_t &index : tile) {
+		const Triangle &triangle = p_data->triangles[index];
+
+		const int px_min = MAX(0, int(Math::ceil(triangle.min_x - 0.5f)) - tile_x);
+		const int py_min = MAX(0, int(Math::ceil(triangle.min_y - 0.5f)) - tile_y);
+		const int px_max = MIN(tile_w - 1, int(Math::floor(triangle.max_x - 0.5f)) - tile_x);
+		const int py_max = MIN(tile_h - 1, int(Math::floor(triangle.max_y - 0.5f)) - tile_y);
+
+		for (int y = py_min; y <= py_max; y++) {
+			const float fy = tile_y + y + 0.5f;
+			float row_edges[3];
+			for (int e = 0; e < 3; e++) {
+				row_edges[e] = triangle.edges[e][1] * fy + triangle.edges[e][2];
+			}
+			const float row_inv_w = triangle.inv_w[1] * fy + triangle.inv_w[2];
+			const float row_depth_w = triangle.depth_w[1] * fy + triangle.depth_w[2];
+			float *depth_row = &depth[y * TILE_WIDTH];
+			const float *scale_row = &depth_scale[y * TILE_WIDTH];
+
+#ifdef OCCLUSION_CULL_SSE2
+			// Four pixels at a time. Groups are aligned within the tile, so they never cross a row.
+			const __m128 pixel_offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+			const __m128 zero = _mm_setzero_ps();
+			for (int x = px_min & ~3; x <= px_max; x += 4) {
+				const __m128 fx = _mm_add_ps(_mm_set1_ps(float(tile_x + x)), pixel_offsets);
+
+				__m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.edges[0][0]), fx), _mm_set1_ps(row_edges[0])), zero);
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.edges[1][0]), fx), _mm_set1_ps(row_edges[1])), zero));
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.edges[2][0]), fx), _mm_set1_ps(row_edges[2])), zero));
+				if (_mm_movemask_ps(inside) == 0) {
+					continue;
+				}
+
+				const __m128 inv_w = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.inv_w[0]), fx), _mm_set1_ps(row_inv_w));
+				const __m128 depth_w = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.depth_w[0]), fx), _mm_set1_ps(row_depth_w));
+				const __m128 distance = _mm_mul_ps(_mm_div_ps(depth_w, inv_w), _mm_loadu_ps(&scale_row[x]));
+
+				const __m128 old_depth = _mm_loadu_ps(&depth_row[x]);
+				const __m128 new_depth = _mm_min_ps(old_depth, distance);
+				_mm_storeu_ps(&depth_row[x], _mm_or_ps(_mm_and_ps(inside, new_depth), _mm_andnot_ps(inside, old_depth)));
+			}
+#else
+			for (int x = px_min; x <= px_max; x++) {
+				const float fx = tile_x + x + 0.5f;
+				if (triangle.edges[0][0] * fx + row_edges[0] < 0.0f || triangle.edges[1][0] * fx + row_edges[1] < 0.0f || triangle.edges[2][0] * fx + row_edges[2] < 0.0f) {
+					continue;
+				}
+				const float inv_w = triangle.inv_w[0] * fx + row_inv_w;
+				const float depth_w = triangle.depth_w[0] * fx + row_depth_w;
+				depth_row[x] = MIN(depth_row[x], depth_w / inv_w * scale_row[x]);
+			}
+#endif
+		}
+	}
+
+	for (int y = 0; y < tile_h; y++) {
+		memcpy(&mips[0][(tile_y + y) * buffer_size.x + tile_x], &depth[y * TILE_WIDTH], tile_w * sizeof(float));
+	}
+}
+
+////////////////////////////////////////////////////////
+
+bool RendererSceneOcclusionCullSoftware::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RendererSceneOcclusionCullSoftware::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RendererSceneOcclusionCullSoftware::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RendererSceneOcclusionCullSoftware::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	const int vertex_count = p_vertices.size();
+	for (const int32_t &index : p_indices) {
+		ERR_FAIL_INDEX_MSG(index, vertex_count, "Occluder mesh index is out of range of its vertices.");
+	}
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+
+	occluder->aabb = AABB();
+	for (int i = 0; i < vertex_count; i++) {
+		if (i == 0) {
+			occluder->aabb.position = p_vertices[i];
+		} else {
+			occluder->aabb.expand_to(p_vertices[i]);
+		}
+	}
+}
+
+void RendererSceneOcclusionCullSoftware::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RendererSceneOcclusionCullSoftware::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RendererSceneOcclusionCullSoftware::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RendererSceneOcclusionCullSoftware::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	// Occluders are transformed every frame, so there is nothing to rebuild here.
+	OccluderInstance &instance = scenario->instances[p_instance];
+	instance.occluder = p_occluder;
+	instance.xform = p_xform;
+	instance.enabled = p_enabled;
+}
+
+void RendererSceneOcclusionCullSoftware::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+	scenario->instances.erase(p_instance);
+}
+
+////////////////////////////////////////////////////////
+
+void RendererSceneOcclusionCullSoftware::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = SoftwareHZBuffer();
+}
+
+void RendererSceneOcclusionCullSoftware::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RendererSceneOcclusionCullSoftware::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RendererSceneOcclusionCullSoftware::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+Vector2 RendererSceneOcclusionCullSoftware::_get_jitter(const Size2i &p_buffer_size) const {
+	if (!jitter_enabled || p_buffer_size.x <= 0 || p_buffer_size.y <= 0) {
+		return Vector2();
+	}
+
+	// Same pattern as the raycast occlusion culler, in normalized device coordinates.
+	static const Vector2 pattern[9] = {
+		Vector2(0, 0),
+		Vector2(-1, -1),
+		Vector2(1, -1),
+		Vector2(-1, 1),
+		Vector2(1, 1),
+		Vector2(-0.5f, -0.5f),
+		Vector2(0.5f, -0.5f),
+		Vector2(-0.5f, 0.5f),
+		Vector2(0.5f, 0.5f),
+	};
+
+	const Vector2 jitter = pattern[Engine::get_singleton()->get_frames_drawn() % 9];
+	return jitter * Vector2(0.66f / p_buffer_size.x, 0.66f / p_buffer_size.y);
+}
+
+void RendererSceneOcclusionCullSoftware::_setup_triangles(uint32_t p_from, uint32_t p_to, const SetupData *p_data) {
+	struct ClipVertex {
+		Vector4 clip;
+		real_t depth;
+	};
+
+	for (uint32_t i = p_from; i < p_to; i++) {
+		const Occluder *occluder = p_data->occluders[i];
+		const Transform3D view_model = p_data->cam_inv_transform * p_data->xforms[i];
+		const Projection mvp = p_data->cam_projection * Projection(view_model);
+		const Vector3 depth_axis = -view_model.basis.rows[2];
+		const real_t depth_offset = -view_model.origin.z;
+
+		const Vector3 *vertices = occluder->vertices.ptr();
+		const int32_t *indices = occluder->indices.ptr();
+		const uint32_t index_count = occluder->indices.size() - occluder->indices.size() % 3;
+
+		Triangle *triangles = p_data->triangles + p_data->triangle_offsets[i];
+		uint32_t triangle_count = 0;
+
+		for (uint32_t j = 0; j < index_count; j += 3) {
+			ClipVertex input[3];
+			uint32_t inside_near = 0;
+			for (uint32_t k = 0; k < 3; k++) {
+				const Vector3 &v = vertices[indices[j + k]];
+				input[k].clip = mvp.xform(Vector4(v.x, v.y, v.z, 1.0));
+				input[k].depth = depth_axis.dot(v) + depth_offset;
+				inside_near += input[k].depth >= p_data->z_near;
+			}
+
+			if (inside_near == 0) {
+				continue;
+			}
+
+			// Clip against the near plane, which leaves a triangle or a quad.
+			ClipVertex polygon[4];
+			uint32_t polygon_size = 0;
+			for (uint32_t k = 0; k < 3; k++) {
+				const ClipVertex &a = input[k];
+				const ClipVertex &b = input[(k + 1) % 3];
+				const bool a_inside = a.depth >= p_data->z_near;
+				const bool b_inside = b.depth >= p_data->z_near;
+				if (a_inside) {
+					polygon[polygon_size++] = a;
+				}
+				if (a_inside != b_inside) {
+					const real_t t = (p_data->z_near - a.depth) / (b.depth - a.depth);
+					polygon[polygon_size].clip = a.clip + (b.clip - a.clip) * t;
+					polygon[polygon_size].depth = p_data->z_near;
+					polygon_size++;
+				}
+			}
+
+			float x[4];
+			float y[4];
+			float inv_w[4];
+			float depth_w[4];
+			for (uint32_t k = 0; k < polygon_size; k++) {
+				const real_t w = polygon[k].clip.w;
+				x[k] = (polygon[k].clip.x / w * 0.5 + 0.5) * p_data->buffer_size.x;
+				y[k] = (polygon[k].clip.y / w * 0.5 + 0.5) * p_data->buffer_size.y;
+				inv_w[k] = 1.0 / w;
+				depth_w[k] = polygon[k].depth / w;
+			}
+
+			for (uint32_t k = 2; k < polygon_size; k++) {
+				uint32_t v0 = 0;
+				uint32_t v1 = k - 1;
+				uint32_t v2 = k;
+
+				float area = (x[v1] - x[v0]) * (y[v2] - y[v0]) - (x[v2] - x[v0]) * (y[v1] - y[v0]);
+				if (Math::abs(area) < CMP_EPSILON) {
+					continue;
+				}
+				if (area < 0.0f) {
+					// Occluders are double-sided, make the winding counter-clockwise.
+					SWAP(v1, v2);
+					area = -area;
+				}
+
+				Triangle &triangle = triangles[triangle_count];
+				triangle.min_x = MIN(x[v0], MIN(x[v1], x[v2]));
+				triangle.min_y = MIN(y[v0], MIN(y[v1], y[v2]));
+				triangle.max_x = MAX(x[v0], MAX(x[v1], x[v2]));
+				triangle.max_y = MAX(y[v0], MAX(y[v1], y[v2]));
+				// Written so NaN bounds are rejected too.
+				if (!(triangle.max_x >= 0.0f && triangle.max_y >= 0.0f && triangle.min_x <= p_data->buffer_size.x && triangle.min_y <= p_data->buffer_size.y)) {
+					continue;
+				}
+
+				// Vertices close to the camera plane project very far away, clamp the bounds to the
+				// buffer so converting them to pixels can't overflow an int.
+				triangle.min_x = MAX(triangle.min_x, 0.0f);
+				triangle.min_y = MAX(triangle.min_y, 0.0f);
+				triangle.max_x = MIN(triangle.max_x, float(p_data->buffer_size.x));
+				triangle.max_y = MIN(triangle.max_y, float(p_data->buffer_size.y));
+
+				// Edge k is the barycentric weight of vertex k, scaled by the area.
+				const uint32_t tri[3] = { v0, v1, v2 };
+				for (uint32_t e = 0; e < 3; e++) {
+					const uint32_t a = tri[(e + 1) % 3];
+					const uint32_t b = tri[(e + 2) % 3];
+					triangle.edges[e][0] = y[a] - y[b];
+					triangle.edges[e][1] = x[b] - x[a];
+					triangle.edges[e][2] = x[a] * y[b] - x[b] * y[a];
+				}
+
+				for (uint32_t c = 0; c < 3; c++) {
+					triangle.inv_w[c] = (triangle.edges[0][c] * inv_w[v0] + triangle.edges[1][c] * inv_w[v1] + triangle.edges[2][c] * inv_w[v2]) / area;
+					triangle.depth_w[c] = (triangle.edges[0][c] * depth_w[v0] + triangle.edges[1][c] * depth_w[v1] + triangle.edges[2][c] * depth_w[v2]) / area;
+				}
+
+				triangle_count++;
+			}
+		}
+
+		p_data->triangle_counts[i] = triangle_count;
+	}
+}
+
+void RendererSceneOcclusionCullSoftware::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	SoftwareHZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer || buffer->is_empty()) {
+		return;
+	}
+
+	Scenario *scenario = scenarios.getptr(buffer->scenario_rid);
+	if (!scenario) {
+		return;
+	}
+
+	// Offset the projection so that x and y move by the jitter after the perspective divide.
+	Projection projection = p_cam_projection;
+	const Vector2 jitter = _get_jitter(buffer->get_occlusion_buffer_size());
+	for (int i = 0; i < 4; i++) {
+		projection.columns[i][0] += jitter.x * projection.columns[i][3];
+		projection.columns[i][1] += jitter.y * projection.columns[i][3];
+	}
+
+	const Vector<Plane> planes = projection.get_projection_planes(p_cam_transform);
+
+	visible_occluders.clear();
+	visible_xforms.clear();
+	triangle_offsets.clear();
+	uint32_t triangle_total = 0;
+
+	for (const KeyValue<RID, OccluderInstance> &E : scenario->instances) {
+		const OccluderInstance &instance = E.value;
+		const Occluder *occluder = occluder_owner.get_or_null(instance.occluder);
+		if (!instance.enabled || !occluder || occluder->indices.size() < 3) {
+			continue;
+		}
+
+		const AABB aabb = instance.xform.xform(occluder->aabb);
+		bool outside = false;
+		for (const Plane &plane : planes) {
+			if (plane.distance_to(aabb.get_support(-plane.normal)) > 0) {
+				outside = true;
+				break;
+			}
+		}
+		if (outside) {
+			continue;
+		}
+
+		visible_occluders.push_back(occluder);
+		visible_xforms.push_back(instance.xform);
+		triangle_offsets.push_back(triangle_total);
+		// Near plane clipping can split a triangle in two.
+		triangle_total += occluder->indices.size() / 3 * 2;
+	}
+
+	buffer->triangles.resize(triangle_total);
+	triangle_counts.resize(visible_occluders.size());
+
+	if (!visible_occluders.is_empty()) {
+		SetupData sd;
+		sd.occluders = visible_occluders.ptr();
+		sd.xforms = visible_xforms.ptr();
+		sd.triangle_offsets = triangle_offsets.ptr();
+		sd.triangle_counts = triangle_counts.ptr();
+		sd.triangles = buffer->triangles.ptr();
+		sd.cam_inv_transform = p_cam_transform.affine_inverse();
+		sd.cam_projection = projection;
+		sd.z_near = p_cam_projection.get_z_near();
+		sd.buffer_size = buffer->sizes[0];
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_range_task(this, &RendererSceneOcclusionCullSoftware::_setup_triangles, &sd, visible_occluders.size(), -1, 1, true, SNAME("OcclusionCullSetupTriangles"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	buffer->bin_triangles(triangle_offsets.ptr(), triangle_counts.ptr(), visible_occluders.size());
+	buffer->rasterize(projection, p_cam_orthogonal);
+	buffer->update_mips();
+}
+
+RendererSceneOcclusionCull::HZBuffer *RendererSceneOcclusionCullSoftware::buffer_get_ptr(RID p_buffer) {
+	return buffers.getptr(p_buffer);
+}
+
+RID RendererSceneOcclusionCullSoftware::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+////////////////////////////////////////////////////////
+
+RendererSceneOcclusionCullSoftware::RendererSceneOcclusionCullSoftware() {
+	jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
+}
@@ -0,0 +1,146 @@
+/**************************************************************************/
+/*  renderer_scene_occlusion_cull_software.h                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid_owner.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
+
+// Occlusion culling backend that rasterizes occluders on the CPU, so it works
+// on every platform. The raycast module replaces it when Embree is available.
+class RendererSceneOcclusionCullSoftware : public RendererSceneOcclusionCull {
+public:
+	// Screen-space triangle set up for rasterization. Each array holds the a, b and c
+	// coefficients of a function a * x + b * y + c of the pixel position.
+	struct Triangle {
+		float edges[3][3]; // Positive inside the triangle.
+		float inv_w[3]; // 1 / w, which is linear in screen space.
+		float depth_w[3]; // View depth / w, so depth is depth_w / inv_w.
+		float min_x, min_y, max_x, max_y;
+	};
+
+	class SoftwareHZBuffer : public HZBuffer {
+		friend class RendererSceneOcclusionCullSoftware;
+
+	public:
+		static const int TILE_WIDTH = 32;
+		static const int TILE_HEIGHT = 16;
+
+	private:
+		struct RasterData {
+			const Triangle *triangles = nullptr;
+			Projection inv_projection;
+			bool orthogonal = false;
+		};
+
+		Size2i tile_grid_size;
+		LocalVector<LocalVector<uint32_t>> tile_triangles;
+		LocalVector<Triangle> triangles;
+
+		void _rasterize_tile(uint32_t p_tile, const RasterData *p_data);
+
+	public:
+		RID scenario_rid;
+
+		virtual void clear() override;
+		virtual void resize(const Size2i &p_size) override;
+
+		void bin_triangles(const uint32_t *p_offsets, const uint32_t *p_counts, uint32_t p_instance_count);
+		void rasterize(const Projection &p_cam_projection, bool p_cam_orthogonal);
+	};
+
+private:
+	struct Occluder {
+		PackedVector3Array vertices;
+		PackedInt32Array indices;
+		AABB aabb;
+	};
+
+	struct OccluderInstance {
+		RID occluder;
+		Transform3D xform;
+		bool enabled = true;
+	};
+
+	struct Scenario {
+		HashMap<RID, OccluderInstance> instances;
+	};
+
+	struct SetupData {
+		const Occluder *const *occluders = nullptr;
+		const Transform3D *xforms = nullptr;
+		const uint32_t *triangle_offsets = nullptr;
+		uint32_t *triangle_counts = nullptr;
+		Triangle *triangles = nullptr;
+		Transform3D cam_inv_transform;
+		Projection cam_projection;
+		real_t z_near = 0.0;
+		Size2i buffer_size;
+	};
+
+	RID_PtrOwner<Occluder> occluder_owner;
+	HashMap<RID, Scenario> scenarios;
+	HashMap<RID, SoftwareHZBuffer> buffers;
+	bool jitter_enabled = false;
+
+	// Per-frame work arrays, kept to avoid reallocating them.
+	LocalVector<const Occluder *> visible_occluders;
+	LocalVector<Transform3D> visible_xforms;
+	LocalVector<uint32_t> triangle_offsets;
+	LocalVector<uint32_t> triangle_counts;
+
+	void _setup_triangles(uint32_t p_from, uint32_t p_to, const SetupData *p_data);
+	Vector2 _get_jitter(const Size2i &p_buffer_size) const;
+
+public:
+	virtual bool is_occluder(RID p_rid) override;
+	virtual RID occluder_allocate() override;
+	virtual void occluder_initialize(RID p_occluder) override;
+	virtual void occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) override;
+	virtual void free_occluder(RID p_occluder) override;
+
+	virtual void add_scenario(RID p_scenario) override;
+	virtual void remove_scenario(RID p_scenario) override;
+	virtual void scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) override;
+	virtual void scenario_remove_instance(RID p_scenario, RID p_instance) override;
+
+	virtual void add_buffer(RID p_buffer) override;
+	virtual void remove_buffer(RID p_buffer) override;
+	virtual HZBuffer *buffer_get_ptr(RID p_buffer) override;
+	virtual void buffer_set_scenario(RID p_buffer, RID p_scenario) override;
+	virtual void buffer_set_size(RID p_buffer, const Vector2i &p_size) override;
+	virtual void buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) override;
+
+	virtual RID buffer_get_debug_texture(RID p_buffer) override;
+
+	RendererSceneOcclusionCullSoftware();
+};
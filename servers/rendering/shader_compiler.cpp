@@ -30,6 +30,12 @@
 
 #include "shader_compiler.h"
 
+#include "core/config/engine.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/string/string_builder.h"
+#include "core/version.h"
 #include "servers/rendering/rendering_server_globals.h"
 #include "servers/rendering/shader_types.h"
 
@@ -884,6 +890,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 
 			if (p_assigning && p_actions.write_flag_pointers.has(vnode->name)) {
 				*p_actions.write_flag_pointers[vnode->name] = true;
+				used_write_flag_pointers.insert(vnode->name);
 			}
 
 			if (p_default_actions.usage_defines.has(vnode->name) && !used_name_defines.has(vnode->name)) {
@@ -1001,6 +1008,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 
 			if (p_assigning && p_actions.write_flag_pointers.has(anode->name)) {
 				*p_actions.write_flag_pointers[anode->name] = true;
+				used_write_flag_pointers.insert(anode->name);
 			}
 
 			if (p_default_actions.usage_defines.has(anode->name) && !used_name_defines.has(anode->name)) {
@@ -1223,6 +1231,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 
 							if (found && p_actions.write_flag_pointers.has(name)) {
 								*p_actions.write_flag_pointers[name] = true;
+								used_write_flag_pointers.insert(name);
 							}
 						}
 
@@ -1459,7 +1468,419 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
+String ShaderCompiler::cache_dir;
+
+static const char *cache_file_header = "GDSG";
+static const uint32_t cache_file_version = 1;
+
+static void _store_string_name_list(const Ref<FileAccess> &p_file, const Vector<StringName> &p_names) {
+	p_file->store_32(p_names.size());
+	for (const StringName &name : p_names) {
+		p_file->store_pascal_string(name);
+	}
+}
+
+// Enums are stored as plain integers, a value outside of the enum means the file is corrupted.
+static uint32_t _get_enum(const Ref<FileAccess> &p_file, uint32_t p_count, bool &r_valid) {
+	uint32_t value = p_file->get_32();
+	if (value >= p_count) {
+		r_valid = false;
+		return 0;
+	}
+	return value;
+}
+
+static Vector<StringName> _get_string_name_list(const Ref<FileAccess> &p_file) {
+	Vector<StringName> names;
+	uint32_t count = p_file->get_32();
+	for (uint32_t i = 0; i < count && !p_file->eof_reached(); i++) {
+		names.push_back(p_file->get_pascal_string());
+	}
+	return names;
+}
+
+static void _store_uniform(const Ref<FileAccess> &p_file, const SL::ShaderNode::Uniform &p_uniform) {
+	p_file->store_32(p_uniform.order);
+	p_file->store_32(p_uniform.prop_order);
+	p_file->store_32(p_uniform.texture_order);
+	p_file->store_32(p_uniform.texture_binding);
+	p_file->store_32(p_uniform.type);
+	p_file->store_32(p_uniform.precision);
+	p_file->store_32(p_uniform.array_size);
+
+	// Booleans only initialize the first byte of the union, store them on their own.
+	bool is_bool = SL::get_scalar_type(p_uniform.type) == SL::TYPE_BOOL;
+	p_file->store_32(p_uniform.default_value.size());
+	for (const SL::Scalar &value : p_uniform.default_value) {
+		p_file->store_32(is_bool ? uint32_t(value.boolean) : value.uint);
+	}
+
+	p_file->store_32(p_uniform.scope);
+	p_file->store_32(p_uniform.hint);
+	p_file->store_8(p_uniform.use_color);
+	p_file->store_32(p_uniform.filter);
+	p_file->store_32(p_uniform.repeat);
+	for (int i = 0; i < 3; i++) {
+		p_file->store_float(p_uniform.hint_range[i]);
+	}
+	p_file->store_32(p_uniform.hint_enum_names.size());
+	for (const String &name : p_uniform.hint_enum_names) {
+		p_file->store_pascal_string(name);
+	}
+	p_file->store_32(p_uniform.instance_index);
+	p_file->store_pascal_string(p_uniform.group);
+	p_file->store_pascal_string(p_uniform.subgroup);
+}
+
+static SL::ShaderNode::Uniform _get_uniform(const Ref<FileAccess> &p_file, bool &r_valid) {
+	SL::ShaderNode::Uniform uniform;
+	uniform.order = int32_t(p_file->get_32());
+	uniform.prop_order = int32_t(p_file->get_32());
+	uniform.texture_order = int32_t(p_file->get_32());
+	uniform.texture_binding = int32_t(p_file->get_32());
+	uniform.type = SL::DataType(_get_enum(p_file, SL::TYPE_MAX, r_valid));
+	uniform.precision = SL::DataPrecision(_get_enum(p_file, SL::PRECISION_DEFAULT + 1, r_valid));
+	uniform.array_size = int32_t(p_file->get_32());
+
+	bool is_bool = SL::get_scalar_type(uniform.type) == SL::TYPE_BOOL;
+	uint32_t value_count = p_file->get_32();
+	for (uint32_t i = 0; i < value_count && !p_file->eof_reached(); i++) {
+		SL::Scalar value;
+		if (is_bool) {
+			value.boolean = p_file->get_32() != 0;
+		} else {
+			value.uint = p_file->get_32();
+		}
+		uniform.default_value.push_back(value);
+	}
+
+	uniform.scope = SL::ShaderNode::Uniform::Scope(_get_enum(p_file, SL::ShaderNode::Uniform::SCOPE_GLOBAL + 1, r_valid));
+	uniform.hint = SL::ShaderNode::Uniform::Hint(_get_enum(p_file, SL::ShaderNode::Uniform::HINT_MAX, r_valid));
+	uniform.use_color = p_file->get_8();
+	uniform.filter = SL::TextureFilter(_get_enum(p_file, SL::FILTER_DEFAULT + 1, r_valid));
+	uniform.repeat = SL::TextureRepeat(_get_enum(p_file, SL::REPEAT_DEFAULT + 1, r_valid));
+	for (int i = 0; i < 3; i++) {
+		uniform.hint_range[i] = p_file->get_float();
+	}
+	uint32_t enum_count = p_file->get_32();
+	for (uint32_t i = 0; i < enum_count && !p_file->eof_reached(); i++) {
+		uniform.hint_enum_names.push_back(p_file->get_pascal_string());
+	}
+	uniform.instance_index = int32_t(p_file->get_32());
+	uniform.group = p_file->get_pascal_string();
+	uniform.subgroup = p_file->get_pascal_string();
+	return uniform;
+}
+
+String ShaderCompiler::_get_cache_key(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions *p_actions) const {
+	StringBuilder hash_build;
+
+	hash_build.append("[engine]");
+	hash_build.append(GODOT_VERSION_FULL_BUILD);
+	hash_build.append(GODOT_VERSION_HASH);
+	hash_build.append("[cache_version]");
+	hash_build.append(itos(cache_file_version));
+	hash_build.append("[rendering_method]");
+	hash_build.append(OS::get_singleton()->get_current_rendering_method());
+	hash_build.append(RS::get_singleton()->is_low_end() ? "[low_end]" : "[high_end]");
+	hash_build.append("[mode]");
+	hash_build.append(itos(p_mode));
+	hash_build.append("[default_actions]");
+	hash_build.append(actions_sha256);
+
+	// Render mode flags and values are looked up again when replaying a cached entry, but entry points
+	// change the generated code and flag pointers are only recorded when the caller asked for them.
+	hash_build.append("[entry_points]");
+	for (const KeyValue<StringName, Stage> &E : p_actions->entry_point_stages) {
+		hash_build.append(String(E.key) + ":" + itos(E.value) + ";");
+	}
+	hash_build.append("[usage_flags]");
+	for (const KeyValue<StringName, bool *> &E : p_actions->usage_flag_pointers) {
+		hash_build.append(String(E.key) + ";");
+	}
+	hash_build.append("[write_flags]");
+	for (const KeyValue<StringName, bool *> &E : p_actions->write_flag_pointers) {
+		hash_build.append(String(E.key) + ";");
+	}
+
+	hash_build.append("[code]");
+	hash_build.append(p_code);
+
+	return hash_build.as_string().sha256_text();
+}
+
+bool ShaderCompiler::_load_from_cache(const String &p_key, IdentifierActions *p_actions, GeneratedCode &r_gen_code) const {
+	const String path = cache_dir.path_join(p_key + ".cache");
+	// Opened for writing too, so a hit can mark the entry as used.
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ_WRITE);
+	const bool writable = f.is_valid();
+	if (!writable) {
+		f = FileAccess::open(path, FileAccess::READ);
+	}
+	if (f.is_null()) {
+		return false;
+	}
+
+	char header[5] = { 0, 0, 0, 0, 0 };
+	f->get_buffer((uint8_t *)header, 4);
+	ERR_FAIL_COND_V(header != String(cache_file_header), false);
+
+	uint32_t file_version = f->get_32();
+	if (file_version != cache_file_version) {
+		return false; // Wrong version.
+	}
+
+	// Read everything first, the actions must not be touched if the file turns out to be truncated.
+	GeneratedCode gen_code;
+	bool valid = true;
+
+	uint32_t define_count = f->get_32();
+	for (uint32_t i = 0; i < define_count && !f->eof_reached(); i++) {
+		gen_code.defines.push_back(f->get_pascal_string());
+	}
+
+	uint32_t texture_count = f->get_32();
+	for (uint32_t i = 0; i < texture_count && !f->eof_reached(); i++) {
+		GeneratedCode::Texture texture;
+		texture.name = f->get_pascal_string();
+		texture.type = SL::DataType(_get_enum(f, SL::TYPE_MAX, valid));
+		texture.hint = SL::ShaderNode::Uniform::Hint(_get_enum(f, SL::ShaderNode::Uniform::HINT_MAX, valid));
+		texture.use_color = f->get_8();
+		texture.filter = SL::TextureFilter(_get_enum(f, SL::FILTER_DEFAULT + 1, valid));
+		texture.repeat = SL::TextureRepeat(_get_enum(f, SL::REPEAT_DEFAULT + 1, valid));
+		texture.global = f->get_8();
+		texture.array_size = int32_t(f->get_32());
+		gen_code.texture_uniforms.push_back(texture);
+	}
+
+	uint32_t offset_count = f->get_32();
+	for (uint32_t i = 0; i < offset_count && !f->eof_reached(); i++) {
+		gen_code.uniform_offsets.push_back(f->get_32());
+	}
+	gen_code.uniform_total_size = f->get_32();
+	gen_code.uniforms = f->get_pascal_string();
+	for (int i = 0; i < STAGE_MAX; i++) {
+		gen_code.stage_globals[i] = f->get_pascal_string();
+	}
+
+	uint32_t code_count = f->get_32();
+	for (uint32_t i = 0; i < code_count && !f->eof_reached(); i++) {
+		String name = f->get_pascal_string();
+		gen_code.code[name] = f->get_pascal_string();
+	}
+
+	uint8_t uses = f->get_8();
+	gen_code.uses_global_textures = uses & (1 << 0);
+	gen_code.uses_fragment_time = uses & (1 << 1);
+	gen_code.uses_vertex_time = uses & (1 << 2);
+	gen_code.uses_screen_texture_mipmaps = uses & (1 << 3);
+	gen_code.uses_screen_texture = uses & (1 << 4);
+	gen_code.uses_depth_texture = uses & (1 << 5);
+	gen_code.uses_normal_roughness_texture = uses & (1 << 6);
+
+	Vector<StringName> render_modes = _get_string_name_list(f);
+	Vector<StringName> usage_flags = _get_string_name_list(f);
+	Vector<StringName> write_flags = _get_string_name_list(f);
+
+	Vector<Pair<StringName, SL::ShaderNode::Uniform>> uniforms;
+	uint32_t uniform_count = f->get_32();
+	for (uint32_t i = 0; i < uniform_count && !f->eof_reached(); i++) {
+		StringName name = f->get_pascal_string();
+		uniforms.push_back(Pair<StringName, SL::ShaderNode::Uniform>(name, _get_uniform(f, valid)));
+	}
+
+	if (f->eof_reached() || !valid) {
+		return false;
+	}
+
+	if (Engine::get_singleton()->is_editor_hint()) {
+		// The parser validates global uniforms against the project settings in the editor,
+		// so recompile if any of them was removed or changed type since the entry was saved.
+		for (const Pair<StringName, SL::ShaderNode::Uniform> &E : uniforms) {
+			if (E.second.scope == SL::ShaderNode::Uniform::SCOPE_GLOBAL && _get_global_shader_uniform_type(E.first) != E.second.type) {
+				return false;
+			}
+		}
+	}
+
+	// Replay the side effects compilation has on the caller's actions.
+	for (const StringName &render_mode : render_modes) {
+		if (p_actions->render_mode_flags.has(render_mode)) {
+			*p_actions->render_mode_flags[render_mode] = true;
+		}
+
+		if (p_actions->render_mode_values.has(render_mode)) {
+			Pair<int *, int> &p = p_actions->render_mode_values[render_mode];
+			*p.first = p.second;
+		}
+	}
+	for (const StringName &flag : usage_flags) {
+		if (p_actions->usage_flag_pointers.has(flag)) {
+			*p_actions->usage_flag_pointers[flag] = true;
+		}
+	}
+	for (const StringName &flag : write_flags) {
+		if (p_actions->write_flag_pointers.has(flag)) {
+			*p_actions->write_flag_pointers[flag] = true;
+		}
+	}
+	for (const Pair<StringName, SL::ShaderNode::Uniform> &E : uniforms) {
+		p_actions->uniforms->insert(E.first, E.second);
+	}
+
+	// Eviction keeps the most recently modified entries. Writing the header again in place updates
+	// the modified time, so entries still in use are kept even if they were written long ago.
+	if (writable) {
+		f->seek(0);
+		f->store_buffer((const uint8_t *)cache_file_header, 4);
+	}
+
+	r_gen_code = gen_code;
+	return true;
+}
+
+void ShaderCompiler::_save_to_cache(const String &p_key, const IdentifierActions *p_actions, const GeneratedCode &p_gen_code) const {
+	Ref<FileAccess> f = FileAccess::open(cache_dir.path_join(p_key + ".cache"), FileAccess::WRITE);
+	ERR_FAIL_COND(f.is_null());
+	f->store_buffer((const uint8_t *)cache_file_header, 4);
+	f->store_32(cache_file_version);
+
+	f->store_32(p_gen_code.defines.size());
+	for (const String &define : p_gen_code.defines) {
+		f->store_pascal_string(define);
+	}
+
+	f->store_32(p_gen_code.texture_uniforms.size());
+	for (const GeneratedCode::Texture &texture : p_gen_code.texture_uniforms) {
+		f->store_pascal_string(texture.name);
+		f->store_32(texture.type);
+		f->store_32(texture.hint);
+		f->store_8(texture.use_color);
+		f->store_32(texture.filter);
+		f->store_32(texture.repeat);
+		f->store_8(texture.global);
+		f->store_32(texture.array_size);
+	}
+
+	f->store_32(p_gen_code.uniform_offsets.size());
+	for (uint32_t offset : p_gen_code.uniform_offsets) {
+		f->store_32(offset);
+	}
+	f->store_32(p_gen_code.uniform_total_size);
+	f->store_pascal_string(p_gen_code.uniforms);
+	for (int i = 0; i < STAGE_MAX; i++) {
+		f->store_pascal_string(p_gen_code.stage_globals[i]);
+	}
+
+	f->store_32(p_gen_code.code.size());
+	for (const KeyValue<String, String> &E : p_gen_code.code) {
+		f->store_pascal_string(E.key);
+		f->store_pascal_string(E.value);
+	}
+
+	uint8_t uses = 0;
+	uses |= p_gen_code.uses_global_textures ? (1 << 0) : 0;
+	uses |= p_gen_code.uses_fragment_time ? (1 << 1) : 0;
+	uses |= p_gen_code.uses_vertex_time ? (1 << 2) : 0;
+	uses |= p_gen_code.uses_screen_texture_mipmaps ? (1 << 3) : 0;
+	uses |= p_gen_code.uses_screen_texture ? (1 << 4) : 0;
+	uses |= p_gen_code.uses_depth_texture ? (1 << 5) : 0;
+	uses |= p_gen_code.uses_normal_roughness_texture ? (1 << 6) : 0;
+	f->store_8(uses);
+
+	Vector<StringName> usage_flags;
+	for (const StringName &E : used_flag_pointers) {
+		usage_flags.push_back(E);
+	}
+	Vector<StringName> write_flags;
+	for (const StringName &E : used_write_flag_pointers) {
+		write_flags.push_back(E);
+	}
+	_store_string_name_list(f, shader->render_modes);
+	_store_string_name_list(f, usage_flags);
+	_store_string_name_list(f, write_flags);
+
+	Vector<StringName> uniform_names;
+	for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : shader->uniforms) {
+		if (p_actions->uniforms->has(E.key)) {
+			uniform_names.push_back(E.key);
+		}
+	}
+	uniform_names.sort_custom<StringName::AlphCompare>(); // Insert in the same order compilation does.
+	f->store_32(uniform_names.size());
+	for (const StringName &name : uniform_names) {
+		f->store_pascal_string(name);
+		_store_uniform(f, (*p_actions->uniforms)[name]);
+	}
+}
+
+void ShaderCompiler::set_cache_dir(const String &p_dir) {
+	cache_dir = p_dir;
+	if (cache_dir.is_empty()) {
+		return;
+	}
+
+	Error err = DirAccess::make_dir_recursive_absolute(cache_dir);
+	if (err != OK) {
+		ERR_PRINT("Can't create shader compiler cache folder, no shader compiler caching will happen: " + cache_dir);
+		cache_dir = String();
+		return;
+	}
+
+	_evict_cache_entries();
+}
+
+void ShaderCompiler::_evict_cache_entries() {
+	// Entries are never invalidated, every edit of a shader adds a new one. Keep the most recently
+	// used ones, the modified time is updated on every cache hit.
+	Ref<DirAccess> da = DirAccess::open(cache_dir);
+	if (da.is_null()) {
+		return;
+	}
+
+	struct CacheEntry {
+		String path;
+		uint64_t modified_time = 0;
+
+		bool operator<(const CacheEntry &p_entry) const {
+			return modified_time > p_entry.modified_time;
+		}
+	};
+
+	Vector<CacheEntry> entries;
+	for (const String &file : da->get_files()) {
+		if (file.get_extension() != "cache") {
+			continue;
+		}
+		CacheEntry entry;
+		entry.path = cache_dir.path_join(file);
+		entry.modified_time = FileAccess::get_modified_time(entry.path);
+		entries.push_back(entry);
+	}
+
+	if (entries.size() <= CACHE_MAX_ENTRIES) {
+		return;
+	}
+
+	entries.sort();
+	for (int i = CACHE_MAX_ENTRIES; i < entries.size(); i++) {
+		da->remove(entries[i].path);
+	}
+}
+
+String ShaderCompiler::get_cache_dir() {
+	return cache_dir;
+}
+
 Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	String cache_key;
+	if (!cache_dir.is_empty()) {
+		cache_key = _get_cache_key(p_mode, p_code, p_actions);
+		if (_load_from_cache(cache_key, p_actions, r_gen_code)) {
+			return OK;
+		}
+	}
+
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1559,18 +1980,42 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 	used_name_defines.clear();
 	used_rmode_defines.clear();
 	used_flag_pointers.clear();
+	used_write_flag_pointers.clear();
 	fragment_varyings.clear();
 
 	shader = parser.get_shader();
 	function = nullptr;
 	_dump_node_code(shader, 1, r_gen_code, *p_actions, actions, false);
 
+	if (!cache_key.is_empty()) {
+		_save_to_cache(cache_key, p_actions, r_gen_code);
+	}
+
 	return OK;
 }
 
 void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	actions = p_actions;
 
+	StringBuilder hash_build;
+	for (const KeyValue<StringName, String> &E : actions.renames) {
+		hash_build.append("[rename]" + String(E.key) + "=" + E.value);
+	}
+	for (const KeyValue<StringName, String> &E : actions.render_mode_defines) {
+		hash_build.append("[render_mode_define]" + String(E.key) + "=" + E.value);
+	}
+	for (const KeyValue<StringName, String> &E : actions.usage_defines) {
+		hash_build.append("[usage_define]" + String(E.key) + "=" + E.value);
+	}
+	for (const KeyValue<StringName, String> &E : actions.custom_samplers) {
+		hash_build.append("[custom_sampler]" + String(E.key) + "=" + E.value);
+	}
+	hash_build.append(vformat("[settings]%d,%d,%d,%d,%d,%d,%d", int(actions.default_filter), int(actions.default_repeat), actions.base_texture_binding_index, actions.texture_layout_set, int(actions.base_varying_index), int(actions.apply_luminance_multiplier), int(actions.check_multiview_samplers)));
+	hash_build.append("[base_uniform_string]" + actions.base_uniform_string);
+	hash_build.append("[global_buffer_array_variable]" + actions.global_buffer_array_variable);
+	hash_build.append("[instance_uniform_index_variable]" + actions.instance_uniform_index_variable);
+	actions_sha256 = hash_build.as_string().sha256_text();
+
 	time_name = "TIME";
 
 	List<String> func_list;
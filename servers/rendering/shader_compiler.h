@@ -118,17 +118,34 @@ private:
 
 	HashSet<StringName> used_name_defines;
 	HashSet<StringName> used_flag_pointers;
+	HashSet<StringName> used_write_flag_pointers;
 	HashSet<StringName> used_rmode_defines;
 	HashSet<StringName> internal_functions;
 	HashSet<StringName> fragment_varyings;
 
 	DefaultIdentifierActions actions;
+	String actions_sha256;
+
+	static String cache_dir;
 
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
+	String _get_cache_key(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions *p_actions) const;
+	bool _load_from_cache(const String &p_key, IdentifierActions *p_actions, GeneratedCode &r_gen_code) const;
+	void _save_to_cache(const String &p_key, const IdentifierActions *p_actions, const GeneratedCode &p_gen_code) const;
+	static void _evict_cache_entries();
+
 public:
 	Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
 
 	void initialize(DefaultIdentifierActions p_actions);
+
+	// Successfully compiled shaders are stored in this folder, keyed by a hash of their code and
+	// of the compiler configuration, so the parser can be skipped next time. Empty disables it.
+	// Only the CACHE_MAX_ENTRIES most recently used entries are kept when the folder is set.
+	static constexpr int CACHE_MAX_ENTRIES = 4096;
+	static void set_cache_dir(const String &p_dir);
+	static String get_cache_dir();
+
 	ShaderCompiler();
 };
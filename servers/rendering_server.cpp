@@ -3496,6 +3496,8 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDERING_INFO_PIPELINE_COMPILATIONS_SURFACE);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_SHADER_COMPILATION_QUEUE_DEPTH);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_SHADER_COMPILATION_LATENCY);
 
 	BIND_ENUM_CONSTANT(PIPELINE_SOURCE_CANVAS);
 	BIND_ENUM_CONSTANT(PIPELINE_SOURCE_MESH);
@@ -3623,6 +3625,8 @@ void RenderingServer::init() {
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/use_zstd_compression", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/strip_debug", false);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/strip_debug.release", true);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/shader_compiler/compilation/max_threads", PROPERTY_HINT_RANGE, "-1,256,1"), -1);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "rendering/shader_compiler/compilation/background_thread_ratio", PROPERTY_HINT_RANGE, "0,1,0.01"), 0.3);
 
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/reflections/sky_reflections/roughness_layers", PROPERTY_HINT_RANGE, "1,32,1"), 8); // Assumes a 256x256 cubemap
 	GLOBAL_DEF_RST("rendering/reflections/sky_reflections/texture_array_reflections", true);
@@ -1777,6 +1777,8 @@ public:
 		RENDERING_INFO_PIPELINE_COMPILATIONS_SURFACE,
 		RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW,
 		RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION,
+		RENDERING_INFO_SHADER_COMPILATION_QUEUE_DEPTH,
+		RENDERING_INFO_SHADER_COMPILATION_LATENCY,
 		RENDERING_INFO_MAX
 	};
 
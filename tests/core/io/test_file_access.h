@@ -107,6 +107,42 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
 
+TEST_CASE("[FileAccess] Memory mapped reads") {
+	const String file_path = TestUtils::get_data_path("line_endings_lf.test.txt");
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	const Vector<uint8_t> expected = f->get_buffer(f->get_length());
+	REQUIRE(expected.size() > 8);
+
+	Ref<FileAccess> f_mapped = FileAccess::open(file_path, FileAccess::READ);
+	REQUIRE(f_mapped.is_valid());
+	CHECK(f_mapped->get_mapped_span(4).is_empty());
+	if (f_mapped->map_to_memory() != OK) {
+		// Not supported by this platform, reads keep working unmapped.
+		CHECK(f_mapped->get_buffer(expected.size()) == expected);
+		return;
+	}
+
+	CHECK(f_mapped->get_length() == (uint64_t)expected.size());
+	CHECK(f_mapped->get_buffer(4) == expected.slice(0, 4));
+
+	const Span<uint8_t> span = f_mapped->get_mapped_span(4);
+	REQUIRE(span.size() == 4);
+	CHECK(memcmp(span.ptr(), expected.ptr() + 4, 4) == 0);
+	CHECK(f_mapped->get_position() == 8);
+
+	// Spans past the end are not available and don't move the position.
+	CHECK(f_mapped->get_mapped_span(expected.size()).is_empty());
+	CHECK(f_mapped->get_position() == 8);
+
+	f_mapped->seek_end(-2);
+	CHECK(f_mapped->get_buffer(4) == expected.slice(expected.size() - 2));
+	CHECK(f_mapped->eof_reached());
+	f_mapped->seek(0);
+	CHECK_FALSE(f_mapped->eof_reached());
+	CHECK(f_mapped->get_as_utf8_string() == String::utf8((const char *)expected.ptr(), expected.size()));
+}
+
 TEST_CASE("[FileAccess] Get/Store floating point values") {
 	// BigEndian Hex: 0x40490E56
 	// LittleEndian Hex: 0x560E4940
@@ -39,6 +39,13 @@
 
 #include "thirdparty/doctest/doctest.h"
 
+class TestImageInternalsAccessor {
+public:
+	static void set_accelerated_processing(bool p_enabled) {
+		Image::_set_accelerated_processing(p_enabled);
+	}
+};
+
 namespace TestImage {
 
 TEST_CASE("[Image] Instantiation") {
@@ -442,4 +449,165 @@ TEST_CASE("[Image] Convert image") {
 	CHECK_MESSAGE(image2->get_data() == image_data, "Image conversion to invalid type (Image::FORMAT_MAX + 1) should not alter image.");
 }
 
+static Ref<Image> make_noise_image(int p_width, int p_height) {
+	PackedByteArray data;
+	data.resize(p_width * p_height * 4);
+	uint8_t *w = data.ptrw();
+	uint32_t seed = 12345;
+	for (int64_t i = 0; i < data.size(); i++) {
+		seed = seed * 1664525u + 1013904223u;
+		w[i] = seed >> 24;
+	}
+	return Image::create_from_data(p_width, p_height, false, Image::FORMAT_RGBA8, data);
+}
+
+// Operation 0 generates mipmaps, the next ones resize with every interpolation, the last one converts.
+static const int image_operation_count = Image::INTERPOLATE_LANCZOS + 3;
+
+static void apply_image_operation(const Ref<Image> &p_image, int p_operation) {
+	if (p_operation == 0) {
+		p_image->generate_mipmaps();
+	} else if (p_operation <= Image::INTERPOLATE_LANCZOS + 1) {
+		p_image->resize(p_image->get_width() / 2 + 3, p_image->get_height() / 3, (Image::Interpolation)(p_operation - 1));
+	} else {
+		p_image->convert(p_image->get_format() == Image::FORMAT_RGBA8 ? Image::FORMAT_RGB8 : (p_image->get_format() == Image::FORMAT_RGBAF ? Image::FORMAT_RGBF : Image::FORMAT_RGBH));
+	}
+}
+
+static Ref<Image> process_image(const Ref<Image> &p_image, int p_operation, bool p_accelerated) {
+	Ref<Image> copy = memnew(Image);
+	copy->copy_internals_from(p_image);
+	TestImageInternalsAccessor::set_accelerated_processing(p_accelerated);
+	apply_image_operation(copy, p_operation);
+	TestImageInternalsAccessor::set_accelerated_processing(true);
+	return copy;
+}
+
+// Returns the first pixel of the base level that differs, or (-1, -1) if all of them match.
+static Vector2i find_mismatched_pixel(const Ref<Image> &p_a, const Ref<Image> &p_b) {
+	if (p_a->get_size() != p_b->get_size() || p_a->get_format() != p_b->get_format()) {
+		return Vector2i();
+	}
+	for (int y = 0; y < p_a->get_height(); y++) {
+		for (int x = 0; x < p_a->get_width(); x++) {
+			if (p_a->get_pixel(x, y) != p_b->get_pixel(x, y)) {
+				return Vector2i(x, y);
+			}
+		}
+	}
+	return Vector2i(-1, -1);
+}
+
+TEST_CASE("[Image] Mipmaps, resizing and conversion of large images") {
+	// Large enough to be split across threads.
+	const int size = 1024;
+	Ref<Image> image = make_noise_image(size, size);
+	const PackedByteArray base = image->get_data();
+
+	image->generate_mipmaps();
+	const PackedByteArray with_mipmaps = image->get_data();
+	const int64_t mip_offset = image->get_mipmap_offset(1);
+	bool mipmap_matches = true;
+	for (int y = 0; y < size / 2 && mipmap_matches; y++) {
+		for (int x = 0; x < size / 2; x++) {
+			for (int c = 0; c < 4; c++) {
+				const int64_t up = (y * 2 * size + x * 2) * 4 + c;
+				const int64_t down = up + size * 4;
+				const uint8_t expected = (base[up] + base[up + 4] + base[down] + base[down + 4] + 2) >> 2;
+				if (with_mipmaps[mip_offset + (y * (size / 2) + x) * 4 + c] != expected) {
+					mipmap_matches = false;
+				}
+			}
+		}
+	}
+	CHECK_MESSAGE(mipmap_matches, "RGBA8 mipmaps should be the rounded average of each 2x2 block.");
+
+	Ref<Image> float_image = memnew(Image);
+	float_image->copy_internals_from(image);
+	float_image->convert(Image::FORMAT_RGBAF);
+	float_image->clear_mipmaps();
+	float_image->generate_mipmaps();
+	const PackedByteArray float_data = float_image->get_data();
+	const float *float_mipmap = (const float *)(float_data.ptr() + float_image->get_mipmap_offset(1));
+	mipmap_matches = true;
+	for (int y = 0; y < size / 2 && mipmap_matches; y++) {
+		for (int x = 0; x < size / 2; x++) {
+			for (int c = 0; c < 4; c++) {
+				const int64_t up = (y * 2 * size + x * 2) * 4 + c;
+				const int64_t down = up + size * 4;
+				// Same conversion as Image::convert() through Color.
+				const float a = base[up] / 255.0;
+				const float b = base[up + 4] / 255.0;
+				const float d = base[down] / 255.0;
+				const float e = base[down + 4] / 255.0;
+				if (float_mipmap[(y * (size / 2) + x) * 4 + c] != (a + b + d + e) * 0.25f) {
+					mipmap_matches = false;
+				}
+			}
+		}
+	}
+	CHECK_MESSAGE(mipmap_matches, "RGBAF mipmaps should be the average of each 2x2 block.");
+
+	image->clear_mipmaps();
+	for (int operation = 1; operation <= Image::INTERPOLATE_LANCZOS + 1; operation++) {
+		const Ref<Image> resized = process_image(image, operation, true);
+		CHECK(resized->get_size() == Vector2i(size / 2 + 3, size / 3));
+		CHECK(!resized->is_invisible());
+		const Vector2i mismatch = find_mismatched_pixel(resized, process_image(image, operation, false));
+		CHECK_MESSAGE(mismatch == Vector2i(-1, -1),
+				vformat("Interpolation %d should give the same pixel at %s with and without threads and SIMD.", operation - 1, mismatch));
+	}
+}
+
+TEST_CASE("[Image] Threaded and SIMD processing matches the single-threaded kernels") {
+	// Large enough to be split across threads.
+	const int size = 1024;
+	const Image::Format formats[] = { Image::FORMAT_RGBA8, Image::FORMAT_RGBAF, Image::FORMAT_RGBAH };
+
+	for (Image::Format format : formats) {
+		Ref<Image> image = make_noise_image(size, size);
+		image->convert(format);
+		for (int operation = 0; operation < image_operation_count; operation++) {
+			// Also compares the mipmaps, which get_pixel() can't reach.
+			CHECK_MESSAGE(process_image(image, operation, true)->get_data() == process_image(image, operation, false)->get_data(),
+					vformat("Operation %d on %s should give the same pixels with and without threads and SIMD.", operation, Image::format_names[format]));
+		}
+	}
+}
+
+TEST_CASE("[Benchmark][Image] Mipmap generation, resizing and conversion of 4K and 8K images" * doctest::skip()) {
+	struct Case {
+		int size;
+		Image::Format format;
+	};
+	const Case cases[] = {
+		{ 4096, Image::FORMAT_RGBA8 },
+		{ 4096, Image::FORMAT_RGBAF },
+		{ 4096, Image::FORMAT_RGBAH },
+		{ 8192, Image::FORMAT_RGBA8 },
+		{ 8192, Image::FORMAT_RGBAF },
+		{ 8192, Image::FORMAT_RGBAH },
+	};
+
+	for (const Case &c : cases) {
+		Ref<Image> image = make_noise_image(c.size, c.size);
+		image->convert(c.format);
+
+		String report = vformat("%dx%d %s:", c.size, c.size, Image::format_names[c.format]);
+		for (int operation = 0; operation < image_operation_count; operation++) {
+			for (int accelerated = 1; accelerated >= 0; accelerated--) {
+				Ref<Image> copy = memnew(Image);
+				copy->copy_internals_from(image);
+				TestImageInternalsAccessor::set_accelerated_processing(accelerated);
+				const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+				apply_image_operation(copy, operation);
+				const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+				TestImageInternalsAccessor::set_accelerated_processing(true);
+				report += vformat(" operation %d %s %d usec,", operation, accelerated ? "accelerated" : "plain", (int64_t)usec);
+			}
+		}
+		MESSAGE(report.trim_suffix(",").utf8().get_data());
+	}
+}
+
 } // namespace TestImage
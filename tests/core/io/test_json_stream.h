@@ -0,0 +1,249 @@
+/**************************************************************************/
+/*  test_json_stream.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/json.h"
+#include "core/io/json_stream.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestJSONStream {
+
+static Ref<JSONReader> make_reader(const String &p_json) {
+	Ref<JSONReader> reader;
+	reader.instantiate();
+	reader->open_buffer(p_json.to_utf8_buffer());
+	return reader;
+}
+
+TEST_CASE("[JSONReader] Tokens") {
+	Ref<JSONReader> reader = make_reader(R"({"a": [1, -2.5e1, "x\u00e9\n"], "b": {"c": true, "d": null}, "e": false})");
+
+	CHECK(reader->read() == JSONReader::TOKEN_OBJECT_BEGIN);
+	CHECK(reader->get_depth() == 1);
+	CHECK(reader->read() == JSONReader::TOKEN_KEY);
+	CHECK(reader->get_value() == Variant("a"));
+	CHECK(reader->read() == JSONReader::TOKEN_ARRAY_BEGIN);
+	CHECK(reader->get_depth() == 2);
+	CHECK(reader->read() == JSONReader::TOKEN_NUMBER);
+	CHECK(reader->get_value() == Variant(1.0));
+	CHECK(reader->read() == JSONReader::TOKEN_NUMBER);
+	CHECK(reader->get_value() == Variant(-25.0));
+	CHECK(reader->read() == JSONReader::TOKEN_STRING);
+	CHECK(reader->get_value() == Variant(String::utf8("x\xc3\xa9\n")));
+	CHECK(reader->read() == JSONReader::TOKEN_ARRAY_END);
+	CHECK(reader->read() == JSONReader::TOKEN_KEY);
+	CHECK(reader->read() == JSONReader::TOKEN_OBJECT_BEGIN);
+	CHECK(reader->skip() == OK);
+	CHECK(reader->get_token() == JSONReader::TOKEN_OBJECT_END);
+	CHECK(reader->get_depth() == 1);
+	CHECK(reader->read() == JSONReader::TOKEN_KEY);
+	CHECK(reader->get_value() == Variant("e"));
+	CHECK(reader->read() == JSONReader::TOKEN_BOOL);
+	CHECK(reader->get_value() == Variant(false));
+	CHECK(reader->read() == JSONReader::TOKEN_OBJECT_END);
+	CHECK(reader->read() == JSONReader::TOKEN_END);
+	CHECK(reader->read() == JSONReader::TOKEN_END);
+}
+
+TEST_CASE("[JSONReader] Reading values matches JSON") {
+	const String json_text = R"([{"name": "a", "tags": ["x", "y"], "score": 1.5}, {"surrogate": "\ud83d\ude00", "empty": {}}, [], 12, "end"])";
+
+	Ref<JSONReader> reader = make_reader(json_text);
+	CHECK(reader->read() == JSONReader::TOKEN_ARRAY_BEGIN);
+	CHECK(reader->read_value() == JSON::parse_string(json_text));
+	CHECK(reader->read() == JSONReader::TOKEN_END);
+
+	// Stream the records one by one.
+	reader = make_reader(json_text);
+	Array records;
+	CHECK(reader->read() == JSONReader::TOKEN_ARRAY_BEGIN);
+	while (reader->read() != JSONReader::TOKEN_ARRAY_END) {
+		records.push_back(reader->read_value());
+	}
+	CHECK(Variant(records) == JSON::parse_string(json_text));
+}
+
+TEST_CASE("[JSONReader] Errors") {
+	const char *invalid[] = {
+		"{\"a\" 1}",
+		"{\"a\": 1 \"b\": 2}",
+		"[1, 2",
+		"[tru]",
+		"\"unterminated",
+		"\"\\q\"",
+		"\"\\ud83d\"",
+		"[1] 2",
+		"{1: 2}",
+		"",
+		"1-2",
+		"--",
+		"1e",
+		".5",
+		"[01]",
+		"[1.]",
+		"[-]",
+	};
+	for (const char *json_text : invalid) {
+		Ref<JSONReader> reader = make_reader(json_text);
+		JSONReader::Token token = JSONReader::TOKEN_NONE;
+		while (token != JSONReader::TOKEN_END && token != JSONReader::TOKEN_ERROR) {
+			token = reader->read();
+		}
+		CHECK_MESSAGE(token == JSONReader::TOKEN_ERROR, vformat("Parsing `%s` should fail.", json_text));
+		CHECK(!reader->get_error_message().is_empty());
+	}
+
+	Ref<JSONReader> reader = make_reader("[\n1,\n2\n}");
+	while (reader->read() != JSONReader::TOKEN_ERROR) {
+	}
+	CHECK(reader->get_error_line() == 3);
+	CHECK(reader->get_error_message() == "Expected ','");
+}
+
+TEST_CASE("[JSONWriter] Output matches JSON::stringify") {
+	Dictionary nested;
+	nested["list"] = Array({ 1, 2.5, "three", Variant(), true });
+	nested["z"] = (int64_t)-9007199254740991;
+	Dictionary data;
+	data["b"] = nested;
+	data["a"] = String::utf8("quote \" backslash \\ tab \t \xc3\xa9");
+	data["c"] = Array();
+
+	for (const String &indent : { String(), String("\t"), String("  ") }) {
+		Ref<JSONWriter> writer;
+		writer.instantiate();
+		writer->set_indent(indent);
+		writer->write_value(data);
+		CHECK(writer->get_as_text() == JSON::stringify(data, indent));
+	}
+
+	Ref<JSONWriter> writer;
+	writer.instantiate();
+	writer->begin_object();
+	writer->write_key("id");
+	writer->write_int(42);
+	writer->write_key("values");
+	writer->begin_array();
+	writer->write_number(0.5);
+	writer->write_string("x");
+	writer->write_null();
+	writer->write_bool(false);
+	writer->end_array();
+	writer->write_key("empty");
+	writer->begin_object();
+	writer->end_object();
+	writer->end_object();
+	CHECK(writer->get_as_text() == R"({"id":42,"values":[0.5,"x",null,false],"empty":{}})");
+
+	ERR_PRINT_OFF;
+	writer->write_null(); // Only one root value is allowed.
+	ERR_PRINT_ON;
+	CHECK(writer->get_as_text() == R"({"id":42,"values":[0.5,"x",null,false],"empty":{}})");
+}
+
+static int json_stream_keys = 0;
+
+static bool count_keys(int p_token, const Variant &p_value) {
+	if (p_token == JSONReader::TOKEN_KEY) {
+		json_stream_keys++;
+	}
+	return json_stream_keys < 10;
+}
+
+TEST_CASE("[JSONReader][JSONWriter] Round trip through a file larger than the read chunk") {
+	const String path = TestUtils::get_temp_path("json_stream_test.json");
+	const int record_count = 20000;
+
+	Ref<JSONWriter> writer;
+	writer.instantiate();
+	writer->set_indent("\t");
+	REQUIRE(writer->open(path) == OK);
+	writer->begin_array();
+	for (int i = 0; i < record_count; i++) {
+		writer->begin_object();
+		writer->write_key("id");
+		writer->write_int(i);
+		writer->write_key("name");
+		writer->write_string(vformat("record \"%d\"", i));
+		writer->end_object();
+	}
+	writer->end_array();
+	CHECK(writer->close() == OK);
+
+	Ref<JSONReader> reader;
+	reader.instantiate();
+	REQUIRE(reader->open(path) == OK);
+	REQUIRE(reader->read() == JSONReader::TOKEN_ARRAY_BEGIN);
+	int count = 0;
+	while (reader->read() == JSONReader::TOKEN_OBJECT_BEGIN) {
+		const Dictionary record = reader->read_value();
+		CHECK(int(record["id"]) == count);
+		CHECK(String(record["name"]) == vformat("record \"%d\"", count));
+		count++;
+	}
+	CHECK(reader->get_token() == JSONReader::TOKEN_ARRAY_END);
+	CHECK(reader->read() == JSONReader::TOKEN_END);
+	CHECK(count == record_count);
+	reader->close();
+
+	// Callback API, stopping early.
+	json_stream_keys = 0;
+	REQUIRE(reader->open(path) == OK);
+	const Error err = reader->read_with_callback(callable_mp_static(&count_keys));
+	CHECK(err == ERR_SKIP);
+	CHECK(json_stream_keys == 10);
+}
+
+TEST_CASE("[JSONWriter] Every kind of value flushes to the file") {
+	const String path = TestUtils::get_temp_path("json_stream_flush_test.json");
+	const int flush_size = 65536; // Same as JSONWriter::FLUSH_SIZE.
+
+	Ref<JSONWriter> writer;
+	writer.instantiate();
+	REQUIRE(writer->open(path) == OK);
+	writer->begin_array();
+	for (int i = 0; i < flush_size; i++) {
+		writer->write_number(0.0);
+		writer->write_bool(false);
+		writer->write_null();
+	}
+	// Whatever is still buffered must be less than one flush worth of data.
+	CHECK(writer->get_as_text().length() < flush_size + 16);
+	writer->end_array();
+	CHECK(writer->close() == OK);
+
+	const Array values = JSON::parse_string(FileAccess::get_file_as_string(path));
+	CHECK(values.size() == flush_size * 3);
+}
+
+} // namespace TestJSONStream
@@ -32,6 +32,8 @@
 
 #include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
+#include "core/io/resource_loader.h"
+#include "core/io/resource_saver.h"
 #include "core/os/os.h"
 
 #include "tests/test_utils.h"
@@ -116,4 +118,96 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Packed files are read from the mapping of their pack") {
+	const String source_path = TestUtils::get_temp_path("mapped_source.bin");
+	const String output_pck_path = TestUtils::get_temp_path("output_mapped.pck");
+	Vector<uint8_t> expected;
+	for (int i = 0; i < 200; i++) {
+		expected.push_back(i);
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(expected);
+	}
+
+	PCKPacker pck_packer;
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file("res://mapped/data.bin", source_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	PackedData *packed_data = PackedData::get_singleton();
+	const bool owns_packed_data = packed_data == nullptr;
+	if (owns_packed_data) {
+		packed_data = memnew(PackedData);
+	}
+	REQUIRE(packed_data->add_pack(output_pck_path, true, 0) == OK);
+
+	Ref<FileAccess> f = packed_data->try_open_path("res://mapped/data.bin");
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == (uint64_t)expected.size());
+
+	if (f->map_to_memory() == OK) {
+		const Span<uint8_t> span = f->get_mapped_span(8);
+		REQUIRE(span.size() == 8);
+		CHECK(memcmp(span.ptr(), expected.ptr(), 8) == 0);
+		CHECK(f->get_position() == 8);
+		CHECK(f->get_buffer(4) == expected.slice(8, 12));
+
+		Ref<FileAccess> f_other = packed_data->try_open_path("res://mapped/data.bin");
+		REQUIRE(f_other.is_valid());
+		CHECK_MESSAGE(
+				f_other->get_mapped_span(1).ptr() == span.ptr(),
+				"Files opened from the same pack should share its mapping.");
+
+		f->seek(expected.size() - 4);
+		CHECK_MESSAGE(
+				f->get_mapped_span(8).is_empty(),
+				"Spans shouldn't reach past the end of the packed file.");
+		CHECK(f->get_buffer(8) == expected.slice(expected.size() - 4));
+		CHECK(f->eof_reached());
+	} else {
+		// Not supported by this platform, reads keep working unmapped.
+		CHECK(f->get_mapped_span(8).is_empty());
+		CHECK(f->get_buffer(expected.size()) == expected);
+	}
+
+	f.unref();
+	packed_data->remove_path("res://mapped/data.bin");
+	if (owns_packed_data) {
+		memdelete(packed_data);
+	}
+}
+
+TEST_CASE("[PCKPacker] Binary resources load from a mapped pack") {
+	const String source_path = TestUtils::get_temp_path("mapped_resource.res");
+	const String output_pck_path = TestUtils::get_temp_path("output_mapped_resource.pck");
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Mapped resource");
+	REQUIRE(ResourceSaver::save(resource, source_path) == OK);
+
+	PCKPacker pck_packer;
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file("res://mapped/resource.res", source_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	PackedData *packed_data = PackedData::get_singleton();
+	const bool owns_packed_data = packed_data == nullptr;
+	if (owns_packed_data) {
+		packed_data = memnew(PackedData);
+	}
+	REQUIRE(packed_data->add_pack(output_pck_path, true, 0) == OK);
+
+	// The binary loader switches endianness on the file before reading anything.
+	const Ref<Resource> loaded = ResourceLoader::load("res://mapped/resource.res", "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "Mapped resource");
+
+	packed_data->remove_path("res://mapped/resource.res");
+	if (owns_packed_data) {
+		memdelete(packed_data);
+	}
+}
 } // namespace TestPCKPacker
@@ -30,15 +30,52 @@
 
 #pragma once
 
+#include "core/io/file_access.h"
+#include "core/io/marshalls.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/os/os.h"
+#include "core/templates/sort_array.h"
 
 #include "thirdparty/doctest/doctest.h"
 
 #include "tests/test_macros.h"
 
+// Drives the load graph queue without starting any load, so the order it picks can be checked.
+class TestResourceLoaderInternalsAccessor {
+public:
+	static void enqueue(const String &p_path, int p_priority, uint32_t p_request_count = 1) {
+		MutexLock lock(ResourceLoader::load_graph_mutex);
+		ResourceLoader::LoadGraphNode *node = ResourceLoader::_load_graph_get_node(p_path, "");
+		node->priority = p_priority;
+		node->request_count = p_request_count;
+		ResourceLoader::_load_graph_enqueue(node);
+	}
+
+	static void add_dependency(const String &p_path, const String &p_dependency) {
+		MutexLock lock(ResourceLoader::load_graph_mutex);
+		ResourceLoader::load_graph_nodes[p_path].dependencies.push_back(ResourceLoader::load_graph_nodes.getptr(p_dependency));
+	}
+
+	static int get_priority(const String &p_path) {
+		MutexLock lock(ResourceLoader::load_graph_mutex);
+		return ResourceLoader::load_graph_nodes[p_path].priority;
+	}
+
+	// Pops the node that would be started next, and forgets about it.
+	static String pop() {
+		MutexLock lock(ResourceLoader::load_graph_mutex);
+		ERR_FAIL_COND_V(ResourceLoader::load_graph_queue.is_empty(), String());
+		SortArray<ResourceLoader::LoadGraphNode *, ResourceLoader::LoadGraphNodeSort> sorter;
+		sorter.pop_heap(0, ResourceLoader::load_graph_queue.size(), ResourceLoader::load_graph_queue.ptr());
+		String path = ResourceLoader::load_graph_queue[ResourceLoader::load_graph_queue.size() - 1]->local_path;
+		ResourceLoader::load_graph_queue.resize(ResourceLoader::load_graph_queue.size() - 1);
+		ResourceLoader::load_graph_nodes.erase(path);
+		return path;
+	}
+};
+
 namespace TestResource {
 
 TEST_CASE("[Resource] Duplication") {
@@ -111,6 +148,117 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Binary format with compressed properties and sub-resource loading") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Ref<Resource> child_resource = memnew(Resource);
+	child_resource->set_name("Child");
+	Ref<Resource> grandchild_resource = memnew(Resource);
+	grandchild_resource->set_name("Grandchild");
+	PackedInt32Array values;
+	for (int i = 0; i < 4096; i++) {
+		values.push_back(i % 16);
+	}
+	grandchild_resource->set_meta("values", values);
+	child_resource->set_meta("child", grandchild_resource);
+	resource->set_meta("child", child_resource);
+	Ref<Resource> sibling_resource = memnew(Resource);
+	sibling_resource->set_name("Sibling");
+	resource->set_meta("sibling", sibling_resource);
+
+	const String save_path_plain = TestUtils::get_temp_path("resource_plain.res");
+	const String save_path_compressed = TestUtils::get_temp_path("resource_compressed_properties.res");
+	ResourceSaver::save(resource, save_path_plain);
+	ResourceSaver::save(resource, save_path_compressed, ResourceSaver::FLAG_COMPRESS_PROPERTIES);
+
+	const Vector<uint8_t> plain_bytes = FileAccess::get_file_as_bytes(save_path_plain);
+	const Vector<uint8_t> compressed_bytes = FileAccess::get_file_as_bytes(save_path_compressed);
+	REQUIRE(plain_bytes.size() > 24);
+	REQUIRE(compressed_bytes.size() > 24);
+	CHECK_MESSAGE(
+			plain_bytes[20] == 6,
+			"Files without compressed properties should keep format version 6.");
+	CHECK_MESSAGE(
+			compressed_bytes[20] == 7,
+			"Files with compressed properties should use format version 7.");
+	CHECK_MESSAGE(
+			compressed_bytes.size() < plain_bytes.size(),
+			"Compressing the properties should reduce the file size.");
+
+	const Ref<Resource> loaded_resource = ResourceLoader::load(save_path_compressed, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	CHECK(loaded_resource->get_name() == "Root");
+	const Ref<Resource> loaded_child = loaded_resource->get_meta("child");
+	REQUIRE(loaded_child.is_valid());
+	CHECK(loaded_child->get_name() == "Child");
+	const Ref<Resource> loaded_grandchild = loaded_child->get_meta("child");
+	REQUIRE(loaded_grandchild.is_valid());
+	CHECK(loaded_grandchild->get_name() == "Grandchild");
+	CHECK(PackedInt32Array(loaded_grandchild->get_meta("values")) == values);
+
+	for (const String &save_path : { save_path_plain, save_path_compressed }) {
+		const Ref<Resource> sub_resource = ResourceLoader::load(save_path + "::" + child_resource->get_scene_unique_id(), "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+		REQUIRE_MESSAGE(
+				sub_resource.is_valid(),
+				"A built-in resource should be loadable on its own.");
+		CHECK(sub_resource->get_name() == "Child");
+		const Ref<Resource> sub_resource_child = sub_resource->get_meta("child");
+		REQUIRE_MESSAGE(
+				sub_resource_child.is_valid(),
+				"Dependencies of a sub-resource should be loaded along with it.");
+		CHECK(sub_resource_child->get_name() == "Grandchild");
+		CHECK(PackedInt32Array(sub_resource_child->get_meta("values")) == values);
+	}
+
+	// Cached loads register every decoded built-in resource under its path, which shows what was decoded.
+	for (const String &save_path : { save_path_plain, save_path_compressed }) {
+		const String sub_resource_path = save_path + "::" + child_resource->get_scene_unique_id();
+		const Ref<Resource> sub_resource = ResourceLoader::load(sub_resource_path, "", ResourceFormatLoader::CACHE_MODE_REUSE);
+		REQUIRE(sub_resource.is_valid());
+		CHECK(ResourceCache::has(save_path + "::" + grandchild_resource->get_scene_unique_id()));
+		CHECK_MESSAGE(
+				!ResourceCache::has(save_path + "::" + sibling_resource->get_scene_unique_id()),
+				"Built-in resources the sub-resource doesn't use should not be decoded.");
+		CHECK_MESSAGE(
+				!ResourceCache::has(save_path),
+				"The main resource should not be decoded.");
+
+		// Only loading understands sub-resource paths, the other operations must not try to open them.
+		List<String> dependencies;
+		ResourceLoader::get_dependencies(sub_resource_path, &dependencies);
+		CHECK(dependencies.is_empty());
+		CHECK(ResourceLoader::get_resource_type(sub_resource_path).is_empty());
+		CHECK(ResourceLoader::get_resource_uid(sub_resource_path) == ResourceUID::INVALID_ID);
+	}
+
+	// Both block sizes precede the zstd frame of the first compressed property block.
+	int frame_offset = -1;
+	for (int i = 8; i + 4 <= compressed_bytes.size(); i++) {
+		if (compressed_bytes[i] == 0x28 && compressed_bytes[i + 1] == 0xB5 && compressed_bytes[i + 2] == 0x2F && compressed_bytes[i + 3] == 0xFD) {
+			frame_offset = i;
+			break;
+		}
+	}
+	REQUIRE(frame_offset >= 0);
+
+	const String save_path_corrupt = TestUtils::get_temp_path("resource_corrupt_block_size.res");
+	for (const uint32_t size_offset : { 8u, 4u }) {
+		Vector<uint8_t> corrupt_bytes = compressed_bytes;
+		encode_uint32(0xFFFFFFF0, corrupt_bytes.ptrw() + frame_offset - size_offset);
+		{
+			Ref<FileAccess> f = FileAccess::open(save_path_corrupt, FileAccess::WRITE);
+			REQUIRE(f.is_valid());
+			f->store_buffer(corrupt_bytes.ptr(), corrupt_bytes.size());
+		}
+		ERR_PRINT_OFF;
+		const Ref<Resource> corrupt_resource = ResourceLoader::load(save_path_corrupt, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+		ERR_PRINT_ON;
+		CHECK_MESSAGE(
+				corrupt_resource.is_null(),
+				"Block sizes larger than the file should be rejected before allocating.");
+	}
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -165,4 +313,97 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[SceneTree][Resource] Threaded loading of dependency graphs") {
+	const String save_path_shared = TestUtils::get_temp_path("graph_shared.res");
+	const String save_path_near = TestUtils::get_temp_path("graph_near.res");
+	const String save_path_far = TestUtils::get_temp_path("graph_far.res");
+	{
+		Ref<Resource> resource_shared = memnew(Resource);
+		resource_shared->set_name("Shared");
+		resource_shared->set_path(save_path_shared);
+		ResourceSaver::save(resource_shared, save_path_shared);
+
+		Ref<Resource> resource_near = memnew(Resource);
+		resource_near->set_name("Near");
+		resource_near->set_meta("shared", resource_shared);
+		ResourceSaver::save(resource_near, save_path_near);
+
+		Ref<Resource> resource_far = memnew(Resource);
+		resource_far->set_name("Far");
+		resource_far->set_meta("shared", resource_shared);
+		ResourceSaver::save(resource_far, save_path_far);
+	}
+	REQUIRE_FALSE(ResourceCache::has(save_path_shared));
+
+	CHECK(ResourceLoader::load_threaded_request_graph(save_path_far, "", -1) == OK);
+	CHECK(ResourceLoader::load_threaded_request_graph(save_path_near, "", 1) == OK);
+	ResourceLoader::load_threaded_set_priority(save_path_far, 0);
+
+	const Ref<Resource> loaded_near = ResourceLoader::load_threaded_get(save_path_near);
+	const Ref<Resource> loaded_far = ResourceLoader::load_threaded_get(save_path_far);
+	REQUIRE(loaded_near.is_valid());
+	REQUIRE(loaded_far.is_valid());
+	CHECK(loaded_near->get_name() == "Near");
+	CHECK(loaded_far->get_name() == "Far");
+
+	const Ref<Resource> shared_near = loaded_near->get_meta("shared");
+	const Ref<Resource> shared_far = loaded_far->get_meta("shared");
+	REQUIRE(shared_near.is_valid());
+	CHECK(shared_near->get_name() == "Shared");
+	CHECK(shared_near->get_path() == save_path_shared);
+	CHECK_MESSAGE(
+			shared_near == shared_far,
+			"A dependency shared by two requests should only be loaded once.");
+
+	CHECK(ResourceLoader::load_threaded_get_status(save_path_near) == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE);
+	CHECK(ResourceLoader::load_threaded_get_status(save_path_far) == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE);
+}
+
+TEST_CASE("[Resource] Load graph queue honors priorities") {
+	using Accessor = TestResourceLoaderInternalsAccessor;
+
+	SUBCASE("Higher priorities load first, ties in request order") {
+		Accessor::enqueue("res://low.res", -1);
+		Accessor::enqueue("res://high.res", 5);
+		Accessor::enqueue("res://first.res", 0);
+		Accessor::enqueue("res://second.res", 0);
+		CHECK(Accessor::pop() == "res://high.res");
+		CHECK(Accessor::pop() == "res://first.res");
+		CHECK(Accessor::pop() == "res://second.res");
+		CHECK(Accessor::pop() == "res://low.res");
+	}
+
+	SUBCASE("Changing the priority of a request reorders the queue") {
+		Accessor::enqueue("res://a.res", 1);
+		Accessor::enqueue("res://b.res", 2);
+		Accessor::enqueue("res://c.res", 3);
+		ResourceLoader::load_threaded_set_priority("res://a.res", 10);
+		ResourceLoader::load_threaded_set_priority("res://c.res", 0);
+		CHECK(Accessor::pop() == "res://a.res");
+		CHECK(Accessor::pop() == "res://b.res");
+		CHECK(Accessor::pop() == "res://c.res");
+	}
+
+	SUBCASE("Shared dependencies keep the highest priority asked for") {
+		Accessor::enqueue("res://shared.res", 5, 2);
+		Accessor::enqueue("res://own.res", 5);
+		Accessor::enqueue("res://root.res", 5);
+		Accessor::add_dependency("res://root.res", "res://shared.res");
+		Accessor::add_dependency("res://root.res", "res://own.res");
+
+		ResourceLoader::load_threaded_set_priority("res://root.res", 1);
+		CHECK(Accessor::get_priority("res://root.res") == 1);
+		CHECK(Accessor::get_priority("res://own.res") == 1);
+		CHECK_MESSAGE(
+				Accessor::get_priority("res://shared.res") == 5,
+				"Lowering one request shouldn't lower a dependency another request still wants sooner.");
+
+		ResourceLoader::load_threaded_set_priority("res://root.res", 9);
+		CHECK(Accessor::get_priority("res://shared.res") == 9);
+		CHECK(Accessor::pop() == "res://shared.res");
+		CHECK(Accessor::pop() == "res://own.res");
+		CHECK(Accessor::pop() == "res://root.res");
+	}
+}
 } // namespace TestResource
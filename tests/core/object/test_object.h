@@ -33,6 +33,7 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 
 #include "tests/test_macros.h"
 
@@ -62,7 +63,12 @@ protected:
 	}
 
 public:
-	void set_property(int value) { property_value = value; }
+	int set_property_calls = 0;
+
+	void set_property(int value) {
+		property_value = value;
+		set_property_calls++;
+	}
 	int get_property() const { return property_value; }
 };
 
@@ -464,6 +470,116 @@ TEST_CASE("[Object] Signals") {
 	}
 }
 
+static void _connect_on_emit(int p_value, Object *p_object, Object *p_target) {
+	if (!p_object->is_connected("value_changed", Callable(p_target, "set_property"))) {
+		p_object->connect("value_changed", Callable(p_target, "set_property"));
+	}
+}
+
+TEST_CASE("[Object] Signal emission through connection snapshots") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	Object object;
+	object.add_user_signal(MethodInfo("value_changed", PropertyInfo(Variant::INT, "value")));
+
+	_TestDerivedObject target;
+	target.set_property(0);
+
+	SUBCASE("Method callables should receive the emitted arguments") {
+		object.connect("value_changed", Callable(&target, "set_property"));
+		CHECK(object.emit_signal("value_changed", 7) == OK);
+		CHECK(target.get_property() == 7);
+
+		// Arguments that need conversion must still go through the regular call.
+		CHECK(object.emit_signal("value_changed", 3.0) == OK);
+		CHECK(target.get_property() == 3);
+
+		// A freed target must be skipped silently.
+		_TestDerivedObject *temporary = memnew(_TestDerivedObject);
+		object.connect("value_changed", Callable(temporary, "set_property"));
+		CHECK(object.emit_signal("value_changed", 5) == OK);
+		CHECK(temporary->get_property() == 5);
+		memdelete(temporary);
+		CHECK(object.emit_signal("value_changed", 9) == OK);
+		CHECK(target.get_property() == 9);
+	}
+
+	SUBCASE("Connections changed between emissions should be picked up") {
+		_TestDerivedObject other;
+		other.set_property(0);
+
+		object.connect("value_changed", Callable(&target, "set_property"));
+		CHECK(object.emit_signal("value_changed", 1) == OK);
+
+		object.connect("value_changed", Callable(&other, "set_property"));
+		CHECK(object.emit_signal("value_changed", 2) == OK);
+		CHECK(target.get_property() == 2);
+		CHECK(other.get_property() == 2);
+
+		object.disconnect("value_changed", Callable(&target, "set_property"));
+		CHECK(object.emit_signal("value_changed", 3) == OK);
+		CHECK(target.get_property() == 2);
+		CHECK(other.get_property() == 3);
+	}
+
+	SUBCASE("Disconnecting a connection in the middle should keep the others") {
+		_TestDerivedObject other;
+		_TestDerivedObject last;
+		other.set_property(0);
+		last.set_property(0);
+
+		object.connect("value_changed", Callable(&target, "set_property"));
+		object.connect("value_changed", Callable(&other, "set_property"));
+		object.connect("value_changed", Callable(&last, "set_property"));
+		CHECK(object.emit_signal("value_changed", 1) == OK);
+
+		object.disconnect("value_changed", Callable(&other, "set_property"));
+		CHECK(object.emit_signal("value_changed", 2) == OK);
+		CHECK(target.get_property() == 2);
+		CHECK(other.get_property() == 1);
+		CHECK(last.get_property() == 2);
+
+		object.connect("value_changed", Callable(&other, "set_property"));
+		CHECK(object.emit_signal("value_changed", 3) == OK);
+		CHECK(target.get_property() == 3);
+		CHECK(other.get_property() == 3);
+		CHECK(last.get_property() == 3);
+
+		object.disconnect("value_changed", Callable(&target, "set_property"));
+		object.disconnect("value_changed", Callable(&other, "set_property"));
+		object.disconnect("value_changed", Callable(&last, "set_property"));
+		CHECK(object.emit_signal("value_changed", 4) == OK);
+		CHECK(target.get_property() == 3);
+	}
+
+	SUBCASE("One-shot connections should only be called once") {
+		object.connect("value_changed", Callable(&target, "set_property"), Object::CONNECT_ONE_SHOT);
+		CHECK(object.emit_signal("value_changed", 4) == OK);
+		CHECK(target.get_property() == 4);
+		CHECK_FALSE(object.is_connected("value_changed", Callable(&target, "set_property")));
+		CHECK(object.emit_signal("value_changed", 8) == OK);
+		CHECK(target.get_property() == 4);
+		CHECK(target.set_property_calls == 2); // Including the set_property(0) above.
+	}
+
+	SUBCASE("Connections made during emission should only apply to the next emission") {
+		_TestDerivedObject other;
+		other.set_property(0);
+
+		object.connect("value_changed", callable_mp_static(&_connect_on_emit).bind(&object, &other));
+		CHECK(object.emit_signal("value_changed", 6) == OK);
+		CHECK(other.get_property() == 0);
+		CHECK(object.emit_signal("value_changed", 10) == OK);
+		CHECK(other.get_property() == 10);
+	}
+
+	SUBCASE("Calling a method with the wrong arguments should report an error") {
+		object.connect("value_changed", Callable(&target, "get_property"));
+		ERR_PRINT_OFF;
+		CHECK(object.emit_signal("value_changed", 1) == ERR_METHOD_NOT_FOUND);
+		ERR_PRINT_ON;
+	}
+}
+
 class NotificationObject1 : public Object {
 	GDCLASS(NotificationObject1, Object);
 
@@ -600,4 +716,121 @@ TEST_CASE("[Object] Destruction at the end of the call chain is safe") {
 			"Object was tail-deleted without crashes.");
 }
 
+TEST_CASE("[Object] ObjectDB lookups across freed and reused slots") {
+	// Enough objects to span several slot blocks.
+	const int count = 3 * 4096 + 7;
+
+	LocalVector<Object *> objects;
+	LocalVector<ObjectID> ids;
+	for (int i = 0; i < count; i++) {
+		objects.push_back(memnew(Object));
+		ids.push_back(objects[i]->get_instance_id());
+	}
+
+	bool all_found = true;
+	for (int i = 0; i < count; i++) {
+		all_found &= ObjectDB::get_instance(ids[i]) == objects[i];
+	}
+	CHECK(all_found);
+
+	for (int i = 0; i < count; i += 2) {
+		memdelete(objects[i]);
+		objects[i] = nullptr;
+	}
+
+	// Freed slots are reused, but the old IDs must not resolve to the new objects.
+	LocalVector<Object *> reused;
+	for (int i = 0; i < count; i += 2) {
+		reused.push_back(memnew(Object));
+	}
+
+	bool stale_rejected = true;
+	bool live_found = true;
+	for (int i = 0; i < count; i++) {
+		if (objects[i]) {
+			live_found &= ObjectDB::get_instance(ids[i]) == objects[i];
+		} else {
+			stale_rejected &= ObjectDB::get_instance(ids[i]) == nullptr;
+		}
+	}
+	for (Object *object : reused) {
+		live_found &= ObjectDB::get_instance(object->get_instance_id()) == object;
+	}
+	CHECK(stale_rejected);
+	CHECK(live_found);
+
+	for (Object *object : objects) {
+		if (object) {
+			memdelete(object);
+		}
+	}
+	for (Object *object : reused) {
+		memdelete(object);
+	}
+}
+
+struct ObjectDBLookupData {
+	LocalVector<ObjectID> live_ids;
+	LocalVector<Object *> live_objects;
+	LocalVector<ObjectID> stale_ids;
+	SafeFlag exit;
+	SafeFlag failed;
+};
+
+static void object_db_lookup_thread(void *p_userdata) {
+	ObjectDBLookupData *data = (ObjectDBLookupData *)p_userdata;
+	while (!data->exit.is_set()) {
+		for (uint32_t i = 0; i < data->live_ids.size(); i++) {
+			if (ObjectDB::get_instance(data->live_ids[i]) != data->live_objects[i]) {
+				data->failed.set();
+			}
+		}
+		for (const ObjectID &id : data->stale_ids) {
+			if (ObjectDB::get_instance(id) != nullptr) {
+				data->failed.set();
+			}
+		}
+	}
+}
+
+TEST_CASE("[Object] ObjectDB lookups from other threads while instances are added and removed") {
+	ObjectDBLookupData data;
+	for (int i = 0; i < 64; i++) {
+		Object *object = memnew(Object);
+		data.live_objects.push_back(object);
+		data.live_ids.push_back(object->get_instance_id());
+	}
+	for (int i = 0; i < 64; i++) {
+		Object *object = memnew(Object);
+		data.stale_ids.push_back(object->get_instance_id());
+		memdelete(object);
+	}
+
+	Thread threads[4];
+	for (Thread &thread : threads) {
+		thread.start(object_db_lookup_thread, &data);
+	}
+
+	// Churn slots, including the freed ones the stale IDs pointed to, and grow the slot blocks.
+	for (int round = 0; round < 8; round++) {
+		LocalVector<Object *> churn;
+		for (int i = 0; i < 2048; i++) {
+			churn.push_back(memnew(Object));
+		}
+		for (Object *object : churn) {
+			memdelete(object);
+		}
+	}
+
+	data.exit.set();
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+	CHECK_FALSE(data.failed.is_set());
+
+	for (Object *object : data.live_objects) {
+		memdelete(object);
+	}
+}
+
 } // namespace TestObject
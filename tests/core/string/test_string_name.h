@@ -0,0 +1,185 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning and search") {
+	const StringName from_string = StringName(String("string_name_interning_test"));
+	const StringName from_cstring = StringName("string_name_interning_test");
+
+	CHECK(from_string == from_cstring);
+	CHECK(from_string.data_unique_pointer() == from_cstring.data_unique_pointer());
+	CHECK(StringName::search("string_name_interning_test") == from_string);
+	CHECK(StringName::search(String("string_name_interning_test")) == from_string);
+	CHECK(StringName::search(U"string_name_interning_test") == from_string);
+	CHECK(StringName::search("string_name_interning_test_missing") == StringName());
+}
+
+TEST_CASE("[StringName] Table stats") {
+	const StringName name = StringName("string_name_stats_test");
+
+	StringName::reset_table_stats();
+	for (int i = 0; i < 10; i++) {
+		StringName again = StringName("string_name_stats_test");
+		CHECK(again == name);
+	}
+	StringName::search("string_name_stats_test_missing");
+
+	const StringName::TableStats stats = StringName::get_table_stats();
+	CHECK(stats.lookups >= 11);
+	CHECK(stats.hits >= 10);
+	CHECK(stats.hits < stats.lookups);
+}
+
+static constexpr int STRING_NAME_TASK_NAMES = 512;
+static const String *string_name_sources = nullptr;
+static const void **string_name_results = nullptr;
+static int string_name_rounds = 0;
+
+static void static_intern_names(void *p_arg, uint32_t p_index) {
+	for (int round = 0; round < string_name_rounds; round++) {
+		for (int i = 0; i < STRING_NAME_TASK_NAMES; i++) {
+			// Start each task at a different name so tasks race on inserting them.
+			const int name_index = (i + p_index * 7) % STRING_NAME_TASK_NAMES;
+			const StringName name = StringName(string_name_sources[name_index]);
+			if (round == 0) {
+				string_name_results[p_index * STRING_NAME_TASK_NAMES + name_index] = name.data_unique_pointer();
+			}
+		}
+	}
+}
+
+static void run_intern_tasks(int p_task_count, int p_rounds) {
+	string_name_rounds = p_rounds;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_intern_names, nullptr, p_task_count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+}
+
+TEST_CASE("[StringName] Concurrent interning yields a single entry per name") {
+	const int task_count = 16;
+
+	LocalVector<String> sources;
+	sources.resize(STRING_NAME_TASK_NAMES);
+	for (int i = 0; i < STRING_NAME_TASK_NAMES; i++) {
+		sources[i] = vformat("string_name_concurrent_%d", i);
+	}
+	LocalVector<const void *> results;
+	results.resize(task_count * STRING_NAME_TASK_NAMES);
+	string_name_sources = sources.ptr();
+	string_name_results = results.ptr();
+
+	// The names are released as soon as each task drops them, so this also races insertion against removal.
+	run_intern_tasks(task_count, 1);
+
+	// Keep the names alive, then check every task resolves to the same entry.
+	LocalVector<StringName> names;
+	for (int i = 0; i < STRING_NAME_TASK_NAMES; i++) {
+		names.push_back(StringName(sources[i]));
+	}
+	run_intern_tasks(task_count, 1);
+
+	bool all_match = true;
+	for (int task = 0; task < task_count; task++) {
+		for (int i = 0; i < STRING_NAME_TASK_NAMES; i++) {
+			all_match &= results[task * STRING_NAME_TASK_NAMES + i] == names[i].data_unique_pointer();
+		}
+	}
+	CHECK(all_match);
+
+	string_name_sources = nullptr;
+	string_name_results = nullptr;
+}
+
+TEST_CASE("[StringName] Table stats count concurrent lookups of existing names") {
+	const int task_count = MAX(OS::get_singleton()->get_processor_count(), 2);
+	const int rounds = 4;
+
+	LocalVector<String> sources;
+	sources.resize(STRING_NAME_TASK_NAMES);
+	LocalVector<StringName> names;
+	for (int i = 0; i < STRING_NAME_TASK_NAMES; i++) {
+		sources[i] = vformat("string_name_stats_%d", i);
+		names.push_back(StringName(sources[i]));
+	}
+	LocalVector<const void *> results;
+	results.resize(task_count * STRING_NAME_TASK_NAMES);
+	string_name_sources = sources.ptr();
+	string_name_results = results.ptr();
+
+	StringName::reset_table_stats();
+	run_intern_tasks(task_count, rounds);
+	const StringName::TableStats stats = StringName::get_table_stats();
+
+	// Every name already exists, so every lookup from the tasks is a hit.
+	const uint64_t expected = uint64_t(task_count) * rounds * STRING_NAME_TASK_NAMES;
+	CHECK(stats.lookups >= expected);
+	CHECK(stats.hits >= expected);
+
+	string_name_sources = nullptr;
+	string_name_results = nullptr;
+}
+
+TEST_CASE("[Benchmark][StringName] Concurrent lookups of existing names" * doctest::skip()) {
+	const int task_count = MAX(OS::get_singleton()->get_processor_count(), 2);
+	const int rounds = 64;
+
+	LocalVector<String> sources;
+	sources.resize(STRING_NAME_TASK_NAMES);
+	LocalVector<StringName> names;
+	for (int i = 0; i < STRING_NAME_TASK_NAMES; i++) {
+		sources[i] = vformat("string_name_benchmark_%d", i);
+		names.push_back(StringName(sources[i]));
+	}
+	LocalVector<const void *> results;
+	results.resize(task_count * STRING_NAME_TASK_NAMES);
+	string_name_sources = sources.ptr();
+	string_name_results = results.ptr();
+
+	StringName::reset_table_stats();
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	run_intern_tasks(task_count, rounds);
+	const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+	const StringName::TableStats stats = StringName::get_table_stats();
+
+	MESSAGE(vformat("%d tasks, %d lookups: %d usec, %.2f%% hits, %d contended locks.", task_count, (int64_t)stats.lookups, (int64_t)usec, stats.hits / double(stats.lookups) * 100, (int64_t)stats.contended).utf8().get_data());
+
+	string_name_sources = nullptr;
+	string_name_results = nullptr;
+}
+
+} // namespace TestStringName
@@ -0,0 +1,335 @@
+/**************************************************************************/
+/*  test_swiss_hash_map.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/swiss_hash_map.h"
+#include "core/variant/variant.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSwissHashMap {
+
+TEST_CASE("[SwissHashMap] List initialization") {
+	SwissHashMap<int, String> map{ { 0, "A" }, { 1, "B" }, { 2, "C" }, { 3, "D" }, { 4, "E" } };
+
+	CHECK(map.size() == 5);
+	CHECK(map[0] == "A");
+	CHECK(map[1] == "B");
+	CHECK(map[2] == "C");
+	CHECK(map[3] == "D");
+	CHECK(map[4] == "E");
+}
+
+TEST_CASE("[SwissHashMap] Insert element") {
+	SwissHashMap<int, int> map;
+	SwissHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[SwissHashMap] Overwrite element") {
+	SwissHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 1234);
+}
+
+TEST_CASE("[SwissHashMap] Erase via element") {
+	SwissHashMap<int, int> map;
+	SwissHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[SwissHashMap] Iteration keeps insertion order across erase and reinsert") {
+	SwissHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+	map.erase(0);
+	map.insert(7, 7);
+	map.insert(0, 1);
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+	expected.push_back(Pair<int, int>(7, 7));
+	expected.push_back(Pair<int, int>(0, 1));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		idx++;
+	}
+	CHECK(idx == expected.size());
+	CHECK(map.last()->key == 0);
+
+	const SwissHashMap<int, int> const_map = map;
+	idx = 0;
+	for (SwissHashMap<int, int>::ConstIterator it = const_map.begin(); it; ++it) {
+		CHECK(expected[idx] == Pair<int, int>(it->key, it->value));
+		idx++;
+	}
+	CHECK(idx == expected.size());
+}
+
+TEST_CASE("[SwissHashMap] Clear and reserve") {
+	SwissHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+
+	map.clear();
+	CHECK(!map.has(42));
+	CHECK(map.size() == 0);
+	CHECK(map.is_empty());
+	CHECK(!map.begin());
+
+	map.reserve(1000);
+	const uint32_t capacity = map.get_capacity();
+	CHECK(capacity >= 1000);
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, i);
+	}
+	CHECK(map.get_capacity() == capacity);
+}
+
+TEST_CASE("[SwissHashMap] Get") {
+	SwissHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+
+	CHECK(map.get(123) == 12385);
+	map.get(123) = 10;
+	CHECK(map.get(123) == 10);
+
+	CHECK(*map.getptr(0) == 12934);
+	*map.getptr(0) = 1;
+	CHECK(*map.getptr(0) == 1);
+
+	CHECK(map.get(42) == 84);
+	CHECK(map.getptr(-10) == nullptr);
+}
+
+TEST_CASE("[SwissHashMap] Insert, iterate and remove many strings") {
+	const int elem_max = 4321;
+	SwissHashMap<String, String> map;
+	for (int i = 0; i < elem_max; i++) {
+		map.insert(itos(i), itos(i));
+	}
+
+	// Erase and insert repeatedly so tombstones pile up and the table gets rebuilt.
+	Vector<String> elems_still_valid;
+	for (int i = 0; i < elem_max; i++) {
+		if ((i % 5) != 0) {
+			map.erase(itos(i));
+			map.insert(itos(i), itos(i));
+		}
+	}
+	for (int i = 0; i < elem_max; i++) {
+		if ((i % 5) == 0) {
+			map.erase(itos(i));
+		}
+	}
+	for (int i = 0; i < elem_max; i++) {
+		if ((i % 5) != 0) {
+			elems_still_valid.push_back(itos(i));
+		}
+	}
+
+	CHECK(elems_still_valid.size() == map.size());
+
+	int idx = 0;
+	for (const KeyValue<String, String> &E : map) {
+		CHECK(elems_still_valid[idx] == E.key);
+		CHECK(elems_still_valid[idx] == E.value);
+		idx++;
+	}
+
+	for (int i = 0; i < elem_max; i++) {
+		CHECK(map.has(itos(i)) == ((i % 5) != 0));
+	}
+}
+
+TEST_CASE("[SwissHashMap] Copy constructor and operator =") {
+	SwissHashMap<int, int> map0;
+	const uint32_t count = 50;
+	for (uint32_t i = 0; i < count; i++) {
+		map0.insert(i, i);
+	}
+	map0.erase(3);
+
+	SwissHashMap<int, int> map1(map0);
+	CHECK(map0.size() == map1.size());
+	CHECK(map0.get_capacity() == map1.get_capacity());
+	CHECK(!map1.has(3));
+	CHECK(*map1.getptr(49) == 49);
+
+	SwissHashMap<int, int> map2;
+	map2.insert(1234, 1234);
+	map2 = map1;
+	CHECK(map2.size() == count - 1);
+	CHECK(!map2.has(1234));
+
+	// The copies are independent.
+	map1.erase(10);
+	CHECK(map0.has(10));
+	CHECK(map2.has(10));
+}
+
+TEST_CASE("[SwissHashMap] Sort") {
+	SwissHashMap<Variant, int, VariantHasher, StringLikeVariantComparator> map;
+	map.insert(5, 0);
+	map.insert(3, 1);
+	map.insert(9, 2);
+	map.insert(1, 3);
+	map.erase(9);
+	map.sort();
+
+	Vector<int> expected = { 1, 3, 5 };
+	int idx = 0;
+	for (const KeyValue<Variant, int> &E : map) {
+		CHECK(int(E.key) == expected[idx]);
+		CHECK(map.has(E.key));
+		idx++;
+	}
+	CHECK(map[3] == 1);
+}
+
+TEST_CASE("[SwissHashMap] Pointers and iterators stay valid while inserting") {
+	SwissHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> map;
+	Variant &first = map["first"];
+	first = 1;
+	const Variant *first_ptr = map.getptr("first");
+	SwissHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator first_it = map.find("first");
+
+	// Enough to grow the table and add entry pages several times.
+	for (int i = 0; i < 1000; i++) {
+		map[i] = i;
+	}
+
+	CHECK(map.getptr("first") == first_ptr);
+	CHECK(&map["first"] == &first);
+	CHECK(&first_it->value == first_ptr);
+	first = 2;
+	CHECK(int(map["first"]) == 2);
+
+	int count = 0;
+	for (++first_it; first_it; ++first_it) {
+		CHECK(int(first_it->key) == count);
+		count++;
+	}
+	CHECK(count == 1000);
+}
+
+TEST_CASE("[SwissHashMap] Erasing most elements packs the rest in order") {
+	SwissHashMap<int, String> map;
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, itos(i));
+	}
+	// Leaves far more tombstones than live entries, so the entries get packed.
+	for (int i = 0; i < 1000; i++) {
+		if (i % 10 != 0) {
+			map.erase(i);
+		}
+	}
+
+	CHECK(map.size() == 100);
+	int expected = 0;
+	for (const KeyValue<int, String> &E : map) {
+		CHECK(E.key == expected);
+		CHECK(E.value == itos(expected));
+		CHECK(map.has(expected));
+		expected += 10;
+	}
+	CHECK(expected == 1000);
+	CHECK(map.last()->key == 990);
+}
+
+template <typename TMap>
+static uint64_t benchmark_variant_map(const LocalVector<Variant> &p_keys, int p_rounds) {
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	int64_t checksum = 0;
+	for (int round = 0; round < p_rounds; round++) {
+		TMap map;
+		for (uint32_t i = 0; i < p_keys.size(); i++) {
+			map.insert(p_keys[i], int(i));
+		}
+		for (uint32_t i = 0; i < p_keys.size(); i++) {
+			checksum += *map.getptr(p_keys[i]);
+		}
+		for (uint32_t i = 0; i < p_keys.size(); i += 3) {
+			map.erase(p_keys[i]);
+		}
+		for (const KeyValue<Variant, int> &E : map) {
+			checksum -= E.value;
+		}
+	}
+	CHECK(checksum > 0);
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+TEST_CASE("[Benchmark][SwissHashMap] HashMap against SwissHashMap with Variant keys" * doctest::skip()) {
+	const int key_count = 20000;
+	const int rounds = 10;
+
+	// Mix of integer and string keys, like typical Dictionary payloads.
+	LocalVector<Variant> keys;
+	for (int i = 0; i < key_count; i++) {
+		if (i % 2) {
+			keys.push_back(i * 7919);
+		} else {
+			keys.push_back(vformat("key_%d", i));
+		}
+	}
+
+	const uint64_t hash_map_usec = benchmark_variant_map<HashMap<Variant, int, VariantHasher, StringLikeVariantComparator>>(keys, rounds);
+	const uint64_t swiss_hash_map_usec = benchmark_variant_map<SwissHashMap<Variant, int, VariantHasher, StringLikeVariantComparator>>(keys, rounds);
+
+	MESSAGE(vformat("%d keys x %d rounds of insert, lookup, erase and iterate: HashMap %d usec, SwissHashMap %d usec.", key_count, rounds, (int64_t)hash_map_usec, (int64_t)swiss_hash_map_usec).utf8().get_data());
+}
+
+} // namespace TestSwissHashMap
@@ -106,6 +106,99 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_range_group_test(void *p_arg, uint32_t p_begin, uint32_t p_end) {
+	for (uint32_t i = p_begin; i < p_end; i++) {
+		counter[i].increment();
+	}
+	counter[0].add((uintptr_t)p_arg * (p_end - p_begin));
+}
+
+struct RangeGroupTest {
+	void process(uint32_t p_begin, uint32_t p_end, int p_amount) {
+		for (uint32_t i = p_begin; i < p_end; i++) {
+			counter[i].increment();
+		}
+		counter[0].sub(p_amount * (p_end - p_begin));
+	}
+};
+
+TEST_CASE("[WorkerThreadPool] Process elements using range group tasks") {
+	RangeGroupTest range_group_test;
+	for (int iterations = 0; iterations < 500; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 10.0f));
+		const int tasks = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+		const int min_chunk = Math::rand() % 2 ? -1 : (int)Math::pow(2.0f, Math::random(0.0f, 4.0f)) - 1;
+		const bool low_priority = Math::rand() % 2;
+
+		counter.clear();
+		counter.resize(count);
+		WorkerThreadPool::GroupID group1 = WorkerThreadPool::get_singleton()->add_native_group_range_task(static_range_group_test, (void *)2, count, tasks, min_chunk, !low_priority);
+		WorkerThreadPool::GroupID group2 = WorkerThreadPool::get_singleton()->add_template_group_range_task(&range_group_test, &RangeGroupTest::process, 2, count, tasks, min_chunk, low_priority);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group1);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group2);
+
+		bool all_run_once = true;
+		for (int i = 0; i < count; i++) {
+			//Reduce number of check messages
+			all_run_once &= counter[i].get() == 2;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+static float *benchmark_values = nullptr;
+
+static void static_benchmark_element(void *p_arg, uint32_t p_index) {
+	benchmark_values[p_index] = benchmark_values[p_index] * 0.5f + 1.0f;
+}
+
+static void static_benchmark_range(void *p_arg, uint32_t p_begin, uint32_t p_end) {
+	for (uint32_t i = p_begin; i < p_end; i++) {
+		benchmark_values[i] = benchmark_values[i] * 0.5f + 1.0f;
+	}
+}
+
+TEST_CASE("[Benchmark][WorkerThreadPool] Range group tasks against per-element group tasks" * doctest::skip()) {
+	const int element_count = 1 << 20;
+	const int rounds = 16;
+
+	LocalVector<float> values;
+	values.resize(element_count);
+	for (int i = 0; i < element_count; i++) {
+		values[i] = 0.0f;
+	}
+	benchmark_values = values.ptr();
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_benchmark_element, nullptr, element_count, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	}
+	uint64_t per_element_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_range_task(static_benchmark_range, nullptr, element_count, -1, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	}
+	uint64_t range_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	// Both ran the same update the same number of times, so every value must match.
+	float expected = 0.0f;
+	for (int round = 0; round < rounds * 2; round++) {
+		expected = expected * 0.5f + 1.0f;
+	}
+	bool all_match = true;
+	for (int i = 0; i < element_count; i++) {
+		all_match &= values[i] == expected;
+	}
+	CHECK(all_match);
+
+	MESSAGE(vformat("%d rounds over %d elements: per-element %d usec, range %d usec.", rounds, element_count, (int64_t)per_element_usec, (int64_t)range_usec).utf8().get_data());
+
+	benchmark_values = nullptr;
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
@@ -172,4 +265,94 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+struct StressData {
+	WorkerThreadPool *pool = nullptr;
+	SafeNumeric<uint32_t> processed;
+	uint32_t children_per_root = 0;
+};
+
+static void static_stress_child(void *p_arg) {
+	((StressData *)p_arg)->processed.increment();
+}
+
+static void static_stress_root(void *p_arg) {
+	StressData *data = (StressData *)p_arg;
+	// Spawned from a pool thread, so in work-stealing mode these go to the local deque.
+	LocalVector<WorkerThreadPool::TaskID> children;
+	children.resize(data->children_per_root);
+	for (uint32_t i = 0; i < data->children_per_root; i++) {
+		children[i] = data->pool->add_native_task(static_stress_child, data, true);
+	}
+	for (uint32_t i = 0; i < data->children_per_root; i++) {
+		data->pool->wait_for_task_completion(children[i]);
+	}
+	data->processed.increment();
+}
+
+// Runs roots that each spawn and wait for children on a new pool, returns how long it took.
+static uint64_t run_stress_tasks(int p_thread_count, bool p_work_stealing, uint32_t p_roots, uint32_t p_children_per_root, uint32_t &r_processed) {
+	WorkerThreadPool pool(false);
+	pool.init(p_thread_count, 0.3, p_work_stealing);
+	CHECK(pool.is_work_stealing_enabled() == p_work_stealing);
+
+	StressData data;
+	data.pool = &pool;
+	data.children_per_root = p_children_per_root;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+
+	LocalVector<WorkerThreadPool::TaskID> root_ids;
+	root_ids.resize(p_roots);
+	for (uint32_t i = 0; i < p_roots; i++) {
+		root_ids[i] = pool.add_native_task(static_stress_root, &data, true);
+	}
+	for (uint32_t i = 0; i < p_roots; i++) {
+		pool.wait_for_task_completion(root_ids[i]);
+	}
+
+	uint64_t elapsed = MAX(OS::get_singleton()->get_ticks_usec() - begin, (uint64_t)1);
+	r_processed = data.processed.get();
+
+	pool.finish();
+	return elapsed;
+}
+
+static LocalVector<int> get_stress_thread_counts() {
+	LocalVector<int> thread_counts = { 1, 4 };
+	int max_threads = OS::get_singleton()->get_default_thread_pool_size();
+	if (max_threads != 1 && max_threads != 4) {
+		thread_counts.push_back(max_threads);
+	}
+	return thread_counts;
+}
+
+TEST_CASE("[WorkerThreadPool] Stress nested tasks with and without work stealing") {
+	const uint32_t roots = 64;
+	const uint32_t children_per_root = 128;
+
+	for (int thread_count : get_stress_thread_counts()) {
+		for (int mode = 0; mode < 2; mode++) {
+			uint32_t processed = 0;
+			run_stress_tasks(thread_count, mode == 1, roots, children_per_root, processed);
+			CHECK_MESSAGE(processed == roots * (children_per_root + 1), "All tasks should have run exactly once.");
+		}
+	}
+}
+
+TEST_CASE("[Benchmark][WorkerThreadPool] Task throughput with and without work stealing" * doctest::skip()) {
+	const uint32_t roots = 256;
+	const uint32_t children_per_root = 512;
+	const uint32_t expected = roots * (children_per_root + 1);
+
+	for (int thread_count : get_stress_thread_counts()) {
+		for (int mode = 0; mode < 2; mode++) {
+			const bool work_stealing = mode == 1;
+			uint32_t processed = 0;
+			const uint64_t elapsed = run_stress_tasks(thread_count, work_stealing, roots, children_per_root, processed);
+			CHECK(processed == expected);
+			MESSAGE(vformat("%d thread(s), %s: %d tasks in %d usec (%d tasks/s).", thread_count, work_stealing ? "work stealing" : "shared queue", expected, (int64_t)elapsed, (int64_t)(expected * 1000000ull / elapsed)).utf8().get_data());
+		}
+	}
+}
+
 } // namespace TestWorkerThreadPool
@@ -0,0 +1,121 @@
+/**************************************************************************/
+/*  test_baked_curve_table.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/resources/baked_curve_table.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBakedCurveTable {
+
+TEST_CASE("[BakedCurveTable] Smooth curves are baked") {
+	Ref<Curve> curve = memnew(Curve);
+	curve->add_point(Vector2(0, 0));
+	curve->add_point(Vector2(0.3, 1));
+	curve->add_point(Vector2(1, 0.2));
+
+	BakedCurveTable table;
+	table.bake(curve);
+	REQUIRE(table.is_valid());
+	CHECK_FALSE(table.is_direct());
+
+	real_t max_error = 0.0;
+	for (int i = 0; i <= 1000; i++) {
+		const real_t offset = i / 1000.0;
+		max_error = MAX(max_error, Math::abs(table.sample(offset) - curve->sample(offset)));
+	}
+	CHECK(max_error <= 0.001);
+
+	table.bake(Ref<Curve>());
+	CHECK_FALSE(table.is_valid());
+}
+
+TEST_CASE("[BakedCurveTable] Sharp curves are sampled directly") {
+	Ref<Curve> curve = memnew(Curve);
+	// A step between two table entries.
+	curve->add_point(Vector2(0, 0), 0, 0, Curve::TANGENT_LINEAR, Curve::TANGENT_LINEAR);
+	curve->add_point(Vector2(0.5, 0), 0, 0, Curve::TANGENT_LINEAR, Curve::TANGENT_LINEAR);
+	curve->add_point(Vector2(0.501, 1), 0, 0, Curve::TANGENT_LINEAR, Curve::TANGENT_LINEAR);
+	curve->add_point(Vector2(1, 1), 0, 0, Curve::TANGENT_LINEAR, Curve::TANGENT_LINEAR);
+
+	BakedCurveTable table;
+	table.bake(curve);
+	REQUIRE(table.is_valid());
+	CHECK(table.is_direct());
+	for (int i = 0; i <= 1000; i++) {
+		const real_t offset = i / 1000.0;
+		CHECK(table.sample(offset) == curve->sample(offset));
+	}
+}
+
+TEST_CASE("[BakedGradientTable] Smooth gradients are baked") {
+	Ref<Gradient> gradient = memnew(Gradient);
+	gradient->set_color(0, Color(1, 0, 0, 1));
+	gradient->set_color(1, Color(0, 0, 1, 0));
+	// On a table entry, so the corner in the interpolation is kept.
+	gradient->add_point(0.4, Color(0, 1, 0, 0.5));
+
+	BakedGradientTable table;
+	table.bake(gradient);
+	REQUIRE(table.is_valid());
+	CHECK_FALSE(table.is_direct());
+
+	float max_error = 0.0;
+	for (int i = 0; i <= 1000; i++) {
+		const float offset = i / 1000.0;
+		const Color difference = table.sample(offset) - gradient->get_color_at_offset(offset);
+		max_error = MAX(max_error, MAX(MAX(Math::abs(difference.r), Math::abs(difference.g)), MAX(Math::abs(difference.b), Math::abs(difference.a))));
+	}
+	CHECK_MESSAGE(max_error <= 0.5 / 255.0, "Baked colors should be within half an 8-bit step.");
+}
+
+TEST_CASE("[BakedGradientTable] Constant and hard-edged gradients are sampled directly") {
+	Ref<Gradient> gradient = memnew(Gradient);
+	gradient->add_point(0.3, Color(1, 0, 0, 1));
+
+	SUBCASE("Constant interpolation") {
+		gradient->set_interpolation_mode(Gradient::GRADIENT_INTERPOLATE_CONSTANT);
+	}
+	SUBCASE("Points closer than the table spacing") {
+		gradient->add_point(0.3001, Color(0, 1, 0, 1));
+	}
+
+	BakedGradientTable table;
+	table.bake(gradient);
+	REQUIRE(table.is_valid());
+	CHECK(table.is_direct());
+	for (int i = 0; i <= 1000; i++) {
+		const float offset = i / 1000.0;
+		CHECK(table.sample(offset) == gradient->get_color_at_offset(offset));
+	}
+}
+
+} // namespace TestBakedCurveTable
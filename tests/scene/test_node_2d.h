@@ -37,6 +37,22 @@
 
 namespace TestNode2D {
 
+class TransformRecorder2D : public Node2D {
+	GDCLASS(TransformRecorder2D, Node2D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			notified_transform = get_global_transform();
+			notification_count++;
+		}
+	}
+
+public:
+	Transform2D notified_transform;
+	int notification_count = 0;
+};
+
 TEST_CASE("[SceneTree][Node2D]") {
 	SUBCASE("[Node2D][Global Transform] Global Transform should be accessible while not in SceneTree.") { // GH-79453
 		Node2D *test_node = memnew(Node2D);
@@ -85,6 +101,72 @@ TEST_CASE("[SceneTree][Node2D]") {
 	}
 }
 
+TEST_CASE("[SceneTree][Node2D] Batched global transform update") {
+	Node2D *root = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	root->set_position(Point2(100, 0));
+
+	// Wide enough for the children to be resolved in parallel.
+	LocalVector<Node2D *> leaves;
+	LocalVector<CanvasItem *> items;
+	for (int i = 0; i < 600; i++) {
+		Node2D *child = memnew(Node2D);
+		child->set_position(Point2(i, 0));
+		root->add_child(child);
+		Node2D *leaf = memnew(Node2D);
+		leaf->set_position(Point2(0, i));
+		child->add_child(leaf);
+		leaves.push_back(leaf);
+		items.push_back(leaf);
+	}
+	Node2D *top_level = memnew(Node2D);
+	top_level->set_as_top_level(true);
+	top_level->set_position(Point2(5, 5));
+	leaves[0]->add_child(top_level);
+	items.push_back(top_level);
+
+	root->set_position(Point2(200, 0));
+	CanvasItem::update_global_transforms(items);
+	for (uint32_t i = 0; i < leaves.size(); i++) {
+		CHECK_EQ(leaves[i]->get_global_position(), Point2(200 + i, i));
+	}
+	CHECK_EQ(top_level->get_global_position(), Point2(5, 5));
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node2D] Transform notifications see resolved global transforms") {
+	Node2D *root = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	// Enough pending notifications for SceneTree to resolve them in a batch first.
+	LocalVector<TransformRecorder2D *> recorders;
+	for (int i = 0; i < 600; i++) {
+		Node2D *child = memnew(Node2D);
+		child->set_position(Point2(i, 0));
+		root->add_child(child);
+		TransformRecorder2D *recorder = memnew(TransformRecorder2D);
+		recorder->set_position(Point2(0, i));
+		recorder->set_notify_transform(true);
+		child->add_child(recorder);
+		recorders.push_back(recorder);
+	}
+	SceneTree::get_singleton()->flush_transform_notifications();
+	for (TransformRecorder2D *recorder : recorders) {
+		recorder->notification_count = 0;
+	}
+
+	root->set_position(Point2(10, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	for (uint32_t i = 0; i < recorders.size(); i++) {
+		CHECK_EQ(recorders[i]->notification_count, 1);
+		CHECK_EQ(recorders[i]->notified_transform.get_origin(), Point2(10 + i, i));
+		CHECK_EQ(recorders[i]->notified_transform, recorders[i]->get_global_transform());
+	}
+
+	memdelete(root);
+}
+
 TEST_CASE("[SceneTree][Node2D] Utility methods") {
 	Node2D *test_node1 = memnew(Node2D);
 	Node2D *test_node2 = memnew(Node2D);
@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformRecorder3D : public Node3D {
+	GDCLASS(TransformRecorder3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			notified_transform = get_global_transform();
+			notification_count++;
+		}
+	}
+
+public:
+	Transform3D notified_transform;
+	int notification_count = 0;
+};
+
+TEST_CASE("[SceneTree][Node3D] Batched global transform update") {
+	Node3D *root = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	root->set_position(Vector3(100, 0, 0));
+
+	// Wide enough for the children to be resolved in parallel.
+	LocalVector<Node3D *> leaves;
+	LocalVector<Node3D *> nodes;
+	for (int i = 0; i < 600; i++) {
+		Node3D *child = memnew(Node3D);
+		child->set_position(Vector3(i, 0, 0));
+		root->add_child(child);
+		Node3D *leaf = memnew(Node3D);
+		leaf->set_position(Vector3(0, i, 0));
+		child->add_child(leaf);
+		leaves.push_back(leaf);
+		nodes.push_back(leaf);
+	}
+	Node3D *top_level = memnew(Node3D);
+	top_level->set_as_top_level(true);
+	top_level->set_position(Vector3(5, 5, 5));
+	leaves[0]->add_child(top_level);
+	nodes.push_back(top_level);
+
+	root->set_position(Vector3(200, 0, 0));
+	root->rotate_z(Math_PI / 2.0);
+	Node3D::update_global_transforms(nodes);
+	for (uint32_t i = 0; i < leaves.size(); i++) {
+		CHECK(leaves[i]->get_global_position().is_equal_approx(Vector3(200 - real_t(i), real_t(i), 0)));
+	}
+	CHECK_EQ(top_level->get_global_position(), Vector3(5, 5, 5));
+
+	// Nodes outside the tree, or with nothing to resolve, are skipped.
+	Node3D *detached = memnew(Node3D);
+	LocalVector<Node3D *> clean_nodes = { leaves[1], detached };
+	Node3D::update_global_transforms(clean_nodes);
+	CHECK(leaves[1]->get_global_position().is_equal_approx(Vector3(199, 1, 0)));
+
+	memdelete(detached);
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node3D] Transform notifications see resolved global transforms") {
+	Node3D *root = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	// Enough pending notifications for SceneTree to resolve them in a batch first.
+	LocalVector<TransformRecorder3D *> recorders;
+	for (int i = 0; i < 600; i++) {
+		Node3D *child = memnew(Node3D);
+		child->set_position(Vector3(0, 0, i));
+		root->add_child(child);
+		TransformRecorder3D *recorder = memnew(TransformRecorder3D);
+		recorder->set_position(Vector3(0, i, 0));
+		recorder->set_notify_transform(true);
+		child->add_child(recorder);
+		recorders.push_back(recorder);
+	}
+	SceneTree::get_singleton()->flush_transform_notifications();
+	for (TransformRecorder3D *recorder : recorders) {
+		recorder->notification_count = 0;
+	}
+
+	root->set_position(Vector3(10, 0, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	for (uint32_t i = 0; i < recorders.size(); i++) {
+		CHECK_EQ(recorders[i]->notification_count, 1);
+		CHECK_EQ(recorders[i]->notified_transform.origin, Vector3(10, i, i));
+		CHECK_EQ(recorders[i]->notified_transform, recorders[i]->get_global_transform());
+	}
+
+	memdelete(root);
+}
+
+} // namespace TestNode3D
@@ -0,0 +1,173 @@
+/**************************************************************************/
+/*  test_renderer_scene_cull.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "servers/rendering/renderer_scene_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRendererSceneCull {
+
+typedef RendererSceneCull::InstanceBounds InstanceBounds;
+typedef RendererSceneCull::InstanceBoundsCluster InstanceBoundsCluster;
+
+static RendererSceneCull::Frustum make_camera_frustum() {
+	Transform3D camera_transform;
+	camera_transform.origin = Vector3(0, 10, 0);
+	camera_transform = camera_transform.looking_at(Vector3(300, 0, 200));
+	const Projection projection = Projection::create_perspective(70, 16.0 / 9.0, 0.05, 1000);
+	return RendererSceneCull::Frustum(projection.get_projection_planes(camera_transform));
+}
+
+// Instances are placed in groups around a common center, like the instances of a level chunk
+// that are added together. p_spread controls how far apart instances of the same group are.
+static void make_instance_bounds(uint32_t p_count, real_t p_spread, LocalVector<InstanceBounds> &r_bounds, LocalVector<InstanceBoundsCluster> &r_clusters) {
+	RandomPCG rng(12345);
+	r_bounds.resize(p_count);
+	r_clusters.resize((p_count + InstanceBoundsCluster::MASK) >> InstanceBoundsCluster::SHIFT);
+
+	Vector3 center;
+	for (uint32_t i = 0; i < p_count; i++) {
+		if ((i & InstanceBoundsCluster::MASK) == 0) {
+			center = Vector3(rng.random(-2000.0, 2000.0), rng.random(-20.0, 20.0), rng.random(-2000.0, 2000.0));
+		}
+		const Vector3 position = center + Vector3(rng.random(-p_spread, p_spread), rng.random(-p_spread, p_spread) * 0.1, rng.random(-p_spread, p_spread));
+		const Vector3 size(rng.random(0.5, 8.0), rng.random(0.5, 8.0), rng.random(0.5, 8.0));
+		r_bounds[i] = InstanceBounds(AABB(position, size));
+		r_clusters[i >> InstanceBoundsCluster::SHIFT].set_instance_bounds(i & InstanceBoundsCluster::MASK, r_bounds[i]);
+	}
+}
+
+static uint32_t get_cluster_count(uint32_t p_total, uint32_t p_cluster) {
+	return MIN(p_total - (p_cluster << InstanceBoundsCluster::SHIFT), InstanceBoundsCluster::SIZE);
+}
+
+TEST_CASE("[RendererSceneCull] Clustered frustum culling matches per-instance culling") {
+	const RendererSceneCull::Frustum frustum = make_camera_frustum();
+	const real_t spreads[] = { 4.0, 50.0, 4000.0 };
+
+	for (real_t spread : spreads) {
+		LocalVector<InstanceBounds> bounds;
+		LocalVector<InstanceBoundsCluster> clusters;
+		// Not a multiple of the cluster size, so the last cluster is partially filled.
+		const uint32_t instance_count = 20000 + 7;
+		make_instance_bounds(instance_count, spread, bounds, clusters);
+
+		uint32_t mismatches = 0;
+		uint32_t visible = 0;
+		for (uint32_t c = 0; c < clusters.size(); c++) {
+			const uint32_t count = get_cluster_count(instance_count, c);
+			clusters[c].update_cluster_bounds(count);
+			const uint32_t mask = clusters[c].cull(frustum, count);
+			CHECK((mask >> (count - 1)) <= 1);
+
+			for (uint32_t j = 0; j < count; j++) {
+				const bool expected = bounds[(c << InstanceBoundsCluster::SHIFT) + j].in_frustum(frustum);
+				if (expected != bool(mask & (1u << j))) {
+					mismatches++;
+				}
+				visible += expected;
+			}
+		}
+
+		CHECK_MESSAGE(mismatches == 0, vformat("Cluster culling should match per-instance culling with a spread of %.1f.", spread));
+		CHECK_MESSAGE(visible > 0, "Some instances should be in the frustum.");
+		CHECK_MESSAGE(visible < instance_count, "Some instances should be outside the frustum.");
+	}
+}
+
+TEST_CASE("[RendererSceneCull] Clustered frustum culling updates changed bounds") {
+	const RendererSceneCull::Frustum frustum = make_camera_frustum();
+
+	InstanceBoundsCluster cluster;
+	const InstanceBounds behind(AABB(Vector3(-100, 0, -100), Vector3(1, 1, 1)));
+	const InstanceBounds ahead(AABB(Vector3(60, 0, 40), Vector3(1, 1, 1)));
+	REQUIRE_FALSE(behind.in_frustum(frustum));
+	REQUIRE(ahead.in_frustum(frustum));
+
+	for (uint32_t i = 0; i < 3; i++) {
+		cluster.set_instance_bounds(i, behind);
+	}
+	cluster.update_cluster_bounds(3);
+	CHECK(cluster.cull(frustum, 3) == 0);
+
+	cluster.set_instance_bounds(1, ahead);
+	CHECK(cluster.dirty);
+	cluster.update_cluster_bounds(3);
+	CHECK(cluster.cull(frustum, 3) == 0b010);
+	CHECK(cluster.cull(frustum, 1) == 0);
+}
+
+TEST_CASE("[Benchmark][RendererSceneCull] Per-instance against clustered frustum culling" * doctest::skip()) {
+	const RendererSceneCull::Frustum frustum = make_camera_frustum();
+	const uint32_t instance_count = 300000;
+	const int rounds = 20;
+	// Mostly visible, then mostly culled.
+	const real_t spreads[] = { 50.0, 4000.0 };
+
+	for (real_t spread : spreads) {
+		LocalVector<InstanceBounds> bounds;
+		LocalVector<InstanceBoundsCluster> clusters;
+		make_instance_bounds(instance_count, spread, bounds, clusters);
+		for (uint32_t c = 0; c < clusters.size(); c++) {
+			clusters[c].update_cluster_bounds(get_cluster_count(instance_count, c));
+		}
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		uint32_t instance_visible = 0;
+		for (int round = 0; round < rounds; round++) {
+			for (uint32_t i = 0; i < instance_count; i++) {
+				instance_visible += bounds[i].in_frustum(frustum);
+			}
+		}
+		const uint64_t instance_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		uint32_t cluster_visible = 0;
+		for (int round = 0; round < rounds; round++) {
+			for (uint32_t c = 0; c < clusters.size(); c++) {
+				for (uint32_t mask = clusters[c].cull(frustum, get_cluster_count(instance_count, c)); mask; mask &= mask - 1) {
+					cluster_visible++;
+				}
+			}
+		}
+		const uint64_t cluster_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		CHECK(instance_visible == cluster_visible);
+		const String report = vformat("%d instances with a spread of %.1f, %d visible, %d rounds: per-instance culling %d usec, clustered culling %d usec.",
+				instance_count, spread, instance_visible / rounds, rounds, (int64_t)instance_usec, (int64_t)cluster_usec);
+		MESSAGE(report.utf8().get_data());
+	}
+}
+
+} // namespace TestRendererSceneCull
@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*  test_renderer_scene_occlusion_cull_software.h                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/rendering/renderer_scene_occlusion_cull_software.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRendererSceneOcclusionCullSoftware {
+
+class OcclusionCullTest {
+	const RID scenario = RID::from_uint64(1);
+	const RID instance = RID::from_uint64(2);
+	const RID buffer = RID::from_uint64(3);
+
+	RendererSceneOcclusionCullSoftware culler;
+	RID occluder;
+
+	Transform3D cam_transform;
+	Projection cam_projection;
+	bool cam_orthogonal = false;
+
+public:
+	OcclusionCullTest(const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices, bool p_orthogonal = false) {
+		occluder = culler.occluder_allocate();
+		culler.occluder_initialize(occluder);
+		culler.occluder_set_mesh(occluder, p_vertices, p_indices);
+
+		culler.add_scenario(scenario);
+		culler.scenario_set_instance(scenario, instance, occluder, Transform3D(), true);
+
+		culler.add_buffer(buffer);
+		culler.buffer_set_scenario(buffer, scenario);
+		culler.buffer_set_size(buffer, Size2i(96, 64));
+
+		cam_orthogonal = p_orthogonal;
+		if (cam_orthogonal) {
+			cam_projection.set_orthogonal(40, 1.5, 0.1, 100);
+		} else {
+			cam_projection.set_perspective(70, 1.5, 0.1, 100);
+		}
+		culler.buffer_update(buffer, cam_transform, cam_projection, cam_orthogonal);
+	}
+
+	void set_instance(const Transform3D &p_xform, bool p_enabled) {
+		culler.scenario_set_instance(scenario, instance, occluder, p_xform, p_enabled);
+		culler.buffer_update(buffer, cam_transform, cam_projection, cam_orthogonal);
+	}
+
+	bool is_occluded(const AABB &p_aabb) {
+		const real_t bounds[6] = { p_aabb.position.x, p_aabb.position.y, p_aabb.position.z, p_aabb.get_end().x, p_aabb.get_end().y, p_aabb.get_end().z };
+		uint64_t timeout = 0;
+		return culler.buffer_get_ptr(buffer)->is_occluded(bounds, cam_transform.origin, cam_transform.affine_inverse(), cam_projection, cam_projection.get_z_near(), timeout);
+	}
+
+	~OcclusionCullTest() {
+		culler.remove_buffer(buffer);
+		culler.remove_scenario(scenario);
+		culler.free_occluder(occluder);
+	}
+};
+
+static const PackedInt32Array quad_indices = { 0, 1, 2, 0, 2, 3 };
+
+TEST_CASE("[RendererSceneOcclusionCullSoftware] Occluder quad in front of the camera") {
+	// The camera looks down -Z, the quad covers the center of the view.
+	const PackedVector3Array quad = { Vector3(-5, -5, -10), Vector3(5, -5, -10), Vector3(5, 5, -10), Vector3(-5, 5, -10) };
+
+	SUBCASE("Perspective camera") {
+		OcclusionCullTest test(quad, quad_indices);
+
+		CHECK_MESSAGE(test.is_occluded(AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2))), "A box behind the quad should be occluded.");
+		CHECK_MESSAGE(!test.is_occluded(AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2))), "A box in front of the quad should be visible.");
+		CHECK_MESSAGE(!test.is_occluded(AABB(Vector3(-1, -1, -11), Vector3(2, 2, 2))), "A box crossing the quad should be visible.");
+		CHECK_MESSAGE(!test.is_occluded(AABB(Vector3(20, -1, -41), Vector3(2, 2, 2))), "A box behind the quad, but beside it on screen, should be visible.");
+
+		test.set_instance(Transform3D(Basis(), Vector3(0, 0, -40)), true);
+		CHECK_MESSAGE(!test.is_occluded(AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2))), "Moving the occluder should update the buffer.");
+
+		test.set_instance(Transform3D(), false);
+		CHECK_MESSAGE(!test.is_occluded(AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2))), "Disabled occluders should not occlude anything.");
+	}
+
+	SUBCASE("Orthogonal camera") {
+		OcclusionCullTest test(quad, quad_indices, true);
+
+		CHECK_MESSAGE(test.is_occluded(AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2))), "A box behind the quad should be occluded.");
+		CHECK_MESSAGE(!test.is_occluded(AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2))), "A box in front of the quad should be visible.");
+		CHECK_MESSAGE(!test.is_occluded(AABB(Vector3(8, -1, -21), Vector3(2, 2, 2))), "A box beside the quad should be visible.");
+	}
+}
+
+TEST_CASE("[RendererSceneOcclusionCullSoftware] Occluder crossing the near plane") {
+	// A tilted wall that passes behind the camera at the top, so it must be clipped against the near plane.
+	const PackedVector3Array wall = { Vector3(-50, -50, -35), Vector3(50, -50, -35), Vector3(50, 50, 15), Vector3(-50, 50, 15) };
+	OcclusionCullTest test(wall, quad_indices);
+
+	CHECK_MESSAGE(test.is_occluded(AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2))), "A box behind the wall should be occluded.");
+	CHECK_MESSAGE(!test.is_occluded(AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2))), "A box in front of the wall should be visible.");
+}
+
+TEST_CASE("[RendererSceneOcclusionCullSoftware] Occluder projecting far outside the view") {
+	// Its screen-space bounds are far larger than an int can hold.
+	const PackedVector3Array huge_quad = { Vector3(-1e12, -1e12, -10), Vector3(1e12, -1e12, -10), Vector3(1e12, 1e12, -10), Vector3(-1e12, 1e12, -10) };
+	OcclusionCullTest test(huge_quad, quad_indices);
+
+	CHECK_MESSAGE(test.is_occluded(AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2))), "A box behind the quad should be occluded.");
+	CHECK_MESSAGE(test.is_occluded(AABB(Vector3(20, -1, -41), Vector3(2, 2, 2))), "The whole view should be covered.");
+	CHECK_MESSAGE(!test.is_occluded(AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2))), "A box in front of the quad should be visible.");
+}
+
+} // namespace TestRendererSceneOcclusionCullSoftware
@@ -0,0 +1,285 @@
+/**************************************************************************/
+/*  test_shader_compilation_scheduler_rd.h                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/rendering/renderer_rd/pipeline_hash_map_rd.h"
+#include "servers/rendering/renderer_rd/shader_compilation_scheduler_rd.h"
+#include "servers/rendering/renderer_rd/shader_rd.h"
+
+#include "tests/test_macros.h"
+
+class TestShaderRDInternalsAccessor {
+public:
+	static void compile_version_start(ShaderRD &p_shader, RID p_version) {
+		ShaderRD::Version *version = p_shader.version_owner.get_or_null(p_version);
+		p_shader._initialize_version(version);
+		p_shader._compile_version_start(version, 0);
+	}
+
+	static void compile_cancel(ShaderRD &p_shader, RID p_version) {
+		p_shader._compile_cancel(p_shader.version_owner.get_or_null(p_version));
+	}
+
+	static const SafeFlag *get_compilation_cancelled(ShaderRD &p_shader, RID p_version) {
+		return &p_shader.version_owner.get_or_null(p_version)->compilation_cancelled;
+	}
+
+	static bool has_variants(ShaderRD &p_shader, RID p_version) {
+		return !p_shader.version_owner.get_or_null(p_version)->variants.is_empty();
+	}
+};
+
+class TestPipelineHashMapRDInternalsAccessor {
+public:
+	template <typename T>
+	static bool is_compilation_cancelled(T &p_map) {
+		MutexLock local_lock(p_map.local_mutex);
+		return p_map.compilation_cancelled;
+	}
+};
+
+namespace TestShaderCompilationSchedulerRD {
+
+struct CompilationCounter {
+	SafeNumeric<uint32_t> compiled;
+
+	void compile(uint32_t p_index, uint64_t p_queued_usec) {
+		ShaderCompilationSchedulerRD::task_started(p_queued_usec);
+		compiled.increment();
+	}
+};
+
+TEST_CASE("[ShaderCompilationSchedulerRD] Queue depth and latency") {
+	ShaderCompilationSchedulerRD::initialize(2, 0.5);
+
+	const uint32_t task_count = 16;
+	uint64_t queued_usec = ShaderCompilationSchedulerRD::tasks_queued(task_count);
+	CHECK(ShaderCompilationSchedulerRD::get_queue_depth() == task_count);
+
+	// Hold the tasks back so they can't start sooner than this.
+	OS::get_singleton()->delay_usec(2000);
+
+	CompilationCounter counter;
+	WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+	CHECK(pool != WorkerThreadPool::get_singleton());
+	WorkerThreadPool::GroupID group_id = pool->add_template_group_task(&counter, &CompilationCounter::compile, queued_usec, task_count, -1, false, "Test");
+	pool->wait_for_group_task_completion(group_id);
+
+	CHECK(counter.compiled.get() == task_count);
+	CHECK_MESSAGE(ShaderCompilationSchedulerRD::get_queue_depth() == 0, "Every started task should leave the queue.");
+	CHECK(ShaderCompilationSchedulerRD::get_average_latency_usec() >= 2000);
+
+	ShaderCompilationSchedulerRD::finalize();
+	CHECK(ShaderCompilationSchedulerRD::get_queue_depth() == 0);
+	CHECK(ShaderCompilationSchedulerRD::get_average_latency_usec() == 0);
+}
+
+// The tests below use a single thread, which these keep busy so the tasks queued after them can't start.
+struct FlagBlocker {
+	const SafeFlag *release = nullptr;
+
+	void block(int p_unused) {
+		while (!release->is_set()) {
+			OS::get_singleton()->delay_usec(100);
+		}
+	}
+};
+
+struct SemaphoreBlocker {
+	Semaphore release;
+
+	void block(int p_unused) {
+		release.wait();
+	}
+
+	void fence(int p_unused) {}
+};
+
+class TestShaderRD : public ShaderRD {};
+
+TEST_CASE("[ShaderCompilationSchedulerRD] Cancelling a shader version skips its queued variants") {
+	ShaderCompilationSchedulerRD::initialize(1, 0.5);
+
+	{
+		TestShaderRD shader;
+		shader.initialize({ "\n#define VARIANT_A\n", "\n#define VARIANT_B\n", "\n#define VARIANT_C\n" }, "");
+		RID version = shader.version_create();
+
+		// Variants can only start once the version is cancelled. Compiling them would need a rendering device.
+		FlagBlocker blocker;
+		blocker.release = TestShaderRDInternalsAccessor::get_compilation_cancelled(shader, version);
+		WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+		WorkerThreadPool::TaskID blocker_task = pool->add_template_task(&blocker, &FlagBlocker::block, 0, true, "Test");
+
+		TestShaderRDInternalsAccessor::compile_version_start(shader, version);
+		CHECK(ShaderCompilationSchedulerRD::get_queue_depth() == 3);
+
+		TestShaderRDInternalsAccessor::compile_cancel(shader, version);
+		pool->wait_for_task_completion(blocker_task);
+		CHECK_MESSAGE(ShaderCompilationSchedulerRD::get_queue_depth() == 0, "Skipped variants should leave the queue.");
+		CHECK_FALSE_MESSAGE(TestShaderRDInternalsAccessor::has_variants(shader, version), "A cancelled version should have no variants.");
+
+		shader.version_free(version);
+	}
+
+	ShaderCompilationSchedulerRD::finalize();
+}
+
+struct TestPipelineKey {
+	uint32_t value = 0;
+
+	uint32_t hash() const {
+		return hash_murmur3_one_32(value);
+	}
+};
+
+struct TestPipelineCreator {
+	SafeNumeric<uint32_t> created;
+	SafeNumeric<uint64_t> last_thread;
+
+	void create(TestPipelineKey p_key) {
+		created.increment();
+		last_thread.set(Thread::get_caller_id());
+	}
+};
+
+typedef PipelineHashMapRD<TestPipelineKey, TestPipelineCreator, void (TestPipelineCreator::*)(TestPipelineKey)> TestPipelineHashMap;
+
+TEST_CASE("[ShaderCompilationSchedulerRD] Waiting on a queued pipeline creates it on the waiting thread") {
+	ShaderCompilationSchedulerRD::initialize(1, 0.5);
+
+	{
+		TestPipelineCreator creator;
+		TestPipelineHashMap map;
+		map.set_creation_object_and_function(&creator, &TestPipelineCreator::create);
+
+		SemaphoreBlocker blocker;
+		WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+		WorkerThreadPool::TaskID blocker_task = pool->add_template_task(&blocker, &SemaphoreBlocker::block, 0, true, "Test");
+
+		const TestPipelineKey key = { 7 };
+		map.compile_pipeline(key, key.hash(), RS::PIPELINE_SOURCE_MESH, true);
+		map.wait_for_pipeline(key.hash());
+		CHECK_MESSAGE(creator.created.get() == 1, "The pipeline should be created without waiting for the queued task.");
+		CHECK(creator.last_thread.get() == Thread::get_caller_id());
+
+		// Tasks run in order on the only thread, so the superseded task is done once the fence is.
+		blocker.release.post();
+		WorkerThreadPool::TaskID fence_task = pool->add_template_task(&blocker, &SemaphoreBlocker::fence, 0, true, "Test");
+		pool->wait_for_task_completion(blocker_task);
+		pool->wait_for_task_completion(fence_task);
+		CHECK_MESSAGE(creator.created.get() == 1, "The superseded task should not create the pipeline again.");
+		CHECK(ShaderCompilationSchedulerRD::get_queue_depth() == 0);
+	}
+
+	ShaderCompilationSchedulerRD::finalize();
+}
+
+struct PipelineCancelBlocker {
+	TestPipelineHashMap *map = nullptr;
+
+	void block(int p_unused) {
+		while (!TestPipelineHashMapRDInternalsAccessor::is_compilation_cancelled(*map)) {
+			OS::get_singleton()->delay_usec(100);
+		}
+	}
+};
+
+TEST_CASE("[ShaderCompilationSchedulerRD] Clearing pipelines cancels queued compilations") {
+	ShaderCompilationSchedulerRD::initialize(1, 0.5);
+
+	{
+		TestPipelineCreator creator;
+		TestPipelineHashMap map;
+		map.set_creation_object_and_function(&creator, &TestPipelineCreator::create);
+
+		PipelineCancelBlocker blocker;
+		blocker.map = &map;
+		WorkerThreadPool *pool = ShaderCompilationSchedulerRD::get_pool();
+		WorkerThreadPool::TaskID blocker_task = pool->add_template_task(&blocker, &PipelineCancelBlocker::block, 0, true, "Test");
+
+		for (uint32_t i = 0; i < 4; i++) {
+			const TestPipelineKey key = { i };
+			map.compile_pipeline(key, key.hash(), RS::PIPELINE_SOURCE_MESH, i % 2 == 0);
+		}
+		CHECK(ShaderCompilationSchedulerRD::get_queue_depth() == 4);
+
+		map.clear_pipelines();
+		pool->wait_for_task_completion(blocker_task);
+		CHECK_MESSAGE(creator.created.get() == 0, "Queued compilations should be skipped.");
+		CHECK(ShaderCompilationSchedulerRD::get_queue_depth() == 0);
+
+		// The same pipelines can be compiled again afterwards.
+		const TestPipelineKey key = { 0 };
+		map.compile_pipeline(key, key.hash(), RS::PIPELINE_SOURCE_MESH, true);
+		map.wait_for_pipeline(key.hash());
+		CHECK(creator.created.get() == 1);
+	}
+
+	ShaderCompilationSchedulerRD::finalize();
+}
+
+TEST_CASE("[ShaderCompilationSchedulerRD] The pool is not created again after finalizing") {
+	ShaderCompilationSchedulerRD::initialize(1, 0.5);
+
+	{
+		TestPipelineCreator creator;
+		TestPipelineHashMap map;
+		map.set_creation_object_and_function(&creator, &TestPipelineCreator::create);
+
+		const TestPipelineKey key = { 3 };
+		map.compile_pipeline(key, key.hash(), RS::PIPELINE_SOURCE_MESH, true);
+		map.wait_for_pipeline(key.hash());
+		CHECK(creator.created.get() == 1);
+
+		ShaderCompilationSchedulerRD::finalize();
+		CHECK(ShaderCompilationSchedulerRD::get_pool() == nullptr);
+
+		// Clearing and destroying the map afterwards must not need the pool.
+		map.clear_pipelines();
+		CHECK(ShaderCompilationSchedulerRD::get_pool() == nullptr);
+
+		ERR_PRINT_OFF;
+		const TestPipelineKey late_key = { 4 };
+		map.compile_pipeline(late_key, late_key.hash(), RS::PIPELINE_SOURCE_MESH, true);
+		ERR_PRINT_ON;
+		map.wait_for_pipeline(late_key.hash());
+		CHECK_MESSAGE(creator.created.get() == 1, "Nothing can be compiled once the scheduler is finalized.");
+	}
+	CHECK(ShaderCompilationSchedulerRD::get_pool() == nullptr);
+
+	// Initializing again brings the pool back.
+	ShaderCompilationSchedulerRD::initialize(1, 0.5);
+	CHECK(ShaderCompilationSchedulerRD::get_pool() != nullptr);
+	ShaderCompilationSchedulerRD::finalize();
+}
+
+} // namespace TestShaderCompilationSchedulerRD
@@ -0,0 +1,284 @@
+/**************************************************************************/
+/*  test_shader_compiler_cache.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/dir_access.h"
+#include "core/os/os.h"
+#include "servers/rendering/rendering_server_globals.h"
+#include "servers/rendering/shader_compiler.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestShaderCompilerCache {
+
+static const char *spatial_code = R"(
+shader_type spatial;
+render_mode unshaded, cull_disabled;
+
+uniform vec4 albedo : source_color = vec4(1.0, 0.5, 0.25, 1.0);
+uniform bool toggle = true;
+uniform sampler2D albedo_texture : source_color, hint_default_white, filter_nearest;
+instance uniform float instance_value = 2.0;
+
+void vertex() {
+	VERTEX += NORMAL * 0.1;
+}
+
+void fragment() {
+	ALBEDO = albedo.rgb * texture(albedo_texture, UV).rgb;
+	ALPHA = toggle ? 0.5 : 1.0;
+}
+)";
+
+struct CompileResult {
+	Error error = FAILED;
+	bool unshaded = false;
+	int cull_mode = RS::CULL_MODE_BACK;
+	bool uses_alpha = false;
+	bool uses_time = false;
+	bool writes_vertex = false;
+	HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+	ShaderCompiler::GeneratedCode gen_code;
+};
+
+// Uses a new compiler every time so nothing but the disk cache is shared between compilations.
+static CompileResult compile_spatial(const String &p_code) {
+	CompileResult result;
+	ShaderCompiler compiler;
+	compiler.initialize(ShaderCompiler::DefaultIdentifierActions());
+
+	ShaderCompiler::IdentifierActions actions;
+	actions.entry_point_stages["vertex"] = ShaderCompiler::STAGE_VERTEX;
+	actions.entry_point_stages["fragment"] = ShaderCompiler::STAGE_FRAGMENT;
+	actions.render_mode_flags["unshaded"] = &result.unshaded;
+	actions.render_mode_values["cull_disabled"] = Pair<int *, int>(&result.cull_mode, RS::CULL_MODE_DISABLED);
+	actions.usage_flag_pointers["ALPHA"] = &result.uses_alpha;
+	actions.usage_flag_pointers["TIME"] = &result.uses_time;
+	actions.write_flag_pointers["VERTEX"] = &result.writes_vertex;
+	actions.uniforms = &result.uniforms;
+
+	result.error = compiler.compile(RS::SHADER_SPATIAL, p_code, &actions, "", result.gen_code);
+	return result;
+}
+
+static String setup_cache_dir() {
+	const String cache_dir = TestUtils::get_temp_path("shader_compiler_cache");
+	Ref<DirAccess> da = DirAccess::open(cache_dir);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+	}
+	ShaderCompiler::set_cache_dir(cache_dir);
+	return cache_dir;
+}
+
+static void check_same_result(const CompileResult &p_a, const CompileResult &p_b) {
+	CHECK(p_a.unshaded == p_b.unshaded);
+	CHECK(p_a.cull_mode == p_b.cull_mode);
+	CHECK(p_a.uses_alpha == p_b.uses_alpha);
+	CHECK(p_a.uses_time == p_b.uses_time);
+	CHECK(p_a.writes_vertex == p_b.writes_vertex);
+
+	const ShaderCompiler::GeneratedCode &a = p_a.gen_code;
+	const ShaderCompiler::GeneratedCode &b = p_b.gen_code;
+	CHECK(a.defines == b.defines);
+	CHECK(a.uniforms == b.uniforms);
+	CHECK(a.uniform_offsets == b.uniform_offsets);
+	CHECK(a.uniform_total_size == b.uniform_total_size);
+	for (int i = 0; i < ShaderCompiler::STAGE_MAX; i++) {
+		CHECK(a.stage_globals[i] == b.stage_globals[i]);
+	}
+	REQUIRE(a.code.size() == b.code.size());
+	for (const KeyValue<String, String> &E : a.code) {
+		REQUIRE(b.code.has(E.key));
+		CHECK(b.code[E.key] == E.value);
+	}
+	REQUIRE(a.texture_uniforms.size() == b.texture_uniforms.size());
+	for (int i = 0; i < a.texture_uniforms.size(); i++) {
+		CHECK(a.texture_uniforms[i].name == b.texture_uniforms[i].name);
+		CHECK(a.texture_uniforms[i].hint == b.texture_uniforms[i].hint);
+		CHECK(a.texture_uniforms[i].use_color == b.texture_uniforms[i].use_color);
+		CHECK(a.texture_uniforms[i].filter == b.texture_uniforms[i].filter);
+	}
+	CHECK(a.uses_vertex_time == b.uses_vertex_time);
+	CHECK(a.uses_fragment_time == b.uses_fragment_time);
+	CHECK(a.uses_screen_texture == b.uses_screen_texture);
+
+	REQUIRE(p_a.uniforms.size() == p_b.uniforms.size());
+	for (const KeyValue<StringName, ShaderLanguage::ShaderNode::Uniform> &E : p_a.uniforms) {
+		REQUIRE(p_b.uniforms.has(E.key));
+		const ShaderLanguage::ShaderNode::Uniform &u = p_b.uniforms[E.key];
+		CHECK(u.order == E.value.order);
+		CHECK(u.prop_order == E.value.prop_order);
+		CHECK(u.texture_order == E.value.texture_order);
+		CHECK(u.type == E.value.type);
+		CHECK(u.scope == E.value.scope);
+		CHECK(u.hint == E.value.hint);
+		CHECK(u.instance_index == E.value.instance_index);
+		CHECK(u.default_value.size() == E.value.default_value.size());
+	}
+}
+
+TEST_CASE("[SceneTree][ShaderCompiler] Cached compilation replays generated code and actions") {
+	ShaderCompiler::set_cache_dir(String());
+	const CompileResult uncached = compile_spatial(spatial_code);
+	REQUIRE(uncached.error == OK);
+	CHECK(uncached.unshaded);
+	CHECK(uncached.cull_mode == RS::CULL_MODE_DISABLED);
+	CHECK(uncached.uses_alpha);
+	CHECK_FALSE(uncached.uses_time);
+	CHECK(uncached.writes_vertex);
+
+	const String cache_dir = setup_cache_dir();
+	const CompileResult first = compile_spatial(spatial_code);
+	REQUIRE(first.error == OK);
+	CHECK_MESSAGE(DirAccess::get_files_at(cache_dir).size() == 1, "A successful compilation should store one cache entry.");
+
+	const CompileResult cached = compile_spatial(spatial_code);
+	REQUIRE(cached.error == OK);
+	CHECK(DirAccess::get_files_at(cache_dir).size() == 1);
+	check_same_result(uncached, cached);
+
+	const ShaderLanguage::ShaderNode::Uniform &albedo = cached.uniforms["albedo"];
+	REQUIRE(albedo.default_value.size() == 4);
+	CHECK(albedo.default_value[1].real == doctest::Approx(0.5));
+	CHECK(albedo.use_color);
+	const ShaderLanguage::ShaderNode::Uniform &toggle = cached.uniforms["toggle"];
+	REQUIRE(toggle.default_value.size() == 1);
+	CHECK(toggle.default_value[0].boolean);
+	CHECK(cached.uniforms["instance_value"].scope == ShaderLanguage::ShaderNode::Uniform::SCOPE_INSTANCE);
+
+	const CompileResult changed = compile_spatial(String(spatial_code).replace("0.1", "0.2"));
+	REQUIRE(changed.error == OK);
+	CHECK_MESSAGE(DirAccess::get_files_at(cache_dir).size() == 2, "Different code should not reuse an existing entry.");
+
+	ShaderCompiler::set_cache_dir(String());
+	DirAccess::open(cache_dir)->erase_contents_recursive();
+}
+
+TEST_CASE("[SceneTree][ShaderCompiler] Cached entries are invalidated by global uniform changes in the editor") {
+	const String code = "shader_type spatial;\nglobal uniform vec4 tint;\nvoid fragment() {\n\tALBEDO = tint.rgb;\n}\n";
+	const bool editor_hint = Engine::get_singleton()->is_editor_hint();
+	Engine::get_singleton()->set_editor_hint(true);
+
+	const String cache_dir = setup_cache_dir();
+	RSG::material_storage->global_shader_parameter_add("tint", RS::GLOBAL_VAR_TYPE_VEC4, Color());
+	CHECK(compile_spatial(code).error == OK);
+	CHECK(compile_spatial(code).error == OK);
+
+	RSG::material_storage->global_shader_parameter_remove("tint");
+	RSG::material_storage->global_shader_parameter_add("tint", RS::GLOBAL_VAR_TYPE_FLOAT, 0.0);
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(compile_spatial(code).error != OK, "A global uniform that changed type must not be accepted from the cache.");
+	ERR_PRINT_ON;
+
+	RSG::material_storage->global_shader_parameter_remove("tint");
+	Engine::get_singleton()->set_editor_hint(editor_hint);
+	ShaderCompiler::set_cache_dir(String());
+	DirAccess::open(cache_dir)->erase_contents_recursive();
+}
+
+TEST_CASE("[SceneTree][ShaderCompiler] Cached entries with out of range values are recompiled") {
+	ShaderCompiler::set_cache_dir(String());
+	const CompileResult uncached = compile_spatial(spatial_code);
+	REQUIRE(uncached.error == OK);
+
+	const String cache_dir = setup_cache_dir();
+	REQUIRE(compile_spatial(spatial_code).error == OK);
+	const PackedStringArray files = DirAccess::get_files_at(cache_dir);
+	REQUIRE(files.size() == 1);
+
+	// A well formed entry with a single texture of an unknown type, followed by zeros.
+	Ref<FileAccess> f = FileAccess::open(cache_dir.path_join(files[0]), FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_buffer((const uint8_t *)"GDSG", 4);
+	f->store_32(1); // Version.
+	f->store_32(0); // Defines.
+	f->store_32(1); // Textures.
+	f->store_pascal_string("albedo_texture");
+	f->store_32(ShaderLanguage::TYPE_MAX + 100);
+	for (int i = 0; i < 1024; i++) {
+		f->store_32(0);
+	}
+	f.unref();
+
+	const CompileResult recompiled = compile_spatial(spatial_code);
+	REQUIRE(recompiled.error == OK);
+	check_same_result(uncached, recompiled);
+
+	ShaderCompiler::set_cache_dir(String());
+	DirAccess::open(cache_dir)->erase_contents_recursive();
+}
+
+TEST_CASE("[SceneTree][ShaderCompiler] Cache hits mark the entry as recently used") {
+	const String cache_dir = setup_cache_dir();
+	REQUIRE(compile_spatial(spatial_code).error == OK);
+	const PackedStringArray files = DirAccess::get_files_at(cache_dir);
+	REQUIRE(files.size() == 1);
+	const String path = cache_dir.path_join(files[0]);
+	const uint64_t written_time = FileAccess::get_modified_time(path);
+
+	// Modified times may only have a resolution of one second.
+	OS::get_singleton()->delay_usec(1100000);
+	const CompileResult cached = compile_spatial(spatial_code);
+	REQUIRE(cached.error == OK);
+	CHECK_MESSAGE(FileAccess::get_modified_time(path) > written_time, "A hit should update the modified time eviction relies on.");
+
+	// The entry is still valid afterwards.
+	check_same_result(cached, compile_spatial(spatial_code));
+
+	ShaderCompiler::set_cache_dir(String());
+	DirAccess::open(cache_dir)->erase_contents_recursive();
+}
+
+TEST_CASE("[ShaderCompiler] Setting the cache folder evicts entries over the limit") {
+	const String cache_dir = setup_cache_dir();
+	ShaderCompiler::set_cache_dir(String());
+
+	const int entry_count = ShaderCompiler::CACHE_MAX_ENTRIES + 16;
+	for (int i = 0; i < entry_count; i++) {
+		Ref<FileAccess> f = FileAccess::open(cache_dir.path_join(itos(i) + ".cache"), FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+	}
+	Ref<FileAccess> other = FileAccess::open(cache_dir.path_join("other.txt"), FileAccess::WRITE);
+	REQUIRE(other.is_valid());
+	other.unref();
+
+	ShaderCompiler::set_cache_dir(cache_dir);
+	const PackedStringArray files = DirAccess::get_files_at(cache_dir);
+	CHECK(files.size() == ShaderCompiler::CACHE_MAX_ENTRIES + 1);
+	CHECK_MESSAGE(files.has("other.txt"), "Files that aren't cache entries should be left alone.");
+
+	ShaderCompiler::set_cache_dir(String());
+	DirAccess::open(cache_dir)->erase_contents_recursive();
+}
+
+} // namespace TestShaderCompilerCache
@@ -805,11 +805,184 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_EQ(query_result->get_path().size(), 0);
 		}
 
+		SUBCASE("Batched queries should yield the same paths as single queries") {
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			TypedArray<NavigationPathQueryResult3D> async_results;
+			for (int i = 0; i < 64; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters;
+				query_parameters.instantiate();
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(-4.5 + (i % 8) * 1.2, 0, -4.5));
+				query_parameters->set_target_position(Vector3(4.5, 0, -4.5 + (i / 8) * 1.2));
+				batch_parameters.push_back(query_parameters);
+				batch_results.push_back(memnew(NavigationPathQueryResult3D));
+				async_results.push_back(memnew(NavigationPathQueryResult3D));
+			}
+
+			navigation_server->query_path_batch(batch_parameters, batch_results);
+			const int64_t batch_id = navigation_server->query_path_batch_async(batch_parameters, async_results);
+			CHECK_NE(batch_id, -1);
+			while (!navigation_server->query_path_batch_is_finished(batch_id)) {
+				OS::get_singleton()->delay_usec(100);
+			}
+			navigation_server->process(0.0); // Release the finished batch.
+
+			for (int i = 0; i < batch_parameters.size(); i++) {
+				Ref<NavigationPathQueryResult3D> query_result;
+				query_result.instantiate();
+				navigation_server->query_path(batch_parameters[i], query_result);
+				Ref<NavigationPathQueryResult3D> batch_result = batch_results[i];
+				Ref<NavigationPathQueryResult3D> async_result = async_results[i];
+				CHECK_NE(query_result->get_path().size(), 0);
+				CHECK_EQ(batch_result->get_path(), query_result->get_path());
+				CHECK_EQ(async_result->get_path(), query_result->get_path());
+				CHECK_EQ(batch_result->get_path_rids(), query_result->get_path_rids());
+			}
+		}
+
+		SUBCASE("Batched queries sharing a result object should leave the last path in it") {
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			Ref<NavigationPathQueryResult3D> shared_result;
+			shared_result.instantiate();
+			for (int i = 0; i < 64; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters;
+				query_parameters.instantiate();
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(-4.5 + (i % 8) * 1.2, 0, -4.5));
+				query_parameters->set_target_position(Vector3(4.5, 0, -4.5 + (i / 8) * 1.2));
+				batch_parameters.push_back(query_parameters);
+				batch_results.push_back(shared_result);
+			}
+
+			navigation_server->query_path_batch(batch_parameters, batch_results);
+
+			Ref<NavigationPathQueryResult3D> query_result;
+			query_result.instantiate();
+			navigation_server->query_path(batch_parameters[batch_parameters.size() - 1], query_result);
+			CHECK_NE(query_result->get_path().size(), 0);
+			CHECK_EQ(shared_result->get_path(), query_result->get_path());
+		}
+
+		SUBCASE("Async batch callbacks should wait for the process step after their map is freed") {
+			RID other_map = navigation_server->map_create();
+			navigation_server->map_set_active(other_map, true);
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(other_map);
+			batch_parameters.push_back(query_parameters);
+			batch_results.push_back(memnew(NavigationPathQueryResult3D));
+
+			CallableMock callback_mock;
+			const int64_t batch_id = navigation_server->query_path_batch_async(batch_parameters, batch_results, callable_mp(&callback_mock, &CallableMock::function1).bind(Variant()));
+			CHECK_NE(batch_id, -1);
+
+			navigation_server->free(other_map);
+			CHECK_EQ(callback_mock.function1_calls, 0);
+
+			navigation_server->process(0.0); // Frees the map, then emits the callbacks of the batches it finished.
+			CHECK(navigation_server->query_path_batch_is_finished(batch_id));
+			CHECK_EQ(callback_mock.function1_calls, 1);
+		}
+
+		SUBCASE("Batched queries with mismatched array sizes should fail") {
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(map);
+			batch_parameters.push_back(query_parameters);
+			ERR_PRINT_OFF;
+			CHECK_EQ(navigation_server->query_path_batch_async(batch_parameters, batch_results), -1);
+			ERR_PRINT_ON;
+		}
+
 		navigation_server->free(region);
 		navigation_server->free(map);
 		navigation_server->process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should reconnect only changed regions") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->map_set_edge_connection_margin(map, 1.0);
+
+		// Three quads in a row, the first two share an edge and the last one is within the edge connection margin.
+		const real_t region_offsets[3] = { 0.0, 10.0, 20.5 };
+		RID regions[3];
+		for (int i = 0; i < 3; i++) {
+			Ref<NavigationMesh> navigation_mesh;
+			navigation_mesh.instantiate();
+			Vector<Vector3> vertices;
+			vertices.push_back(Vector3(region_offsets[i], 0.0, 0.0));
+			vertices.push_back(Vector3(region_offsets[i] + 10.0, 0.0, 0.0));
+			vertices.push_back(Vector3(region_offsets[i] + 10.0, 0.0, 10.0));
+			vertices.push_back(Vector3(region_offsets[i], 0.0, 10.0));
+			navigation_mesh->set_vertices(vertices);
+			navigation_mesh->add_polygon({ 0, 1, 2, 3 });
+
+			regions[i] = navigation_server->region_create();
+			navigation_server->region_set_map(regions[i], map);
+			navigation_server->region_set_navigation_mesh(regions[i], navigation_mesh);
+		}
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		const auto check_connected = [&]() {
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_POLYGON_COUNT), 3);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_COUNT), 11);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_MERGE_COUNT), 1);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT), 10);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), 2);
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(5, 0, 5), Vector3(25, 0, 5), true);
+			REQUIRE_NE(path.size(), 0);
+			CHECK(path[path.size() - 1].is_equal_approx(Vector3(25, 0, 5)));
+		};
+
+		SUBCASE("Initial build should connect all regions") {
+			check_connected();
+		}
+
+		SUBCASE("Disabling and enabling the middle region should restore all connections") {
+			navigation_server->region_set_enabled(regions[1], false);
+			navigation_server->process(0.0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_POLYGON_COUNT), 2);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_MERGE_COUNT), 0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), 0);
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(5, 0, 5), Vector3(25, 0, 5), true);
+			REQUIRE_NE(path.size(), 0);
+			CHECK_LE(path[path.size() - 1].x, 10.0);
+
+			navigation_server->region_set_enabled(regions[1], true);
+			navigation_server->process(0.0);
+			check_connected();
+		}
+
+		SUBCASE("Moving the last region away and back should restore the margin connections") {
+			navigation_server->region_set_transform(regions[2], Transform3D(Basis(), Vector3(100, 0, 0)));
+			navigation_server->process(0.0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_MERGE_COUNT), 1);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), 0);
+
+			navigation_server->region_set_transform(regions[2], Transform3D());
+			navigation_server->process(0.0);
+			check_connected();
+		}
+
+		for (int i = 0; i < 3; i++) {
+			navigation_server->free(regions[i]);
+		}
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
@@ -0,0 +1,336 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "servers/physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+// A grid of static boxes, so rays crossing it hit several candidates in the broadphase.
+static void create_box_grid(RID p_space, RID p_shape, int p_size, LocalVector<RID> &r_bodies) {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	for (int x = 0; x < p_size; x++) {
+		for (int y = 0; y < p_size; y++) {
+			for (int z = 0; z < p_size; z++) {
+				RID body = physics_server->body_create();
+				physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+				physics_server->body_add_shape(body, p_shape);
+				physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(x, y, z) * 2.0));
+				physics_server->body_set_space(body, p_space);
+				r_bodies.push_back(body);
+			}
+		}
+	}
+}
+
+static void create_random_rays(int p_count, real_t p_extent, LocalVector<Vector3> &r_from, LocalVector<Vector3> &r_to) {
+	RandomPCG rng(42);
+	r_from.resize(p_count);
+	r_to.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		r_from[i] = Vector3(rng.random(-2.0f, p_extent), rng.random(-2.0f, p_extent), rng.random(-2.0f, p_extent));
+		r_to[i] = Vector3(rng.random(-2.0f, p_extent), rng.random(-2.0f, p_extent), rng.random(-2.0f, p_extent));
+	}
+}
+
+static void free_rids(RID p_space, RID p_shape, const LocalVector<RID> &p_bodies) {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	for (const RID &body : p_bodies) {
+		physics_server->free(body);
+	}
+	physics_server->free(p_shape);
+	physics_server->free(p_space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Batched ray queries match single ray queries") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.4, 0.4, 0.4));
+
+	const int grid_size = 8;
+	LocalVector<RID> bodies;
+	create_box_grid(space, shape, grid_size, bodies);
+
+	PhysicsDirectSpaceState3D *space_state = physics_server->space_get_direct_state(space);
+	REQUIRE(space_state);
+
+	// Enough rays to be split across worker threads.
+	const int ray_count = 2000;
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	create_random_rays(ray_count, grid_size * 2.0, from, to);
+
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+	LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+	LocalVector<bool> collided;
+	results.resize(ray_count);
+	collided.resize(ray_count);
+
+	int collided_count = space_state->intersect_ray_batch(parameters, from.ptr(), to.ptr(), ray_count, results.ptr(), collided.ptr());
+
+	int single_collided_count = 0;
+	int mismatch_count = 0;
+	for (int i = 0; i < ray_count; i++) {
+		parameters.from = from[i];
+		parameters.to = to[i];
+		PhysicsDirectSpaceState3D::RayResult result;
+		bool single_collided = space_state->intersect_ray(parameters, result);
+		if (single_collided) {
+			single_collided_count++;
+		}
+		if (single_collided != collided[i]) {
+			mismatch_count++;
+		} else if (single_collided && (result.rid != results[i].rid || result.shape != results[i].shape || !result.position.is_equal_approx(results[i].position))) {
+			mismatch_count++;
+		}
+	}
+
+	CHECK_MESSAGE(collided_count > 0, "Some rays should cross the grid.");
+	CHECK(collided_count == single_collided_count);
+	CHECK(mismatch_count == 0);
+
+	CHECK_MESSAGE(space_state->intersect_ray_batch(parameters, nullptr, nullptr, 0, nullptr, nullptr) == 0, "Empty batches should be handled.");
+
+	free_rids(space, shape, bodies);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Bound ray batch method matches single ray queries") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.4, 0.4, 0.4));
+
+	const int grid_size = 8;
+	LocalVector<RID> bodies;
+	create_box_grid(space, shape, grid_size, bodies);
+
+	PhysicsDirectSpaceState3D *space_state = physics_server->space_get_direct_state(space);
+	REQUIRE(space_state);
+
+	const int ray_count = 1000;
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	create_random_rays(ray_count, grid_size * 2.0, from, to);
+
+	// Both go through the bound methods, as scripts would.
+	Ref<PhysicsRayQueryParameters3D> query;
+	query.instantiate();
+
+	int single_collided_count = 0;
+	for (int i = 0; i < ray_count; i++) {
+		query->set_from(from[i]);
+		query->set_to(to[i]);
+		Dictionary result = space_state->call("intersect_ray", query);
+		if (!result.is_empty()) {
+			single_collided_count++;
+		}
+	}
+
+	PackedVector3Array from_array;
+	PackedVector3Array to_array;
+	from_array.resize(ray_count);
+	to_array.resize(ray_count);
+	for (int i = 0; i < ray_count; i++) {
+		from_array.set(i, from[i]);
+		to_array.set(i, to[i]);
+	}
+
+	Dictionary batch_result = space_state->call("intersect_ray_batch", query, from_array, to_array);
+
+	PackedByteArray collided = batch_result["collided"];
+	REQUIRE(collided.size() == ray_count);
+	int batch_collided_count = 0;
+	for (int i = 0; i < ray_count; i++) {
+		batch_collided_count += collided[i];
+	}
+	CHECK(batch_collided_count == single_collided_count);
+
+	free_rids(space, shape, bodies);
+}
+
+TEST_CASE("[Benchmark][SceneTree][PhysicsServer3D] 10000 single ray queries against one ray batch" * doctest::skip()) {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.4, 0.4, 0.4));
+
+	const int grid_size = 16;
+	LocalVector<RID> bodies;
+	create_box_grid(space, shape, grid_size, bodies);
+
+	PhysicsDirectSpaceState3D *space_state = physics_server->space_get_direct_state(space);
+	REQUIRE(space_state);
+
+	const int ray_count = 10000;
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	create_random_rays(ray_count, grid_size * 2.0, from, to);
+
+	// Both go through the bound methods, as scripts would.
+	Ref<PhysicsRayQueryParameters3D> query;
+	query.instantiate();
+
+	int single_collided_count = 0;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < ray_count; i++) {
+		query->set_from(from[i]);
+		query->set_to(to[i]);
+		Dictionary result = space_state->call("intersect_ray", query);
+		if (!result.is_empty()) {
+			single_collided_count++;
+		}
+	}
+	uint64_t single_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	PackedVector3Array from_array;
+	PackedVector3Array to_array;
+	from_array.resize(ray_count);
+	to_array.resize(ray_count);
+	for (int i = 0; i < ray_count; i++) {
+		from_array.set(i, from[i]);
+		to_array.set(i, to[i]);
+	}
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	Dictionary batch_result = space_state->call("intersect_ray_batch", query, from_array, to_array);
+	uint64_t batch_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	PackedByteArray collided = batch_result["collided"];
+	REQUIRE(collided.size() == ray_count);
+	int batch_collided_count = 0;
+	for (int i = 0; i < ray_count; i++) {
+		batch_collided_count += collided[i];
+	}
+	CHECK(batch_collided_count == single_collided_count);
+
+	MESSAGE(vformat("%d rays: single calls %d usec, one batch %d usec.", ray_count, (int64_t)single_usec, (int64_t)batch_usec).utf8().get_data());
+
+	free_rids(space, shape, bodies);
+}
+
+// Drops a pile of rigid boxes on a floor and returns their transforms after p_steps.
+static LocalVector<Transform3D> simulate_box_pile(int p_size, int p_steps) {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	RID floor_shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(floor_shape, Vector3(p_size * 2.0, 0.5, p_size * 2.0));
+	RID floor = physics_server->body_create();
+	physics_server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	physics_server->body_add_shape(floor, floor_shape);
+	physics_server->body_set_space(floor, space);
+
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.4, 0.4, 0.4));
+
+	LocalVector<RID> bodies;
+	RandomPCG rng(7);
+	for (int x = 0; x < p_size; x++) {
+		for (int y = 0; y < p_size; y++) {
+			for (int z = 0; z < p_size; z++) {
+				RID body = physics_server->body_create();
+				physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+				physics_server->body_add_shape(body, shape);
+				// Jitter the positions so the boxes topple into each other instead of stacking.
+				Vector3 jitter(rng.random(-0.2f, 0.2f), 0.0, rng.random(-0.2f, 0.2f));
+				physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(x, y + 1.0, z) + jitter));
+				physics_server->body_set_space(body, space);
+				bodies.push_back(body);
+			}
+		}
+	}
+
+	for (int i = 0; i < p_steps; i++) {
+		physics_server->step(1.0 / 60.0);
+	}
+
+	LocalVector<Transform3D> transforms;
+	for (const RID &body : bodies) {
+		transforms.push_back(physics_server->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM));
+	}
+
+	physics_server->free(floor);
+	physics_server->free(floor_shape);
+	free_rids(space, shape, bodies);
+	return transforms;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Parallel integration matches serial integration") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	const StringName setting = "physics/3d/solver/parallel_integration";
+	const bool parallel_integration = GLOBAL_GET(setting);
+
+	// The setting is read when the stepper is created, so restart the server around each run.
+	// Enough bodies for the integration ranges to be split across worker threads.
+	const int pile_size = 6;
+	const int step_count = 90;
+
+	ProjectSettings::get_singleton()->set_setting(setting, false);
+	physics_server->finish();
+	physics_server->init();
+	LocalVector<Transform3D> serial = simulate_box_pile(pile_size, step_count);
+
+	ProjectSettings::get_singleton()->set_setting(setting, true);
+	physics_server->finish();
+	physics_server->init();
+	LocalVector<Transform3D> parallel = simulate_box_pile(pile_size, step_count);
+
+	ProjectSettings::get_singleton()->set_setting(setting, parallel_integration);
+	physics_server->finish();
+	physics_server->init();
+
+	REQUIRE(serial.size() == parallel.size());
+	int moved_count = 0;
+	int mismatch_count = 0;
+	for (uint32_t i = 0; i < serial.size(); i++) {
+		if (serial[i] != parallel[i]) {
+			mismatch_count++;
+		}
+		if (serial[i].basis != Basis()) {
+			moved_count++;
+		}
+	}
+	CHECK_MESSAGE(moved_count > 0, "Some boxes should have toppled.");
+	CHECK_MESSAGE(mismatch_count == 0, "Bodies should end up bit for bit where the serial path puts them.");
+}
+
+} // namespace TestPhysicsServer3D